@@ -14,14 +14,141 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/CodeGen/ParallelCG.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/Constants.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+#include <llvm/Object/ObjectFile.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetMachine.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
 
 using namespace ngraph;
 
+// Static constructors and destructors are collected into these functions so that they can be
+// run for modules that are split or loaded as object files
+static const char* s_static_init_name = "__ngraph_static_init";
+static const char* s_static_fini_name = "__ngraph_static_fini";
+
+// Writes under a unique name and then renames so that readers never see a partial object
+static void write_object_file(const std::string& path, llvm::StringRef obj)
+{
+    int fd;
+    llvm::SmallString<128> tmp_path;
+    if (llvm::sys::fs::createUniqueFile(path + "-%%%%%%.tmp", fd, tmp_path))
+    {
+        return;
+    }
+    {
+        llvm::raw_fd_ostream out(fd, true);
+        out << obj;
+    }
+    if (llvm::sys::fs::rename(tmp_path, path))
+    {
+        llvm::sys::fs::remove(tmp_path);
+    }
+}
+
+// Objects split across several files are stored as path, path.1, path.2, ...
+static std::string get_object_file_name(const std::string& path, size_t index)
+{
+    return index == 0 ? path : path + "." + std::to_string(index);
+}
+
+// Replace the global constructor or destructor array of the module with a single
+// externally visible function that calls the entries in priority order
+static void lower_static_structors(llvm::Module& module,
+                                   const char* array_name,
+                                   const char* function_name)
+{
+    std::vector<std::pair<uint64_t, llvm::Function*>> entries;
+    if (llvm::GlobalVariable* array = module.getNamedGlobal(array_name))
+    {
+        if (auto init = llvm::dyn_cast<llvm::ConstantArray>(array->getInitializer()))
+        {
+            for (auto& operand : init->operands())
+            {
+                auto entry = llvm::dyn_cast<llvm::ConstantStruct>(operand);
+                if (entry == nullptr)
+                {
+                    continue;
+                }
+                auto priority = llvm::dyn_cast<llvm::ConstantInt>(entry->getOperand(0));
+                auto function =
+                    llvm::dyn_cast<llvm::Function>(entry->getOperand(1)->stripPointerCasts());
+                if (priority && function)
+                {
+                    entries.push_back({priority->getZExtValue(), function});
+                }
+            }
+        }
+        array->eraseFromParent();
+    }
+    std::stable_sort(entries.begin(),
+                     entries.end(),
+                     [](const std::pair<uint64_t, llvm::Function*>& a,
+                        const std::pair<uint64_t, llvm::Function*>& b) {
+                         return a.first < b.first;
+                     });
+
+    llvm::LLVMContext& context = module.getContext();
+    llvm::Function* function =
+        llvm::Function::Create(llvm::FunctionType::get(llvm::Type::getVoidTy(context), false),
+                               llvm::GlobalValue::ExternalLinkage,
+                               function_name,
+                               &module);
+    llvm::IRBuilder<> builder(llvm::BasicBlock::Create(context, "entry", function));
+    for (auto& entry : entries)
+    {
+        builder.CreateCall(entry.second);
+    }
+    builder.CreateRetVoid();
+}
+
+namespace
+{
+    // Writes the object code generated by MCJIT to a file
+    class ObjectFileWriter : public llvm::ObjectCache
+    {
+    public:
+        ObjectFileWriter(const std::string& path)
+            : m_path(path)
+        {
+        }
+
+        void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef obj) override
+        {
+            write_object_file(m_path, obj.getBuffer());
+        }
+
+        std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override
+        {
+            return nullptr;
+        }
+
+        const std::string& get_path() const { return m_path; }
+
+    private:
+        std::string m_path;
+    };
+}
+
 codegen::ExecutionEngine::ExecutionEngine()
     : m_execution_engine{nullptr}
+    , m_codegen_thread_count(1)
 {
 }
 
@@ -29,7 +156,7 @@ codegen::ExecutionEngine::~ExecutionEngine()
 {
     if (m_execution_engine)
     {
-        m_execution_engine->runStaticConstructorsDestructors(true);
+        call_static_structors(s_static_fini_name);
     }
 }
 
@@ -39,18 +166,24 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
     {
         if (!m_execution_engine)
         {
-            m_execution_engine.reset(llvm::EngineBuilder(module->take_module())
-                                         .setEngineKind(llvm::EngineKind::JIT)
-                                         .setOptLevel(llvm::CodeGenOpt::Aggressive)
-                                         .setMCPU(llvm::sys::getHostCPUName())
-                                         //  .setCodeModel(llvm::CodeModel::Medium)
-                                         .setErrorStr(&m_jit_error)
-                                         .create());
-
-            if (!m_execution_engine)
+            std::unique_ptr<llvm::Module> llvm_module = module->take_module();
+            lower_static_structors(*llvm_module, "llvm.global_ctors", s_static_init_name);
+            lower_static_structors(*llvm_module, "llvm.global_dtors", s_static_fini_name);
+
+            if (m_codegen_thread_count > 1)
+            {
+                return add_module_split(std::move(llvm_module));
+            }
+            if (!create_execution_engine(std::move(llvm_module)))
             {
                 return false;
             }
+            // Split and loaded objects are written by this class, so only the engine of an
+            // unsplit module reports its object to the cache
+            if (m_object_cache)
+            {
+                m_execution_engine->setObjectCache(m_object_cache.get());
+            }
         }
     }
     else
@@ -61,12 +194,141 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
     return true;
 }
 
+bool codegen::ExecutionEngine::add_module_split(std::unique_ptr<llvm::Module> module)
+{
+    // Run the backend on several partitions of the module concurrently and load the
+    // resulting objects into one engine
+    std::string triple = module->getTargetTriple();
+    std::vector<llvm::SmallString<0>> buffers(m_codegen_thread_count);
+    std::vector<std::unique_ptr<llvm::raw_svector_ostream>> streams;
+    std::vector<llvm::raw_pwrite_stream*> outputs;
+    for (auto& buffer : buffers)
+    {
+        streams.emplace_back(new llvm::raw_svector_ostream(buffer));
+        outputs.push_back(streams.back().get());
+    }
+
+    llvm::splitCodeGen(std::move(module), outputs, {}, [&triple]() {
+        // Match the target configuration MCJIT uses for its own modules
+        llvm::SmallVector<std::string, 1> attrs;
+        return std::unique_ptr<llvm::TargetMachine>(
+            llvm::EngineBuilder()
+                .setOptLevel(llvm::CodeGenOpt::Aggressive)
+                .selectTarget(llvm::Triple(triple), "", llvm::sys::getHostCPUName(), attrs));
+    });
+    streams.clear();
+
+    if (!create_empty_execution_engine())
+    {
+        return false;
+    }
+    for (auto& obj : buffers)
+    {
+        std::unique_ptr<llvm::MemoryBuffer> buffer =
+            llvm::MemoryBuffer::getMemBufferCopy(llvm::StringRef(obj.data(), obj.size()));
+        auto object = llvm::object::ObjectFile::createObjectFile(buffer->getMemBufferRef());
+        if (!object)
+        {
+            llvm::consumeError(object.takeError());
+            return false;
+        }
+        m_execution_engine->addObjectFile(
+            llvm::object::OwningBinary<llvm::object::ObjectFile>(std::move(*object),
+                                                                 std::move(buffer)));
+    }
+
+    if (auto writer = static_cast<ObjectFileWriter*>(m_object_cache.get()))
+    {
+        // Write the first part last, it is the one readers look for
+        for (size_t i = buffers.size(); i-- > 0;)
+        {
+            write_object_file(get_object_file_name(writer->get_path(), i),
+                              llvm::StringRef(buffers[i].data(), buffers[i].size()));
+        }
+    }
+
+    return true;
+}
+
+bool codegen::ExecutionEngine::add_object_file(const std::string& path)
+{
+    // Modules split for code generation were written as one object per partition. Check
+    // that all of them exist so that an incomplete set is never partially loaded.
+    size_t part_count = m_codegen_thread_count;
+    for (size_t i = 0; i < part_count; i++)
+    {
+        if (!llvm::sys::fs::exists(get_object_file_name(path, i)))
+        {
+            return false;
+        }
+    }
+
+    if (!m_execution_engine && !create_empty_execution_engine())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < part_count; i++)
+    {
+        auto object = llvm::object::ObjectFile::createObjectFile(get_object_file_name(path, i));
+        if (!object)
+        {
+            // Drop the objects loaded so far so that the module can still be added instead
+            llvm::consumeError(object.takeError());
+            m_execution_engine.reset();
+            return false;
+        }
+        m_execution_engine->addObjectFile(std::move(*object));
+    }
+
+    return true;
+}
+
+void codegen::ExecutionEngine::set_object_output_file(const std::string& path)
+{
+    m_object_cache.reset(new ObjectFileWriter(path));
+}
+
+void codegen::ExecutionEngine::set_codegen_thread_count(size_t count)
+{
+    m_codegen_thread_count = std::max<size_t>(count, 1);
+}
+
+bool codegen::ExecutionEngine::create_empty_execution_engine()
+{
+    // MCJIT requires a module so start from an empty one
+    m_context.reset(new llvm::LLVMContext());
+    std::unique_ptr<llvm::Module> module(new llvm::Module("objects", *m_context));
+    return create_execution_engine(std::move(module));
+}
+
+bool codegen::ExecutionEngine::create_execution_engine(std::unique_ptr<llvm::Module> module)
+{
+    m_execution_engine.reset(llvm::EngineBuilder(std::move(module))
+                                 .setEngineKind(llvm::EngineKind::JIT)
+                                 .setOptLevel(llvm::CodeGenOpt::Aggressive)
+                                 .setMCPU(llvm::sys::getHostCPUName())
+                                 //  .setCodeModel(llvm::CodeModel::Medium)
+                                 .setErrorStr(&m_jit_error)
+                                 .create());
+
+    return m_execution_engine != nullptr;
+}
+
+void codegen::ExecutionEngine::call_static_structors(const std::string& function_name)
+{
+    if (auto function = get_pointer_to_named_function(function_name))
+    {
+        reinterpret_cast<void (*)()>(function)();
+    }
+}
+
 void codegen::ExecutionEngine::finalize()
 {
     if (m_execution_engine)
     {
         m_execution_engine->finalizeObject();
-        m_execution_engine->runStaticConstructorsDestructors(false);
+        call_static_structors(s_static_init_name);
     }
     else
     {
@@ -88,3 +350,28 @@ void* codegen::ExecutionEngine::get_pointer_to_named_function(const std::string&
     // set AbortOnFailure flag to false so call fails by returning nullptr
     return m_execution_engine->getPointerToNamedFunction(fname, false);
 }
+
+std::string codegen::ExecutionEngine::get_host_cpu_signature()
+{
+    std::string signature = llvm::sys::getProcessTriple() + " " + llvm::sys::getHostCPUName().str();
+
+    llvm::StringMap<bool> host_features;
+    if (llvm::sys::getHostCPUFeatures(host_features))
+    {
+        std::vector<std::string> features;
+        for (const auto& feature : host_features)
+        {
+            if (feature.getValue())
+            {
+                features.push_back(feature.getKey().str());
+            }
+        }
+        std::sort(features.begin(), features.end());
+        for (const std::string& feature : features)
+        {
+            signature += " +" + feature;
+        }
+    }
+
+    return signature;
+}
@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 
 #include "ngraph/codegen/compiler.hpp"
 
@@ -33,6 +34,8 @@ namespace llvm
 {
     class Module;
     class ExecutionEngine;
+    class LLVMContext;
+    class ObjectCache;
 }
 
 class ngraph::codegen::ExecutionEngine
@@ -42,8 +45,27 @@ public:
     ~ExecutionEngine();
 
     bool add_module(std::unique_ptr<ngraph::codegen::Module>& module);
+
+    /// @brief Add object code previously written by set_object_output_file.
+    ///
+    /// The codegen thread count must match the one used when the object was written.
+    /// @returns false if the object, or any of its parts, could not be loaded
+    bool add_object_file(const std::string& path);
+
+    /// @brief Write the object code generated for the module to path when finalize is called.
+    ///
+    /// Must be called before add_module.
+    void set_object_output_file(const std::string& path);
+
+    /// @brief Split modules into this many partitions and generate their machine code
+    /// concurrently. Must be called before add_module.
+    void set_codegen_thread_count(size_t count);
+
     void finalize();
 
+    /// @brief Identify the host target and CPU features that generated code depends on
+    static std::string get_host_cpu_signature();
+
     template <typename ftype>
     std::function<ftype> find_function(const std::string& func_name)
     {
@@ -51,8 +73,16 @@ public:
     }
 
 private:
+    std::unique_ptr<llvm::LLVMContext> m_context;
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
+    size_t m_codegen_thread_count;
+
+    bool add_module_split(std::unique_ptr<llvm::Module> module);
+    bool create_execution_engine(std::unique_ptr<llvm::Module> module);
+    bool create_empty_execution_engine();
+    void call_static_structors(const std::string& function_name);
 
     void* get_pointer_to_named_function(const std::string& func_name);
     template <typename signature>
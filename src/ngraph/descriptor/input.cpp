@@ -37,6 +37,7 @@ void Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    m_node->increment_graph_versions();
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
 
@@ -58,6 +58,7 @@ public:
     void set_pool_offset(size_t);
     size_t get_pool_offset() const;
     const element::Type& get_element_type() const { return m_element_type; }
+    PrimaryTensorView* get_primary_tensor_view() const { return m_primary_tensor_view; }
     static std::string make_tensor_name(const Node* node, size_t value_index);
 
 protected:
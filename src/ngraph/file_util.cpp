@@ -24,6 +24,7 @@
 #include <stdexcept>
 #include <string.h>
 #include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/types.h>
@@ -181,6 +182,28 @@ std::string ngraph::file_util::get_temp_directory()
     return path;
 }
 
+shared_ptr<const char> ngraph::file_util::map_file(const string& path, size_t& size)
+{
+    size = get_file_size(path);
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw std::runtime_error("error opening file '" + path + "'");
+    }
+    // An empty mapping is not allowed, so map at least one byte past an empty file
+    void* data = mmap(nullptr, size == 0 ? 1 : size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping stays valid after the descriptor is closed
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw std::runtime_error("error mapping file '" + path + "'");
+    }
+    size_t mapped_size = size == 0 ? 1 : size;
+    return shared_ptr<const char>(static_cast<const char*>(data), [mapped_size](const char* p) {
+        munmap(const_cast<char*>(p), mapped_size);
+    });
+}
+
 vector<char> ngraph::file_util::read_file_contents(const string& path)
 {
     size_t file_size = get_file_size(path);
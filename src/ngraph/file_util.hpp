@@ -17,6 +17,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -39,6 +40,10 @@ public:
     static void remove_file(const std::string& file);
     static std::vector<char> read_file_contents(const std::string& path);
     static std::string read_file_to_string(const std::string& path);
+    /// \brief Maps a file read-only into memory. The pages are shared with every other
+    ///        process that maps the same file and are unmapped when the last copy of the
+    ///        returned pointer is released.
+    static std::shared_ptr<const char> map_file(const std::string& path, size_t& size);
     static void iterate_files(const std::string& path,
                               std::function<void(const std::string& file, bool is_dir)> func,
                               bool recurse = false);
@@ -37,6 +37,8 @@ Function::Function(const ResultVector& results,
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
+    , m_graph_version(make_shared<atomic<size_t>>(0))
+    , m_ordered_ops_version(0)
 {
     init();
 }
@@ -50,6 +52,8 @@ Function::Function(const NodeVector& results,
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_instance_id))
+    , m_graph_version(make_shared<atomic<size_t>>(0))
+    , m_ordered_ops_version(0)
 {
     if (std::any_of(results.cbegin(), results.cend(), [](std::shared_ptr<Node> n) {
             return std::dynamic_pointer_cast<op::Result>(n);
@@ -89,9 +93,21 @@ void Function::init()
     });
 }
 
-std::list<shared_ptr<Node>> Function::get_ordered_ops()
+shared_ptr<const std::list<shared_ptr<Node>>> Function::get_ordered_ops()
 {
-    return topological_sort(get_ops());
+    lock_guard<mutex> lock(m_ordered_ops_mutex);
+    size_t version = *m_graph_version;
+    if (m_ordered_ops == nullptr || m_ordered_ops_version != version)
+    {
+        auto ordered_ops = make_shared<std::list<shared_ptr<Node>>>(topological_sort(get_ops()));
+        for (auto& node : *ordered_ops)
+        {
+            node->add_graph_version(m_graph_version);
+        }
+        m_ordered_ops = ordered_ops;
+        m_ordered_ops_version = version;
+    }
+    return m_ordered_ops;
 }
 
 const std::string& Function::get_friendly_name() const
@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -75,7 +76,11 @@ namespace ngraph
         //  an XLA or regular function
         void set_name(const std::string& name);
         std::list<std::shared_ptr<Node>> get_ops() const;
-        std::list<std::shared_ptr<Node>> get_ordered_ops();
+        /// \brief The ops in topological order. The order is cached and only recomputed after
+        ///        an input of one of the ops has been connected to another output. A recomputed
+        ///        order replaces the cached one, so a returned list never changes and stays
+        ///        valid for as long as the caller holds on to it.
+        std::shared_ptr<const std::list<std::shared_ptr<Node>>> get_ordered_ops();
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
         size_t get_temporary_pool_size();
@@ -96,5 +101,11 @@ namespace ngraph
         size_t m_instance_id;
         std::string m_name;
         const std::string m_unique_name;
+
+        // Incremented by the ops of m_ordered_ops whenever one of their inputs is rewired
+        std::shared_ptr<std::atomic<size_t>> m_graph_version;
+        std::mutex m_ordered_ops_mutex;
+        std::shared_ptr<const std::list<std::shared_ptr<Node>>> m_ordered_ops;
+        size_t m_ordered_ops_version;
     };
 }
@@ -16,6 +16,7 @@
 
 #include "ngraph/node.hpp"
 #include <memory>
+#include <mutex>
 #include <typeindex>
 #include <typeinfo>
 
@@ -35,6 +36,9 @@ using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
 
+// Nodes may be shared between Functions that are compiled concurrently
+static mutex s_graph_versions_mutex;
+
 Node::Node(const std::string& node_type, const NodeVector& arguments)
     : m_node_type(node_type)
     , m_instance_id(m_next_instance_id.fetch_add(1))
@@ -138,6 +142,34 @@ void Node::set_placement(Placement placement)
     m_placement = placement;
 }
 
+void Node::add_graph_version(const shared_ptr<atomic<size_t>>& graph_version)
+{
+    lock_guard<mutex> lock(s_graph_versions_mutex);
+    auto it = m_graph_versions.begin();
+    while (it != m_graph_versions.end())
+    {
+        auto registered = it->lock();
+        if (registered == graph_version)
+        {
+            return;
+        }
+        it = registered ? it + 1 : m_graph_versions.erase(it);
+    }
+    m_graph_versions.push_back(graph_version);
+}
+
+void Node::increment_graph_versions()
+{
+    lock_guard<mutex> lock(s_graph_versions_mutex);
+    for (auto& graph_version : m_graph_versions)
+    {
+        if (auto registered = graph_version.lock())
+        {
+            (*registered)++;
+        }
+    }
+}
+
 std::shared_ptr<Node> Node::get_argument(size_t index) const
 {
     for (auto& i : get_inputs())
@@ -192,6 +192,13 @@ namespace ngraph
         NodeVector get_users() const;
 
         virtual std::shared_ptr<Node> get_default_value() const { return nullptr; }
+        /// Register a counter to increment whenever an input of this node is connected to
+        /// another output, so a Function can tell that its cached op order is stale
+        void add_graph_version(const std::shared_ptr<std::atomic<size_t>>& graph_version);
+
+        /// Increment the counters registered with add_graph_version
+        void increment_graph_versions();
+
     protected:
         void add_output(const element::Type& element_type, const Shape& shape);
 
@@ -204,5 +211,8 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
         Placement m_placement = Placement::DEFAULT;
+
+    private:
+        std::vector<std::weak_ptr<std::atomic<size_t>>> m_graph_versions;
     };
 }
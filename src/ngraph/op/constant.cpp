@@ -16,6 +16,7 @@
 
 #include <cmath>
 #include <cstdio>
+#include <mutex>
 
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
@@ -54,12 +55,59 @@ string to_cpp_string(T value)
 
 op::Constant::~Constant()
 {
-    if (m_data)
+    if (m_data && !m_shared_data)
     {
         aligned_free(m_data);
     }
 }
 
+shared_ptr<const void> op::Constant::load_data() const
+{
+    lock_guard<mutex> lock(m_load_mutex);
+    if (!m_data)
+    {
+        m_shared_data = m_loader();
+        if (!m_shared_data && shape_size(m_shape) != 0)
+        {
+            throw ngraph_error("Failed to load the data of " + get_name());
+        }
+        m_data = const_cast<void*>(m_shared_data.get());
+    }
+    return m_shared_data;
+}
+
+shared_ptr<const void> op::Constant::get_data() const
+{
+    if (m_loader)
+    {
+        return load_data();
+    }
+    if (m_shared_data)
+    {
+        return m_shared_data;
+    }
+    // Data allocated by the constant lives as long as the constant
+    return shared_ptr<const void>(shared_from_this(), m_data);
+}
+
+bool op::Constant::is_data_loaded() const
+{
+    lock_guard<mutex> lock(m_load_mutex);
+    return m_data != nullptr || !m_loader;
+}
+
+bool op::Constant::release_data()
+{
+    if (!m_loader)
+    {
+        return false;
+    }
+    lock_guard<mutex> lock(m_load_mutex);
+    m_shared_data.reset();
+    m_data = nullptr;
+    return true;
+}
+
 vector<string> op::Constant::get_value_strings() const
 {
     vector<string> rc;
@@ -155,6 +203,14 @@ shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) co
     {
         throw ngraph_error("Incorrect number of new arguments");
     }
+    if (m_loader)
+    {
+        return make_shared<Constant>(m_element_type, m_shape, m_loader);
+    }
+    if (m_shared_data)
+    {
+        return make_shared<Constant>(m_element_type, m_shape, m_shared_data);
+    }
     return make_shared<Constant>(m_element_type, m_shape, m_data);
 }
 
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <cstring>
+#include <functional>
+#include <mutex>
 #include <sstream>
 
 #include "ngraph/log.hpp"
@@ -104,6 +106,47 @@ namespace ngraph
                 set_value_type_checked(vt);
             }
 
+            /// \brief Constructs a tensor constant over data owned elsewhere, such as the pages
+            ///        of a memory-mapped model file. The data is not copied; the constant holds
+            ///        a reference to it and never writes to it.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data The constant data, suitably aligned for the element type.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const std::shared_ptr<const void>& data)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(const_cast<void*>(data.get()))
+                , m_shared_data(data)
+            {
+                auto vt = std::make_shared<TensorViewType>(type, shape);
+                set_value_type_checked(vt);
+            }
+
+            /// \brief Produces the data of a lazily loaded constant
+            using DataLoader = std::function<std::shared_ptr<const void>()>;
+
+            /// \brief Constructs a tensor constant whose data is only loaded, by calling
+            ///        loader, the first time it is accessed. This constructor is to support
+            ///        deserializing models of which only part is used.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param loader Returns the constant data, suitably aligned for the element type.
+            Constant(const element::Type& type, const Shape& shape, const DataLoader& loader)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(nullptr)
+                , m_loader(loader)
+            {
+                auto vt = std::make_shared<TensorViewType>(type, shape);
+                set_value_type_checked(vt);
+            }
+
             virtual ~Constant() override;
 
             /// \brief Wrapper around constructing a shared_ptr of a Constant
@@ -145,7 +188,8 @@ namespace ngraph
                 }
 
                 std::vector<T> rc;
-                const T* p = reinterpret_cast<const T*>(m_data);
+                std::shared_ptr<const void> data = get_data();
+                const T* p = reinterpret_cast<const T*>(data.get());
                 for (size_t i = 0; i < shape_size(m_shape); i++)
                 {
                     rc.push_back(p[i]);
@@ -153,13 +197,36 @@ namespace ngraph
                 return rc;
             }
 
-            const void* get_data_ptr() const { return m_data; }
+            /// \brief The constant data, which stays valid for as long as the returned pointer
+            ///        is held, even if release_data is called meanwhile. Backends that keep
+            ///        using the data after compiling hold on to it this way. A lazily loaded
+            ///        constant is loaded by the first call. The constant must be owned by a
+            ///        shared_ptr.
+            std::shared_ptr<const void> get_data() const;
+
+            /// \brief The constant data. A lazily loaded constant is loaded by the first call.
+            ///        The pointer is only valid until release_data is called; use get_data when
+            ///        that may happen concurrently.
+            const void* get_data_ptr() const { return m_loader ? load_data().get() : m_data; }
             template <typename T>
             const T* get_data_ptr() const
             {
-                return reinterpret_cast<T*>(m_data);
+                return reinterpret_cast<const T*>(get_data_ptr());
             }
 
+            /// \brief Whether the data of a lazily loaded constant is currently in memory.
+            ///        Always true for other constants.
+            bool is_data_loaded() const;
+
+            /// \brief Drops the data of a lazily loaded constant. It is loaded again by the next
+            ///        access. Data obtained through get_data, such as the weights a backend
+            ///        compiled the constant into, is only freed once those owners let go of it
+            ///        too, so this may be called at any time. Pointers returned by
+            ///        get_data_ptr must not be used afterwards.
+            ///
+            /// \return false, and nothing is dropped, if the constant is not lazily loaded
+            bool release_data();
+
             bool is_constant() const override { return true; }
         protected:
             template <typename T>
@@ -239,9 +306,15 @@ namespace ngraph
                 }
             }
 
+            std::shared_ptr<const void> load_data() const;
+
             element::Type m_element_type;
             Shape m_shape;
-            void* m_data;
+            mutable void* m_data;
+            /// \brief Set when m_data is borrowed rather than allocated by the constant
+            mutable std::shared_ptr<const void> m_shared_data;
+            DataLoader m_loader;
+            mutable std::mutex m_load_mutex;
         };
     }
 }
@@ -0,0 +1,47 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/util/quantization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::Dequantize::Dequantize(const shared_ptr<Node>& arg,
+                           const element::Type& element_type,
+                           double scale,
+                           int64_t zero_point)
+    : UnaryElementwise("Dequantize", element_type, arg)
+    , m_scale(scale)
+    , m_zero_point(zero_point)
+{
+    if (!element_type.is_real())
+    {
+        throw ngraph_error("Dequantize result must have a real element type");
+    }
+    util::validate_quantization("Dequantize", arg->get_element_type(), scale, zero_point);
+}
+
+shared_ptr<Node> op::Dequantize::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 1)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<Dequantize>(new_args.at(0), get_element_type(), m_scale, m_zero_point);
+}
@@ -0,0 +1,57 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "ngraph/op/util/unary_elementwise.hpp"
+#include "ngraph/type/type.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Elementwise quantization of real values to i8 or u8.
+        ///
+        /// Each element x becomes round(x / scale) + zero_point, rounded to the nearest integer
+        /// with ties to even and saturated to the range of the output type, so the quantized
+        /// value q stands for the real value scale * (q - zero_point).
+        class Quantize : public util::UnaryElementwise
+        {
+        public:
+            /// \brief Constructs a quantization operation.
+            ///
+            /// \param arg          Node that produces the real input tensor.
+            /// \param element_type Element type of the output tensor, i8 or u8.
+            /// \param scale        Real value of one quantization step.
+            /// \param zero_point   Quantized value that stands for real zero.
+            Quantize(const std::shared_ptr<Node>& arg,
+                     const ngraph::element::Type& element_type,
+                     double scale,
+                     int64_t zero_point);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            double get_scale() const { return m_scale; }
+            int64_t get_zero_point() const { return m_zero_point; }
+        protected:
+            double m_scale;
+            int64_t m_zero_point;
+        };
+    }
+}
@@ -16,15 +16,48 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
 namespace ngraph
 {
     namespace op
     {
         namespace util
         {
+            /// \brief An output of an op that may be written over one of its inputs.
+            struct oi_pair
+            {
+                size_t output;
+                size_t input;
+            };
+
             /// \brief Abstract base class for annotations added to graph ops
             class OpAnnotations
             {
+            public:
+                virtual ~OpAnnotations() {}
+                /// \brief Allows the kernel to write output oi.output into the buffer of input
+                ///        oi.input. MemoryLayout aliases the two only when the input is not
+                ///        used after the op and both need the same amount of memory.
+                void add_in_place_oi_pair(const oi_pair& oi)
+                {
+                    for (auto& existing : m_in_place_oi_pairs)
+                    {
+                        if (existing.output == oi.output && existing.input == oi.input)
+                        {
+                            return;
+                        }
+                    }
+                    m_in_place_oi_pairs.push_back(oi);
+                }
+                const std::vector<oi_pair>& get_in_place_oi_pairs() const
+                {
+                    return m_in_place_oi_pairs;
+                }
+
+            private:
+                std::vector<oi_pair> m_in_place_oi_pairs;
             };
         }
     }
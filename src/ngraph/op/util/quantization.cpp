@@ -0,0 +1,49 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "ngraph/except.hpp"
+#include "ngraph/op/util/quantization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool op::util::is_quantized_type(const element::Type& type)
+{
+    return type == element::i8 || type == element::u8;
+}
+
+void op::util::validate_quantization(const string& op_name,
+                                     const element::Type& type,
+                                     double scale,
+                                     int64_t zero_point)
+{
+    if (!is_quantized_type(type))
+    {
+        throw ngraph_error(op_name + " quantized element type must be i8 or u8");
+    }
+    if (!(scale > 0) || !std::isfinite(scale))
+    {
+        throw ngraph_error(op_name + " scale must be positive and finite");
+    }
+    int64_t lowest = type == element::i8 ? -128 : 0;
+    int64_t highest = type == element::i8 ? 127 : 255;
+    if (zero_point < lowest || zero_point > highest)
+    {
+        throw ngraph_error(op_name + " zero point is out of range of the quantized element type");
+    }
+}
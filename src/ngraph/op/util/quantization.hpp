@@ -0,0 +1,41 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace util
+        {
+            /// \brief Whether quantized values may have the element type: i8 or u8.
+            bool is_quantized_type(const element::Type& type);
+
+            /// \brief Checks that scale and zero_point map real values to quantized values of
+            ///        the element type, and throws ngraph_error naming the op otherwise.
+            void validate_quantization(const std::string& op_name,
+                                       const element::Type& type,
+                                       double scale,
+                                       int64_t zero_point);
+        }
+    }
+}
@@ -399,7 +399,8 @@ static std::unordered_map<std::type_index, std::function<bool(std::shared_ptr<No
 bool ngraph::pass::AlgebraicSimplification::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
     bool replaced = false;
-    for (auto n : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto n : *ordered_ops)
     {
         if (n->is_output() || n->is_parameter())
         {
@@ -0,0 +1,323 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/runtime/reference/abs.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/divide.hpp"
+#include "ngraph/runtime/reference/maximum.hpp"
+#include "ngraph/runtime/reference/minimum.hpp"
+#include "ngraph/runtime/reference/multiply.hpp"
+#include "ngraph/runtime/reference/negate.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/subtract.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using ConstantVector = vector<shared_ptr<op::Constant>>;
+
+template <typename TI, typename TO>
+static shared_ptr<op::Constant> fold_convert(const Node& node, const op::Constant& arg)
+{
+    vector<TO> out(shape_size(node.get_shape()));
+    runtime::reference::convert<TI, TO>(arg.get_data_ptr<TI>(), out.data(), out.size());
+    return make_shared<op::Constant>(node.get_element_type(), node.get_shape(), out.data());
+}
+
+template <typename TI>
+static shared_ptr<op::Constant> fold_convert(const Node& node, const op::Constant& arg)
+{
+    const element::Type& type = node.get_element_type();
+    if (type == element::boolean)
+    {
+        return fold_convert<TI, char>(node, arg);
+    }
+    else if (type == element::f32)
+    {
+        return fold_convert<TI, float>(node, arg);
+    }
+    else if (type == element::f64)
+    {
+        return fold_convert<TI, double>(node, arg);
+    }
+    else if (type == element::i8)
+    {
+        return fold_convert<TI, int8_t>(node, arg);
+    }
+    else if (type == element::i16)
+    {
+        return fold_convert<TI, int16_t>(node, arg);
+    }
+    else if (type == element::i32)
+    {
+        return fold_convert<TI, int32_t>(node, arg);
+    }
+    else if (type == element::i64)
+    {
+        return fold_convert<TI, int64_t>(node, arg);
+    }
+    else if (type == element::u8)
+    {
+        return fold_convert<TI, uint8_t>(node, arg);
+    }
+    else if (type == element::u16)
+    {
+        return fold_convert<TI, uint16_t>(node, arg);
+    }
+    else if (type == element::u32)
+    {
+        return fold_convert<TI, uint32_t>(node, arg);
+    }
+    else if (type == element::u64)
+    {
+        return fold_convert<TI, uint64_t>(node, arg);
+    }
+    return nullptr;
+}
+
+template <typename TI, typename TO>
+static shared_ptr<op::Constant> fold_quantize(const op::Quantize& quantize, const op::Constant& arg)
+{
+    vector<TO> out(shape_size(quantize.get_shape()));
+    runtime::reference::quantize<TI, TO>(arg.get_data_ptr<TI>(),
+                                         out.data(),
+                                         out.size(),
+                                         quantize.get_scale(),
+                                         quantize.get_zero_point());
+    return make_shared<op::Constant>(quantize.get_element_type(), quantize.get_shape(), out.data());
+}
+
+// Returns the constant computed by node from args, or nullptr if the op is not supported
+template <typename T>
+static shared_ptr<op::Constant> fold_constant(const shared_ptr<Node>& node,
+                                              const ConstantVector& args)
+{
+    if (dynamic_pointer_cast<op::Convert>(node))
+    {
+        return fold_convert<T>(*node, *args[0]);
+    }
+    // Dequantize is not folded, so backends can run quantized weights through int8 kernels
+    if (auto quantize = dynamic_pointer_cast<op::Quantize>(node))
+    {
+        if (quantize->get_element_type() == element::i8)
+        {
+            return fold_quantize<T, int8_t>(*quantize, *args[0]);
+        }
+        return fold_quantize<T, uint8_t>(*quantize, *args[0]);
+    }
+
+    vector<T> out(shape_size(node->get_shape()));
+    const T* arg0 = args[0]->get_data_ptr<T>();
+    const T* arg1 = args.size() > 1 ? args[1]->get_data_ptr<T>() : nullptr;
+    if (auto reshape = dynamic_pointer_cast<op::Reshape>(node))
+    {
+        runtime::reference::reshape<T>(arg0,
+                                       out.data(),
+                                       args[0]->get_shape(),
+                                       reshape->get_input_order(),
+                                       reshape->get_shape());
+    }
+    else if (auto broadcast = dynamic_pointer_cast<op::Broadcast>(node))
+    {
+        runtime::reference::broadcast<T>(arg0,
+                                         out.data(),
+                                         args[0]->get_shape(),
+                                         broadcast->get_shape(),
+                                         broadcast->get_broadcast_axes());
+    }
+    else if (auto slice = dynamic_pointer_cast<op::Slice>(node))
+    {
+        runtime::reference::slice<T>(arg0,
+                                     out.data(),
+                                     args[0]->get_shape(),
+                                     slice->get_lower_bounds(),
+                                     slice->get_upper_bounds(),
+                                     slice->get_strides(),
+                                     slice->get_shape());
+    }
+    else if (dynamic_pointer_cast<op::Negative>(node))
+    {
+        runtime::reference::negate<T>(arg0, out.data(), out.size());
+    }
+    else if (dynamic_pointer_cast<op::Abs>(node))
+    {
+        runtime::reference::abs<T>(arg0, out.data(), out.size());
+    }
+    else if (dynamic_pointer_cast<op::Add>(node))
+    {
+        runtime::reference::add<T>(arg0, arg1, out.data(), out.size());
+    }
+    else if (dynamic_pointer_cast<op::Subtract>(node))
+    {
+        runtime::reference::subtract<T>(arg0, arg1, out.data(), out.size());
+    }
+    else if (dynamic_pointer_cast<op::Multiply>(node))
+    {
+        runtime::reference::multiply<T>(arg0, arg1, out.data(), out.size());
+    }
+    else if (dynamic_pointer_cast<op::Divide>(node))
+    {
+        runtime::reference::divide<T>(arg0, arg1, out.data(), out.size());
+    }
+    else if (dynamic_pointer_cast<op::Maximum>(node))
+    {
+        runtime::reference::maximum<T>(arg0, arg1, out.data(), out.size());
+    }
+    else if (dynamic_pointer_cast<op::Minimum>(node))
+    {
+        runtime::reference::minimum<T>(arg0, arg1, out.data(), out.size());
+    }
+    else
+    {
+        return nullptr;
+    }
+    return make_shared<op::Constant>(node->get_element_type(), node->get_shape(), out.data());
+}
+
+static shared_ptr<op::Constant> fold_constant(const shared_ptr<Node>& node,
+                                              const ConstantVector& args)
+{
+    // Convert and Quantize dispatch on the type of their argument, everything else on its own
+    // type
+    const element::Type& type = args[0]->get_element_type();
+    if (type == element::boolean)
+    {
+        return fold_constant<char>(node, args);
+    }
+    else if (type == element::f32)
+    {
+        return fold_constant<float>(node, args);
+    }
+    else if (type == element::f64)
+    {
+        return fold_constant<double>(node, args);
+    }
+    else if (type == element::i8)
+    {
+        return fold_constant<int8_t>(node, args);
+    }
+    else if (type == element::i16)
+    {
+        return fold_constant<int16_t>(node, args);
+    }
+    else if (type == element::i32)
+    {
+        return fold_constant<int32_t>(node, args);
+    }
+    else if (type == element::i64)
+    {
+        return fold_constant<int64_t>(node, args);
+    }
+    else if (type == element::u8)
+    {
+        return fold_constant<uint8_t>(node, args);
+    }
+    else if (type == element::u16)
+    {
+        return fold_constant<uint16_t>(node, args);
+    }
+    else if (type == element::u32)
+    {
+        return fold_constant<uint32_t>(node, args);
+    }
+    else if (type == element::u64)
+    {
+        return fold_constant<uint64_t>(node, args);
+    }
+    return nullptr;
+}
+
+bool ngraph::pass::ConstantFolding::run_on_function(shared_ptr<ngraph::Function> f)
+{
+    bool replaced = false;
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto n : *ordered_ops)
+    {
+        if (n->is_output() || n->is_parameter() || n->is_constant() ||
+            n->get_output_size() != 1 || n->get_arguments().empty() ||
+            shape_size(n->get_shape()) == 0)
+        {
+            continue;
+        }
+
+        ConstantVector args;
+        for (auto arg : n->get_arguments())
+        {
+            if (auto constant = dynamic_pointer_cast<op::Constant>(arg))
+            {
+                args.push_back(constant);
+            }
+        }
+        if (args.size() != n->get_arguments().size())
+        {
+            continue;
+        }
+
+        size_t result_size = shape_size(n->get_shape()) * n->get_element_type().size();
+        size_t args_size = 0;
+        for (auto arg : args)
+        {
+            args_size += shape_size(arg->get_shape()) * arg->get_element_type().size();
+        }
+        if (result_size > args_size && result_size > m_max_expanded_size)
+        {
+            continue;
+        }
+
+        shared_ptr<op::Constant> constant;
+        try
+        {
+            constant = fold_constant(n, args);
+        }
+        catch (const domain_error&)
+        {
+            // Leave integer division by zero to fail when the function is called
+        }
+        if (constant)
+        {
+            NGRAPH_DEBUG << " Replacing " << n->get_name() << " with " << constant->get_name();
+            replace_node(n, constant);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
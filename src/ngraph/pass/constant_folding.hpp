@@ -0,0 +1,52 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class ConstantFolding;
+    }
+}
+
+/// \brief Evaluates ops whose arguments are all constants with the reference kernels and
+///        replaces them with the resulting constants. Folding proceeds in topological order, so
+///        whole chains of Reshape, Broadcast, Convert and elementwise arithmetic over weights
+///        collapse into a single constant. Quantize is folded too, so f32 weights of a
+///        quantized model are stored as int8; Dequantize is kept for the backends to consume.
+///        A folded constant stays resident, so an op whose result is larger than its arguments,
+///        such as a Broadcast of a scalar to a weight shape, is only folded while the result
+///        stays small.
+class ngraph::pass::ConstantFolding : public FunctionPass
+{
+public:
+    /// \param max_expanded_size The largest result, in bytes, of an op that is folded even
+    ///        though its result is larger than its arguments.
+    ConstantFolding(size_t max_expanded_size = 64 * 1024)
+        : FunctionPass()
+        , m_max_expanded_size(max_expanded_size)
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+
+private:
+    size_t m_max_expanded_size;
+};
@@ -205,7 +205,8 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(
     bool replaced = false;
     std::unordered_map<NodeKey, std::shared_ptr<Node>> expressions{};
 
-    for (auto n : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto n : *ordered_ops)
     {
         if (n->is_output() || n->is_parameter() ||
             n->is_constant() /*we could CSE constants as well*/)
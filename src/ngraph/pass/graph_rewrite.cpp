@@ -15,12 +15,113 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "graph_rewrite.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
+
+namespace
+{
+    // Matchers whose pattern root is a concrete op can only match nodes of that op type, so
+    // they are indexed by it. Matchers rooted at a Label, Skip or Any are tried on every node.
+    // Candidates keep the registration order of the matchers.
+    template <typename MatcherT>
+    class MatcherIndex
+    {
+    public:
+        MatcherIndex(const std::vector<std::shared_ptr<MatcherT>>& matchers)
+            : m_matchers(matchers)
+        {
+        }
+
+        const std::vector<std::shared_ptr<MatcherT>>& candidates(const ngraph::Node& node)
+        {
+            std::type_index type(typeid(node));
+            auto it = m_candidates.find(type);
+            if (it == m_candidates.end())
+            {
+                std::vector<std::shared_ptr<MatcherT>> matchers;
+                for (auto& matcher : m_matchers)
+                {
+                    auto root = matcher->get_pattern();
+                    if (!root || std::dynamic_pointer_cast<ngraph::pattern::op::Pattern>(root) ||
+                        std::type_index(typeid(*root)) == type)
+                    {
+                        matchers.push_back(matcher);
+                    }
+                }
+                it = m_candidates.emplace(type, std::move(matchers)).first;
+            }
+            return it->second;
+        }
+
+    private:
+        const std::vector<std::shared_ptr<MatcherT>>& m_matchers;
+        std::unordered_map<std::type_index, std::vector<std::shared_ptr<MatcherT>>> m_candidates;
+    };
+
+    // A node is still part of the function if a chain of users leads from it to a Result.
+    // Nodes replaced by a rewrite keep pointing at their arguments, so they still show up as
+    // users until then.
+    bool reaches_result(const std::shared_ptr<ngraph::Node>& node,
+                        std::unordered_map<ngraph::Node*, bool>& memo)
+    {
+        auto it = memo.find(node.get());
+        if (it != memo.end())
+        {
+            return it->second;
+        }
+
+        std::vector<std::shared_ptr<ngraph::Node>> stack{node};
+        std::unordered_set<ngraph::Node*> visited{node.get()};
+        bool live = false;
+        while (!stack.empty() && !live)
+        {
+            auto n = stack.back();
+            stack.pop_back();
+            auto memoized = memo.find(n.get());
+            if (std::dynamic_pointer_cast<ngraph::op::Result>(n) ||
+                (memoized != memo.end() && memoized->second))
+            {
+                live = true;
+                break;
+            }
+            if (memoized != memo.end())
+            {
+                continue;
+            }
+            for (auto& user : n->get_users())
+            {
+                if (visited.insert(user.get()).second)
+                {
+                    stack.push_back(user);
+                }
+            }
+        }
+
+        if (live)
+        {
+            memo[node.get()] = true;
+        }
+        else
+        {
+            // Nothing reachable from node leads to a Result
+            for (auto n : visited)
+            {
+                memo[n] = false;
+            }
+        }
+        return live;
+    }
+}
 
 bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     const std::list<std::shared_ptr<ngraph::Node>>& nodes,
@@ -28,9 +129,10 @@ bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
     std::shared_ptr<ngraph::Function> f)
 {
     bool rewritten = false;
+    MatcherIndex<pattern::Matcher> index(matchers);
     for (auto node : nodes)
     {
-        for (auto matcher : matchers)
+        for (auto matcher : index.candidates(*node))
         {
             NGRAPH_DEBUG << "Running matcher " << matcher->get_name() << "("
                          << matcher->get_pattern()->get_name() << ") on " << node->get_name();
@@ -51,33 +153,84 @@ bool ngraph::pass::GraphRewrite::run_matchers_on_nodes_list(
 
 bool ngraph::pass::GraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
-    return run_matchers_on_nodes_list(f->get_ordered_ops(), m_matchers, f);
+    return run_matchers_on_nodes_list(*f->get_ordered_ops(), m_matchers, f);
 }
 
 bool ngraph::pass::RecurrentGraphRewrite::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
-    bool changed = false;
-    size_t i = 0;
-    do
+    MatcherIndex<pattern::RecurrentMatcher> index(m_matchers);
+
+    // Consumers are visited before their producers, so a recurrent match starts from the
+    // last cell of a chain and covers as many cells as possible
+    auto ordered_ops = f->get_ordered_ops();
+    std::deque<std::shared_ptr<Node>> worklist(ordered_ops->rbegin(), ordered_ops->rend());
+    std::unordered_set<Node*> queued;
+    for (auto& node : worklist)
     {
-        for (auto node : f->get_ops())
+        queued.insert(node.get());
+    }
+    // Every node seen so far, so nodes created by a callback can be told apart. Holding on to
+    // replaced nodes also keeps their addresses from being reused during the pass.
+    std::unordered_set<std::shared_ptr<Node>> known(ordered_ops->begin(), ordered_ops->end());
+    std::unordered_map<Node*, bool> live;
+
+    size_t num_rewrites = 0;
+    while (!worklist.empty() && num_rewrites < m_num_iters)
+    {
+        auto node = worklist.front();
+        worklist.pop_front();
+        queued.erase(node.get());
+        if (!reaches_result(node, live))
+        {
+            continue;
+        }
+
+        for (auto matcher : index.candidates(*node))
         {
-            for (auto matcher : m_matchers)
+            NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
+            if (!matcher->match(node))
+            {
+                continue;
+            }
+            NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
+
+            // A rewrite can only create new matches around the nodes it touched: the matched
+            // nodes, their users, and whatever the callback creates in their place
+            NodeVector neighbours = matcher->get_matched_nodes();
+            neighbours.push_back(node);
+            size_t num_matched = neighbours.size();
+            for (size_t i = 0; i < num_matched; i++)
             {
-                NGRAPH_DEBUG << "Running matcher " << matcher << " on " << node->get_name();
-                if (matcher->match(node))
+                auto users = neighbours[i]->get_users();
+                neighbours.insert(neighbours.end(), users.begin(), users.end());
+            }
+
+            if (!matcher->process_match())
+            {
+                continue;
+            }
+            num_rewrites++;
+            live.clear();
+
+            for (size_t i = 0; i < neighbours.size(); i++)
+            {
+                for (auto& arg : neighbours[i]->get_arguments())
                 {
-                    NGRAPH_DEBUG << "Matcher " << matcher << " matched " << node->get_name();
-                    if (matcher->process_match())
+                    if (known.insert(arg).second)
                     {
-                        changed = true;
-                        goto next_fusion;
+                        neighbours.push_back(arg);
                     }
                 }
             }
+            for (auto& neighbour : neighbours)
+            {
+                if (queued.insert(neighbour.get()).second)
+                {
+                    worklist.push_front(neighbour);
+                }
+            }
+            break;
         }
-    next_fusion:
-        i++;
-    } while (changed && i < m_num_iters);
-    return changed;
+    }
+    return num_rewrites > 0;
 }
@@ -43,6 +43,8 @@ namespace ngraph
 /// the existing ops by providing a callback to \p Matcher object
 /// Patterns can be added by using \sa add_matcher
 /// Callbacks should use \sa replace_node to transform matched sub graphs
+/// Matchers are indexed by the op type of their pattern root, so a node is only tried
+/// against matchers that can match it
 
 class ngraph::pass::GraphRewrite : public FunctionPass
 {
@@ -65,6 +67,11 @@ private:
     std::vector<std::shared_ptr<pattern::Matcher>> m_matchers;
 };
 
+/// \brief RecurrentGraphRewrite applies \sa RecurrentMatcher rewrites until none apply
+///
+/// Nodes are visited from a worklist, consumers first. After a successful rewrite only the
+/// matched nodes, their users and the nodes created by the callback are queued again, rather
+/// than rescanning the whole function. \p num_iters bounds the number of rewrites.
 class ngraph::pass::RecurrentGraphRewrite : public FunctionPass
 {
 public:
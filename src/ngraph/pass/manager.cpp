@@ -95,7 +95,7 @@ void ngraph::pass::Manager::run_passes(shared_ptr<Function> func)
         {
             for (shared_ptr<Function> f : fs)
             {
-                call_graph_pass->run_on_call_graph(f->get_ordered_ops());
+                call_graph_pass->run_on_call_graph(*f->get_ordered_ops());
             }
         }
 
@@ -14,11 +14,17 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <exception>
+#include <map>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
+#include "ngraph/except.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/op.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
@@ -27,35 +33,255 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 TensorSize tensor_size,
+                                 Planner planner,
+                                 InPlacePairs in_place_pairs)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_tensor_size(tensor_size)
+    , m_planner(planner)
+    , m_in_place_pairs(in_place_pairs)
 {
 }
 
+// In-place pairs of the annotations of a node
+static vector<op::util::oi_pair> get_annotated_in_place_pairs(const Node& node)
+{
+    auto op = dynamic_cast<const op::Op*>(&node);
+    if (!op || !op->get_op_annotations())
+    {
+        return {};
+    }
+    return op->get_op_annotations()->get_in_place_oi_pairs();
+}
+
+// Outputs of a node that take over the buffer of an input dying at the node, as allowed by its
+// in-place pairs
+static unordered_map<const descriptor::Tensor*, const descriptor::Tensor*>
+    get_in_place_outputs(const shared_ptr<Node>& node,
+                         const pass::MemoryLayout::TensorSize& tensor_size,
+                         const pass::MemoryLayout::InPlacePairs& in_place_pairs)
+{
+    unordered_map<const descriptor::Tensor*, const descriptor::Tensor*> in_place_outputs;
+    unordered_set<const descriptor::Tensor*> reused_inputs;
+    for (auto& oi : in_place_pairs(*node))
+    {
+        descriptor::Tensor* output = &node->get_output_tensor(oi.output);
+        descriptor::Tensor* input = &node->get_inputs().at(oi.input).get_tensor();
+        if (contains(node->liveness_new_list, output) &&
+            contains(node->liveness_free_list, input) && !contains(reused_inputs, input) &&
+            in_place_outputs.count(output) == 0 && tensor_size(*output) == tensor_size(*input))
+        {
+            in_place_outputs[output] = input;
+            reused_inputs.insert(input);
+        }
+    }
+    return in_place_outputs;
+}
+
 bool pass::MemoryLayout::run_on_function(shared_ptr<ngraph::Function> function)
 {
-    MemoryManager mm(m_alignment);
-    for (shared_ptr<Node> node : function->get_ordered_ops())
+    TensorSize tensor_size = [this](const descriptor::Tensor& tensor) {
+        return m_tensor_size ? m_tensor_size(tensor) : tensor.size();
+    };
+    InPlacePairs in_place_pairs =
+        m_in_place_pairs ? m_in_place_pairs : InPlacePairs(get_annotated_in_place_pairs);
+
+    if (m_planner == Planner::GREEDY)
+    {
+        MemoryManager mm(m_alignment);
+        auto ordered_ops = function->get_ordered_ops();
+        for (shared_ptr<Node> node : *ordered_ops)
+        {
+            unordered_map<const descriptor::Tensor*, const descriptor::Tensor*> in_place_outputs;
+            if (!m_disable_memory_sharing)
+            {
+                in_place_outputs = get_in_place_outputs(node, tensor_size, in_place_pairs);
+            }
+            unordered_set<const descriptor::Tensor*> reused_inputs;
+            for (descriptor::Tensor* tensor : node->liveness_new_list)
+            {
+                auto it = in_place_outputs.find(tensor);
+                if (it != in_place_outputs.end())
+                {
+                    tensor->set_pool_offset(it->second->get_pool_offset());
+                    reused_inputs.insert(it->second);
+                }
+                else
+                {
+                    tensor->set_pool_offset(mm.allocate(tensor_size(*tensor)));
+                }
+            }
+            if (!m_disable_memory_sharing)
+            {
+                for (const descriptor::Tensor* tensor : node->liveness_free_list)
+                {
+                    if (!contains(reused_inputs, tensor))
+                    {
+                        mm.free(tensor->get_pool_offset());
+                    }
+                }
+            }
+        }
+        function->set_temporary_pool_size(mm.max_allocated());
+        return false;
+    }
+
+    // Lifetimes are inclusive: a tensor freed by an op is still read while that op writes its
+    // outputs, so the two never share memory unless the op works in place. An in-place output
+    // joins the buffer of its input, extending that buffer's lifetime.
+    auto ordered_ops = function->get_ordered_ops();
+    const list<shared_ptr<Node>>& ops = *ordered_ops;
+    size_t last_step = ops.empty() ? 0 : ops.size() - 1;
+    vector<descriptor::Tensor*> tensors;
+    vector<size_t> tensor_buffers;
+    unordered_map<const descriptor::Tensor*, size_t> buffer_ids;
+    vector<size_t> buffer_sizes;
+    vector<size_t> first_steps;
+    vector<size_t> last_steps;
+    vector<const descriptor::Tensor*> buffer_owners;
+    size_t step = 0;
+    for (shared_ptr<Node> node : ops)
     {
+        unordered_map<const descriptor::Tensor*, const descriptor::Tensor*> in_place_outputs;
+        if (!m_disable_memory_sharing)
+        {
+            in_place_outputs = get_in_place_outputs(node, tensor_size, in_place_pairs);
+        }
         for (descriptor::Tensor* tensor : node->liveness_new_list)
         {
-            size_t offset = mm.allocate(tensor->size());
-            tensor->set_pool_offset(offset);
+            auto it = in_place_outputs.find(tensor);
+            size_t buffer;
+            if (it != in_place_outputs.end())
+            {
+                buffer = buffer_ids.at(it->second);
+            }
+            else
+            {
+                buffer = buffer_sizes.size();
+                buffer_sizes.push_back(tensor_size(*tensor));
+                first_steps.push_back(m_disable_memory_sharing ? 0 : step);
+                last_steps.push_back(last_step);
+                buffer_owners.push_back(tensor);
+            }
+            buffer_owners[buffer] = tensor;
+            buffer_ids[tensor] = buffer;
+            tensors.push_back(tensor);
+            tensor_buffers.push_back(buffer);
         }
         if (!m_disable_memory_sharing)
         {
             for (const descriptor::Tensor* tensor : node->liveness_free_list)
             {
-                mm.free(tensor->get_pool_offset());
+                size_t buffer = buffer_ids.at(tensor);
+                if (buffer_owners[buffer] == tensor)
+                {
+                    last_steps[buffer] = step;
+                }
             }
         }
+        step++;
+    }
+
+    IntervalPlanner planner(m_alignment);
+    for (size_t buffer = 0; buffer < buffer_sizes.size(); buffer++)
+    {
+        planner.add(buffer_sizes[buffer], first_steps[buffer], last_steps[buffer]);
     }
-    function->set_temporary_pool_size(mm.max_allocated());
+    planner.plan();
+    for (size_t i = 0; i < tensors.size(); i++)
+    {
+        tensors[i]->set_pool_offset(planner.get_offset(tensor_buffers[i]));
+    }
+    function->set_temporary_pool_size(planner.get_peak());
+    NGRAPH_DEBUG << "MemoryLayout " << function->get_name() << ": pool size " << planner.get_peak()
+                 << " bytes, lower bound " << planner.get_lower_bound() << " bytes";
 
     return false;
 }
 
+pass::IntervalPlanner::IntervalPlanner(size_t alignment)
+    : m_alignment{alignment}
+    , m_peak{0}
+    , m_lower_bound{0}
+{
+}
+
+size_t pass::IntervalPlanner::add(size_t size, size_t first, size_t last)
+{
+    if (first > last)
+    {
+        throw ngraph_error("IntervalPlanner: buffer lifetime ends before it starts");
+    }
+    m_buffers.push_back(Buffer{MemoryManager::align(size, m_alignment), first, last, 0});
+    return m_buffers.size() - 1;
+}
+
+void pass::IntervalPlanner::plan()
+{
+    // Lower bound: the heaviest step, found by sweeping lifetime boundaries in step order.
+    vector<pair<size_t, ptrdiff_t>> events;
+    for (const Buffer& buffer : m_buffers)
+    {
+        events.emplace_back(buffer.m_first, buffer.m_size);
+        events.emplace_back(buffer.m_last + 1, -static_cast<ptrdiff_t>(buffer.m_size));
+    }
+    sort(events.begin(), events.end());
+    size_t live = 0;
+    m_lower_bound = 0;
+    for (auto& event : events)
+    {
+        live += event.second;
+        m_lower_bound = max(m_lower_bound, live);
+    }
+
+    vector<size_t> order(m_buffers.size());
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return m_buffers[a].m_size > m_buffers[b].m_size;
+    });
+
+    // Placed buffers ordered by offset, so the gaps between those whose lifetimes intersect a
+    // new buffer come out of a single walk without sorting them again for every buffer.
+    m_peak = 0;
+    multimap<size_t, size_t> placed;
+    for (size_t id : order)
+    {
+        Buffer& buffer = m_buffers[id];
+
+        // Best fit among the gaps between conflicting buffers, else the end of the last one
+        size_t gap_start = 0;
+        size_t best_offset = numeric_limits<size_t>::max();
+        size_t best_waste = numeric_limits<size_t>::max();
+        for (auto it = placed.begin(); it != placed.end() && best_waste != 0; ++it)
+        {
+            const Buffer& other = m_buffers[it->second];
+            if (other.m_first > buffer.m_last || buffer.m_first > other.m_last)
+            {
+                continue;
+            }
+            if (other.m_offset > gap_start)
+            {
+                size_t gap = other.m_offset - gap_start;
+                if (gap >= buffer.m_size && gap - buffer.m_size < best_waste)
+                {
+                    best_waste = gap - buffer.m_size;
+                    best_offset = gap_start;
+                }
+            }
+            gap_start = max(gap_start, other.m_offset + other.m_size);
+        }
+        buffer.m_offset = best_offset == numeric_limits<size_t>::max() ? gap_start : best_offset;
+        m_peak = max(m_peak, buffer.m_offset + buffer.m_size);
+        placed.emplace(buffer.m_offset, id);
+    }
+}
+
 pass::MemoryManager::node::node(size_t size, block_state state)
     : m_size{size}
     , m_state{state}
@@ -16,31 +16,103 @@
 
 #pragma once
 
+#include <functional>
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
+#include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/pass/pass.hpp"
 
 namespace ngraph
 {
+    namespace descriptor
+    {
+        class Tensor;
+    }
+
     namespace pass
     {
         class MemoryLayout;
         class MemoryNode;
         class MemoryManager;
+        class IntervalPlanner;
     }
 }
 
 class ngraph::pass::MemoryLayout : public FunctionPass
 {
 public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
+    /// \brief Number of bytes reserved in the pool for a tensor.
+    using TensorSize = std::function<size_t(const descriptor::Tensor&)>;
+
+    /// \brief Outputs of a node that may be written over one of its inputs.
+    using InPlacePairs = std::function<std::vector<op::util::oi_pair>(const Node&)>;
+
+    /// \brief How pool offsets are chosen.
+    enum class Planner
+    {
+        /// Allocate and free tensors in execution order with MemoryManager.
+        GREEDY,
+        /// Place all tensor lifetimes at once with IntervalPlanner.
+        INTERVAL
+    };
+
+    /// \param tensor_size Overrides descriptor::Tensor::size() for backends whose layouts need
+    ///        more room than the dense shape, such as padded blocked formats.
+    /// \param in_place_pairs Overrides the in-place pairs of the op annotations, for backends
+    ///        that keep them out of the graph.
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 TensorSize tensor_size = nullptr,
+                 Planner planner = Planner::GREEDY,
+                 InPlacePairs in_place_pairs = nullptr);
     bool run_on_function(std::shared_ptr<ngraph::Function>) override;
 
 private:
     size_t m_alignment;
     bool m_disable_memory_sharing;
+    TensorSize m_tensor_size;
+    Planner m_planner;
+    InPlacePairs m_in_place_pairs;
+};
+
+/// \brief Offline planner for buffers whose lifetimes are known up front.
+///
+/// Each buffer is live over an inclusive range of steps. Buffers are placed largest first, each
+/// at the lowest-waste gap left by the already placed buffers whose lifetimes intersect its
+/// own, which packs far tighter than allocating in execution order.
+class ngraph::pass::IntervalPlanner
+{
+public:
+    IntervalPlanner(size_t alignment = 1);
+
+    /// \brief Adds a buffer live from step first through step last and returns its id.
+    size_t add(size_t size, size_t first, size_t last);
+
+    /// \brief Assigns offsets to all buffers added so far.
+    void plan();
+
+    size_t get_offset(size_t id) const { return m_buffers.at(id).m_offset; }
+    /// \brief Size of the pool needed by the plan.
+    size_t get_peak() const { return m_peak; }
+    /// \brief Largest total size of the buffers live at any one step. No placement can use
+    ///        less memory than this.
+    size_t get_lower_bound() const { return m_lower_bound; }
+private:
+    struct Buffer
+    {
+        size_t m_size;
+        size_t m_first;
+        size_t m_last;
+        size_t m_offset;
+    };
+
+    std::vector<Buffer> m_buffers;
+    size_t m_alignment;
+    size_t m_peak;
+    size_t m_lower_bound;
 };
 
 class ngraph::pass::MemoryManager
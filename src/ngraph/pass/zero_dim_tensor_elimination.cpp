@@ -43,7 +43,8 @@ static bool has_zero_dim(std::shared_ptr<Node> node)
 static bool verify_no_internal_zero_length_ops(std::shared_ptr<ngraph::Function> f)
 {
     std::set<std::shared_ptr<Node>> zero_length_nodes;
-    for (auto n : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto n : *ordered_ops)
     {
         if (n->is_output() || n->is_parameter() || n->get_outputs().size() > 1)
         {
@@ -77,7 +78,8 @@ bool ngraph::pass::ZeroDimTensorElimination::run_on_function(std::shared_ptr<ngr
     bool replaced = false;
     //we need to go over all nodes since we could have sum or any other 0-length-tensor-to scalar op
     //as an internal node (i.e. a node that isn't an argument to `op::Result`)
-    for (auto n : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto n : *ordered_ops)
     {
         //don't try to replace `op::Result`
         //all multi-output feed into `GetOutputElement`
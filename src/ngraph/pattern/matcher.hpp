@@ -200,6 +200,17 @@ namespace ngraph
             }
 
             size_t get_number_of_bound_labels() const { return m_matches.size(); }
+            /// \brief Returns the graph nodes bound to any label in any cell of the last match
+            NodeVector get_matched_nodes() const
+            {
+                NodeVector nodes;
+                for (auto& bound_nodes : m_matches)
+                {
+                    nodes.insert(nodes.end(), bound_nodes.second.begin(), bound_nodes.second.end());
+                }
+                return nodes;
+            }
+
             /// \brief Tries to match a pattern for an individual cell to a given \p graph
             bool match(std::shared_ptr<Node> graph);
 
@@ -207,6 +218,7 @@ namespace ngraph
             bool process_match();
 
             std::shared_ptr<Node> get_match_root() { return m_match_root; }
+            std::shared_ptr<Node> get_pattern() { return m_pattern; }
         private:
             std::shared_ptr<Node> m_pattern;
             std::shared_ptr<op::Label> m_recurrent_pattern;
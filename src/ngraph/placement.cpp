@@ -138,7 +138,8 @@ static vector<unordered_set<shared_ptr<Node>>>
         }
     }
     unordered_set<shared_ptr<Node>> f_nodes;
-    for (auto node : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto node : *ordered_ops)
     {
         f_nodes.insert(node);
     }
@@ -177,7 +178,8 @@ pair<vector<shared_ptr<Function>>, unordered_map<shared_ptr<op::Parameter>, shar
             map_node_to_cluster[node] = &cluster;
         }
     }
-    for (auto dst_node : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto dst_node : *ordered_ops)
     {
         for (auto src_node : dst_node->get_arguments())
         {
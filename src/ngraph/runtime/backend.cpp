@@ -14,10 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cstdlib>
 #include <dlfcn.h>
 #include <sstream>
+#include <thread>
 
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/call_queue.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/util.hpp"
 
@@ -38,6 +42,10 @@ unordered_map<string, shared_ptr<runtime::Backend>>& runtime::Backend::get_backe
     return backend_map;
 }
 
+runtime::Backend::Backend()
+{
+}
+
 runtime::Backend::~Backend()
 {
     for (auto& p : s_open_backends)
@@ -179,3 +187,59 @@ void runtime::Backend::validate_call(shared_ptr<const Function> function,
         }
     }
 }
+
+runtime::CallQueue& runtime::Backend::get_call_queue()
+{
+    lock_guard<mutex> lock(m_call_queue_mutex);
+    if (m_call_queue == nullptr)
+    {
+        size_t thread_count = max(1u, thread::hardware_concurrency());
+        if (const char* env = getenv("NGRAPH_ASYNC_CALL_THREADS"))
+        {
+            thread_count = max(1, atoi(env));
+        }
+        m_call_queue.reset(new CallQueue(thread_count));
+    }
+    return *m_call_queue;
+}
+
+future<bool> runtime::Backend::call_async(shared_ptr<Function> func,
+                                          const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                          const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    auto promise = make_shared<std::promise<bool>>();
+    call_async(func, outputs, inputs, [promise](bool result, exception_ptr error) {
+        if (error)
+        {
+            promise->set_exception(error);
+        }
+        else
+        {
+            promise->set_value(result);
+        }
+    });
+    return promise->get_future();
+}
+
+void runtime::Backend::call_async(shared_ptr<Function> func,
+                                  const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                  const vector<shared_ptr<runtime::TensorView>>& inputs,
+                                  const CallCallback& callback)
+{
+    // The last reference may be released by a worker, which destroys the backend and with it
+    // the queue; CallQueue allows that
+    shared_ptr<Backend> self = shared_from_this();
+    get_call_queue().enqueue([self, func, outputs, inputs, callback]() {
+        bool result = false;
+        exception_ptr error;
+        try
+        {
+            result = self->call(func, outputs, inputs);
+        }
+        catch (...)
+        {
+            error = current_exception();
+        }
+        callback(result, error);
+    });
+}
@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
@@ -27,15 +31,17 @@ namespace ngraph
 {
     namespace runtime
     {
+        class CallQueue;
         class ExternalFunction;
         class TensorView;
 
         /// @brief Interface to a generic backend.
         ///
         /// Backends are responsible for function execution and value allocation.
-        class Backend
+        class Backend : public std::enable_shared_from_this<Backend>
         {
         public:
+            Backend();
             virtual ~Backend();
             /// @brief Create a new Backend object
             /// @param type The name of a registered backend, such as "CPU" or "GPU".
@@ -69,6 +75,31 @@ namespace ngraph
                               const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                               const std::vector<std::shared_ptr<runtime::TensorView>>& inputs) = 0;
 
+            /// @brief Completion callback for call_async.
+            /// @param result The value returned by call.
+            /// @param error The exception thrown by call, or nullptr if the call succeeded.
+            using CallCallback = std::function<void(bool result, std::exception_ptr error)>;
+
+            /// @brief Queue a call to be executed on the backend's worker threads.
+            ///
+            /// The number of worker threads is taken from NGRAPH_ASYNC_CALL_THREADS and
+            /// defaults to the hardware concurrency. The tensors must stay untouched until the
+            /// call completes. Each queued call holds a reference to the backend, so the
+            /// backend outlives its pending calls.
+            /// @returns A future for the value returned by call. Exceptions thrown by the call
+            ///   are rethrown by future::get.
+            std::future<bool>
+                call_async(std::shared_ptr<Function> func,
+                           const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
+            /// @brief Queue a call to be executed on the backend's worker threads.
+            /// @param callback Invoked on the worker thread once the call has completed.
+            void call_async(std::shared_ptr<Function> func,
+                            const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                            const std::vector<std::shared_ptr<runtime::TensorView>>& inputs,
+                            const CallCallback& callback);
+
             virtual void remove_compiled_function(std::shared_ptr<Function> func);
 
             virtual void enable_performance_data(std::shared_ptr<Function> func, bool enable) {}
@@ -83,6 +114,11 @@ namespace ngraph
                                const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
 
         private:
+            CallQueue& get_call_queue();
+
+            std::unique_ptr<CallQueue> m_call_queue;
+            std::mutex m_call_queue_mutex;
+
             static void* open_shared_library(std::string type);
             static std::unordered_map<std::string, std::shared_ptr<Backend>>& get_backend_map();
             static std::unordered_map<std::string, void*> s_open_backends;
@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/call_queue.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::CallQueue::CallQueue(size_t thread_count)
+    : m_state(make_shared<State>())
+{
+    for (size_t i = 0; i < thread_count; i++)
+    {
+        m_threads.emplace_back(&CallQueue::worker, m_state);
+    }
+}
+
+runtime::CallQueue::~CallQueue()
+{
+    {
+        lock_guard<mutex> lock(m_state->mutex);
+        m_state->stopping = true;
+    }
+    m_state->task_available.notify_all();
+    for (auto& t : m_threads)
+    {
+        // A thread cannot join itself
+        if (t.get_id() == this_thread::get_id())
+        {
+            t.detach();
+        }
+        else
+        {
+            t.join();
+        }
+    }
+}
+
+void runtime::CallQueue::enqueue(const function<void()>& task)
+{
+    {
+        lock_guard<mutex> lock(m_state->mutex);
+        m_state->tasks.push(task);
+    }
+    m_state->task_available.notify_one();
+}
+
+void runtime::CallQueue::worker(shared_ptr<State> state)
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(state->mutex);
+            state->task_available.wait(
+                lock, [&state]() { return state->stopping || !state->tasks.empty(); });
+            if (state->tasks.empty())
+            {
+                return;
+            }
+            task = move(state->tasks.front());
+            state->tasks.pop();
+        }
+        task();
+    }
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// @brief A fixed set of worker threads executing queued tasks in FIFO order.
+        class CallQueue
+        {
+        public:
+            CallQueue(size_t thread_count);
+            /// @brief Completes all queued tasks and joins the worker threads.
+            ///
+            /// A task may destroy the queue that runs it. Its worker is then detached and
+            /// exits once the remaining tasks are done.
+            ~CallQueue();
+
+            void enqueue(const std::function<void()>& task);
+            size_t get_thread_count() const { return m_threads.size(); }
+        private:
+            // Shared with the workers, so a detached worker can outlive the queue
+            struct State
+            {
+                std::queue<std::function<void()>> tasks;
+                std::mutex mutex;
+                std::condition_variable task_available;
+                bool stopping = false;
+            };
+
+            static void worker(std::shared_ptr<State> state);
+
+            std::shared_ptr<State> m_state;
+            std::vector<std::thread> m_threads;
+        };
+    }
+}
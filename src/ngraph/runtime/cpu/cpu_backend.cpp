@@ -53,15 +53,48 @@ shared_ptr<runtime::TensorView> runtime::cpu::CPU_Backend::create_tensor(
 
 bool runtime::cpu::CPU_Backend::compile(shared_ptr<Function> func)
 {
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
+    get_call_frame(func);
+    return true;
+}
+
+shared_ptr<runtime::cpu::CPU_CallFrame>
+    runtime::cpu::CPU_Backend::get_call_frame(shared_ptr<Function> func)
+{
+    // The map lock is only held for lookups so that other functions can be compiled and
+    // called meanwhile. Compiling rewrites the function's graph, so compiles of the same
+    // function are serialized by its instance's compile mutex.
+    shared_ptr<mutex> compile_mutex;
     {
-        instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
-        instance.m_external_function->m_emit_timing = instance.m_performance_counters_enabled;
-        auto cf = instance.m_external_function->make_call_frame();
-        instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        lock_guard<mutex> lock(m_function_map_mutex);
+        FunctionInstance& instance = m_function_map[func];
+        if (instance.m_call_frame != nullptr)
+        {
+            return instance.m_call_frame;
+        }
+        compile_mutex = instance.m_compile_mutex;
     }
-    return true;
+
+    lock_guard<mutex> compile_lock(*compile_mutex);
+    bool emit_timing;
+    {
+        lock_guard<mutex> lock(m_function_map_mutex);
+        FunctionInstance& instance = m_function_map[func];
+        if (instance.m_call_frame != nullptr)
+        {
+            return instance.m_call_frame;
+        }
+        emit_timing = instance.m_performance_counters_enabled;
+    }
+
+    auto external_function = make_shared<CPU_ExternalFunction>(func);
+    external_function->m_emit_timing = emit_timing;
+    auto call_frame = dynamic_pointer_cast<CPU_CallFrame>(external_function->make_call_frame());
+
+    lock_guard<mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = m_function_map[func];
+    instance.m_external_function = external_function;
+    instance.m_call_frame = call_frame;
+    return call_frame;
 }
 
 bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
@@ -72,24 +105,30 @@ bool runtime::cpu::CPU_Backend::call(shared_ptr<Function> func,
 
     validate_call(func, outputs, inputs);
 
-    FunctionInstance& instance = m_function_map[func];
-    if (instance.m_external_function == nullptr)
-    {
-        rc = compile(func);
-    }
-
-    instance.m_call_frame->call(outputs, inputs);
+    get_call_frame(func)->call(outputs, inputs);
 
     return rc;
 }
 
+shared_ptr<runtime::cpu::CPU_Binding>
+    runtime::cpu::CPU_Backend::bind(shared_ptr<Function> func,
+                                    const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                    const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    validate_call(func, outputs, inputs);
+
+    return get_call_frame(func)->bind(outputs, inputs);
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     m_function_map.erase(func);
 }
 
 void runtime::cpu::CPU_Backend::enable_performance_data(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     if (instance.m_external_function != nullptr)
     {
@@ -102,6 +141,7 @@ vector<runtime::PerformanceCounter>
     runtime::cpu::CPU_Backend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
+    lock_guard<mutex> lock(m_function_map_mutex);
     auto it = m_function_map.find(func);
     if (it != m_function_map.end())
     {
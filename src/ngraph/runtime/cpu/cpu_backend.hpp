@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include "ngraph/runtime/backend.hpp"
 
@@ -27,6 +28,7 @@ namespace ngraph
     {
         namespace cpu
         {
+            class CPU_Binding;
             class CPU_ExternalFunction;
             class CPU_CallFrame;
 
@@ -51,6 +53,15 @@ namespace ngraph
                           const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs) override;
 
+                /// @brief Validate and resolve the tensors of a call once.
+                ///
+                /// The returned binding executes the function on the same tensors without
+                /// revalidating them, for repeated calls on fixed buffers.
+                std::shared_ptr<CPU_Binding>
+                    bind(std::shared_ptr<Function> func,
+                         const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                         const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
                 void remove_compiled_function(std::shared_ptr<Function> func) override;
                 void enable_performance_data(std::shared_ptr<Function> func, bool enable) override;
                 std::vector<PerformanceCounter>
@@ -63,9 +74,13 @@ namespace ngraph
                     std::shared_ptr<CPU_ExternalFunction> m_external_function;
                     std::shared_ptr<CPU_CallFrame> m_call_frame;
                     bool m_performance_counters_enabled = false;
+                    std::shared_ptr<std::mutex> m_compile_mutex = std::make_shared<std::mutex>();
                 };
 
+                std::shared_ptr<CPU_CallFrame> get_call_frame(std::shared_ptr<Function> func);
+
                 std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+                mutable std::mutex m_function_map_mutex;
             };
         }
     }
@@ -41,6 +41,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -69,6 +70,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -91,23 +93,89 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/kernel/abs.hpp"
+#include "ngraph/runtime/cpu/kernel/acos.hpp"
 #include "ngraph/runtime/cpu/kernel/add.hpp"
+#include "ngraph/runtime/cpu/kernel/asin.hpp"
+#include "ngraph/runtime/cpu/kernel/atan.hpp"
+#include "ngraph/runtime/cpu/kernel/broadcast.hpp"
 #include "ngraph/runtime/cpu/kernel/ceil.hpp"
+#include "ngraph/runtime/cpu/kernel/concat.hpp"
+#include "ngraph/runtime/cpu/kernel/cos.hpp"
+#include "ngraph/runtime/cpu/kernel/cosh.hpp"
+#include "ngraph/runtime/cpu/kernel/divide.hpp"
+#include "ngraph/runtime/cpu/kernel/equal.hpp"
+#include "ngraph/runtime/cpu/kernel/exp.hpp"
+#include "ngraph/runtime/cpu/kernel/floor.hpp"
+#include "ngraph/runtime/cpu/kernel/greater.hpp"
+#include "ngraph/runtime/cpu/kernel/greater_eq.hpp"
+#include "ngraph/runtime/cpu/kernel/less.hpp"
+#include "ngraph/runtime/cpu/kernel/less_eq.hpp"
+#include "ngraph/runtime/cpu/kernel/log.hpp"
+#include "ngraph/runtime/cpu/kernel/maximum.hpp"
+#include "ngraph/runtime/cpu/kernel/minimum.hpp"
 #include "ngraph/runtime/cpu/kernel/multiply.hpp"
+#include "ngraph/runtime/cpu/kernel/negative.hpp"
+#include "ngraph/runtime/cpu/kernel/not_equal.hpp"
+#include "ngraph/runtime/cpu/kernel/power.hpp"
 #include "ngraph/runtime/cpu/kernel/relu.hpp"
 #include "ngraph/runtime/cpu/kernel/result.hpp"
+#include "ngraph/runtime/cpu/kernel/sign.hpp"
+#include "ngraph/runtime/cpu/kernel/sin.hpp"
+#include "ngraph/runtime/cpu/kernel/sinh.hpp"
+#include "ngraph/runtime/cpu/kernel/slice.hpp"
+#include "ngraph/runtime/cpu/kernel/sqrt.hpp"
+#include "ngraph/runtime/cpu/kernel/subtract.hpp"
+#include "ngraph/runtime/cpu/kernel/tan.hpp"
+#include "ngraph/runtime/cpu/kernel/tanh.hpp"
+#include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/batch_dot.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_bias.hpp"
 #include "ngraph/runtime/cpu/op/conv_relu.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
+#include "ngraph/runtime/cpu/op/group_conv.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/reference/and.hpp"
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/batch_norm.hpp"
+#include "ngraph/runtime/reference/broadcast.hpp"
+#include "ngraph/runtime/reference/concat.hpp"
+#include "ngraph/runtime/reference/convert.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/dequantize.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/runtime/reference/min.hpp"
+#include "ngraph/runtime/reference/not.hpp"
+#include "ngraph/runtime/reference/one_hot.hpp"
+#include "ngraph/runtime/reference/or.hpp"
+#include "ngraph/runtime/reference/pad.hpp"
+#include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
+#include "ngraph/runtime/reference/relu.hpp"
+#include "ngraph/runtime/reference/replace_slice.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/reverse.hpp"
+#include "ngraph/runtime/reference/reverse_sequence.hpp"
+#include "ngraph/runtime/reference/select.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -168,47 +236,183 @@ using namespace ngraph;
 
 #define BUILD_UNARY_ELEMWISE_FUNCTOR(OP)                                                           \
     auto& functors = external_function->get_functors();                                            \
-    auto& tensor_data = external_function->get_tensor_data();                                      \
     std::function<void(void*, void*, size_t)> kernel;                                              \
                                                                                                    \
     SELECT_KERNEL(kernel, out[0].get_element_type(), OP);                                          \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
-    auto& arg0_tensor = tensor_data[args[0].get_name()];                                           \
-    auto& out0_tensor = tensor_data[out[0].get_name()];                                            \
+    auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
+    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());               \
                                                                                                    \
-    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {                            \
-        kernel(arg0_tensor, out0_tensor, element_count);                                           \
+    auto functor = [&, kernel, element_count, arg0_buffer_index, out0_buffer_index](               \
+        CPURuntimeContext* ctx) {                                                                  \
+        kernel(ctx->buffer_data[arg0_buffer_index],                                                \
+               ctx->buffer_data[out0_buffer_index],                                                \
+               element_count);                                                                     \
     };                                                                                             \
     functors.emplace_back(functor);
 
 #define BUILD_BINARY_ELEMWISE_FUNCTOR(OP)                                                          \
     auto& functors = external_function->get_functors();                                            \
-    auto& tensor_data = external_function->get_tensor_data();                                      \
     std::function<void(void*, void*, void*, size_t)> kernel;                                       \
                                                                                                    \
-    SELECT_KERNEL(kernel, out[0].get_element_type(), OP);                                          \
+    SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
-    auto& arg0_tensor = tensor_data[args[0].get_name()];                                           \
-    auto& arg1_tensor = tensor_data[args[1].get_name()];                                           \
-    auto& out0_tensor = tensor_data[out[0].get_name()];                                            \
+    auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
+    auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());              \
+    auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());               \
                                                                                                    \
-    auto functor = [&, kernel, element_count](CPURuntimeContext* ctx) {                            \
-        kernel(arg0_tensor, arg1_tensor, out0_tensor, element_count);                              \
-    };                                                                                             \
+    auto functor =                                                                                 \
+        [&, kernel, element_count, arg0_buffer_index, arg1_buffer_index, out0_buffer_index](       \
+            CPURuntimeContext* ctx) {                                                              \
+            kernel(ctx->buffer_data[arg0_buffer_index],                                            \
+                   ctx->buffer_data[arg1_buffer_index],                                            \
+                   ctx->buffer_data[out0_buffer_index],                                            \
+                   element_count);                                                                 \
+        };                                                                                         \
     functors.emplace_back(functor);
 
+// Dispatches to a builder templated on the element type ET
+#define BUILD_TYPED_FUNCTOR(ET, BUILDER)                                                           \
+    BuildOpFunction builder;                                                                       \
+                                                                                                   \
+    SELECT_KERNEL(builder, ET, BUILDER);                                                           \
+    if (!builder)                                                                                  \
+    {                                                                                              \
+        throw ngraph_error("Unsupported element type " + ET.c_type_string() + " for " +            \
+                           node->description());                                                   \
+    }                                                                                              \
+    builder(external_function, node, args, out);
+
+// Per-rank kernel macro for the Eigen kernels, which are instantiated for ranks 1 to 6. KV is
+// left empty for other ranks.
+#define SELECT_RANK(KV, ET, R, K)                                                                  \
+    if (R == 1)                                                                                    \
+    {                                                                                              \
+        KV = K<ET, 1>;                                                                             \
+    }                                                                                              \
+    else if (R == 2)                                                                               \
+    {                                                                                              \
+        KV = K<ET, 2>;                                                                             \
+    }                                                                                              \
+    else if (R == 3)                                                                               \
+    {                                                                                              \
+        KV = K<ET, 3>;                                                                             \
+    }                                                                                              \
+    else if (R == 4)                                                                               \
+    {                                                                                              \
+        KV = K<ET, 4>;                                                                             \
+    }                                                                                              \
+    else if (R == 5)                                                                               \
+    {                                                                                              \
+        KV = K<ET, 5>;                                                                             \
+    }                                                                                              \
+    else if (R == 6)                                                                               \
+    {                                                                                              \
+        KV = K<ET, 6>;                                                                             \
+    }
+
 namespace ngraph
 {
     namespace runtime
     {
         namespace cpu
         {
+            // Copies the argument to the output for ops that leave the data untouched
+            static void build_copy_functor(CPU_ExternalFunction* external_function,
+                                           const TensorViewWrapper& arg,
+                                           const TensorViewWrapper& out)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto size = out.get_size() * out.get_element_type().size();
+                auto arg_buffer_index = external_function->get_buffer_index(arg.get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out.get_name());
+
+                auto functor = [&, size, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    memcpy(ctx->buffer_data[out_buffer_index],
+                           ctx->buffer_data[arg_buffer_index],
+                           size);
+                };
+                functors.emplace_back(functor);
+            }
+
+            // Binds the given tensors, in order, to the memory dependencies of an MKLDNN
+            // primitive and invokes it
+            static void build_mkldnn_functor(CPU_ExternalFunction* external_function,
+                                             size_t primitive_index,
+                                             const vector<TensorViewWrapper>& tensors)
+            {
+                auto& functors = external_function->get_functors();
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto& deps = mkldnn_emitter->get_primitive_deps(primitive_index);
+
+                vector<pair<size_t, size_t>> bindings;
+                for (size_t i = 0; i < tensors.size(); i++)
+                {
+                    auto buffer_index = external_function->get_buffer_index(tensors[i].get_name());
+                    bindings.emplace_back(deps[i], buffer_index);
+                }
+
+                auto functor = [&, primitive_index, bindings](CPURuntimeContext* ctx) {
+                    for (const auto& binding : bindings)
+                    {
+                        mkldnn_utils::set_memory_ptr(
+                            ctx, binding.first, ctx->buffer_data[binding.second]);
+                    }
+                    mkldnn_utils::mkldnn_invoke_primitive(ctx, primitive_index);
+                };
+                functors.emplace_back(functor);
+            }
+
+            // For dilation, MKLDNN wants to know how many elements to insert between, not how far
+            // apart to space the elements like nGraph. So we have to subtract 1 from each pos.
+            static Strides mkldnn_dilation_strides(const Strides& window_dilation_strides)
+            {
+                Strides window_dilation_strides_adjusted;
+                for (size_t s : window_dilation_strides)
+                {
+                    window_dilation_strides_adjusted.push_back(s - 1);
+                }
+                return window_dilation_strides_adjusted;
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Add)
             {
-                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::add);
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    std::vector<float> scale_vector(2, 1);
+                    std::vector<mkldnn::memory::primitive_desc> inputs_pd;
+
+                    auto input0_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                    auto input1_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1);
+                    auto result_format =
+                        runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input0_data_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[0], input0_format);
+                    auto input1_data_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[1], input1_format);
+                    auto result_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[0], result_format);
+                    inputs_pd.push_back(mkldnn::memory::primitive_desc(
+                        input0_data_desc, runtime::cpu::mkldnn_utils::global_cpu_engine));
+                    inputs_pd.push_back(mkldnn::memory::primitive_desc(
+                        input1_data_desc, runtime::cpu::mkldnn_utils::global_cpu_engine));
+
+                    size_t add_index = mkldnn_emitter->build_elementwise_add(
+                        input0_data_desc, input1_data_desc, result_desc, scale_vector, inputs_pd);
+                    build_mkldnn_functor(external_function, add_index, {args[0], args[1], out[0]});
+                }
+                else
+                {
+                    BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::add);
+                }
             }
 
             template <>
@@ -232,7 +436,21 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Relu)
             {
-                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::relu);
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+                    auto result_desc = mkldnn_emitter->build_memory_descriptor(
+                        out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                    size_t relu_index = mkldnn_emitter->build_relu_forward(input_desc, result_desc);
+                    build_mkldnn_functor(external_function, relu_index, {args[0], out[0]});
+                }
+                else
+                {
+                    BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::relu);
+                }
             }
 
             template <>
@@ -245,11 +463,10 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::MatmulBias)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
-                auto& arg0_tensor = tensor_data[args[0].get_name()];
-                auto& arg1_tensor = tensor_data[args[1].get_name()];
-                auto& out0_tensor = tensor_data[out[0].get_name()];
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
                 const ngraph::op::MatmulBias* mm = static_cast<const ngraph::op::MatmulBias*>(node);
 
@@ -280,9 +497,19 @@ namespace ngraph
 
                 const float beta = 0.0f;
 
-                auto mm_functor =
-                    [&, transpose_A, transpose_B, m, n, k, lda, ldb, beta, arg2_shape](
-                        CPURuntimeContext* ctx) {
+                auto mm_functor = [&,
+                                   transpose_A,
+                                   transpose_B,
+                                   m,
+                                   n,
+                                   k,
+                                   lda,
+                                   ldb,
+                                   beta,
+                                   arg2_shape,
+                                   arg0_buffer_index,
+                                   arg1_buffer_index,
+                                   out0_buffer_index](CPURuntimeContext* ctx) {
                         cblas::cblas_sgemm(
                             cblas::Layout::RowMajor,
                             transpose_A ? cblas::Transpose::Transpose : cblas::Transpose::None,
@@ -291,12 +518,12 @@ namespace ngraph
                             n,
                             k,
                             1.0f,
-                            static_cast<float*>(arg0_tensor),
+                            static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
                             max(1UL, lda),
-                            static_cast<float*>(arg1_tensor),
+                            static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
                             max(1UL, ldb),
                             beta,
-                            static_cast<float*>(out0_tensor),
+                            static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
                             max(1UL, arg2_shape[1]));
                     };
 
@@ -304,7 +531,8 @@ namespace ngraph
 
                 if (args.size() > 2)
                 {
-                    auto& arg2_tensor = tensor_data[args[2].get_name()];
+                    auto arg2_buffer_index =
+                        external_function->get_buffer_index(args[2].get_name());
 
                     auto axes = mm->get_broadcast_axes();
                     if (axes.size() == 1)
@@ -312,7 +540,13 @@ namespace ngraph
                         if (*(axes.begin()) == 0)
                         {
                             vector<float> ones_row(arg2_shape[0], 1.0f);
-                            bias_functor = [&, ones_row, arg2_shape](CPURuntimeContext* ctx) {
+                            bias_functor = [&,
+                                            ones_row,
+                                            arg2_shape,
+                                            arg2_buffer_index,
+                                            out0_buffer_index](CPURuntimeContext* ctx) {
+                                auto arg2_tensor = ctx->buffer_data[arg2_buffer_index];
+                                auto out0_tensor = ctx->buffer_data[out0_buffer_index];
                                 cblas::cblas_sgemm(cblas::Layout::RowMajor,
                                                    cblas::Transpose::None,
                                                    cblas::Transpose::None,
@@ -332,7 +566,13 @@ namespace ngraph
                         else
                         {
                             vector<float> ones_col(arg2_shape[1], 1.0f);
-                            bias_functor = [&, ones_col, arg2_shape](CPURuntimeContext* ctx) {
+                            bias_functor = [&,
+                                            ones_col,
+                                            arg2_shape,
+                                            arg2_buffer_index,
+                                            out0_buffer_index](CPURuntimeContext* ctx) {
+                                auto arg2_tensor = ctx->buffer_data[arg2_buffer_index];
+                                auto out0_tensor = ctx->buffer_data[out0_buffer_index];
                                 cblas::cblas_sgemm(cblas::Layout::RowMajor,
                                                    cblas::Transpose::None,
                                                    cblas::Transpose::None,
@@ -359,7 +599,13 @@ namespace ngraph
 
                         vector<float> ones_scalar(arg2_shape[0], 1.0f);
 
-                        bias_functor = [&, ones_scalar, arg2_shape](CPURuntimeContext* ctx) {
+                        bias_functor = [&,
+                                        ones_scalar,
+                                        arg2_shape,
+                                        arg2_buffer_index,
+                                        out0_buffer_index](CPURuntimeContext* ctx) {
+                            auto arg2_tensor = ctx->buffer_data[arg2_buffer_index];
+                            auto out0_tensor = ctx->buffer_data[out0_buffer_index];
                             vector<float> bias(arg2_shape[1], *static_cast<float*>(arg2_tensor));
                             cblas::cblas_sgemm(cblas::Layout::RowMajor,
                                                cblas::Transpose::None,
@@ -390,39 +636,3806 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::Constant)
             {
                 auto& functors = external_function->get_functors();
-                auto& tensor_data = external_function->get_tensor_data();
 
-                vector<void**> dest;
+                vector<size_t> dest_indices;
                 for (auto& result : external_function->get_function()->get_results())
                 {
                     if (result.get() == node)
                     {
-                        dest.push_back(&tensor_data[result->get_output_tensor(0).get_name()]);
+                        dest_indices.push_back(external_function->get_buffer_index(
+                            result->get_output_tensor(0).get_name()));
                     }
                 }
-                auto& src = tensor_data[node->get_output_tensor(0).get_name()];
+                auto src_index =
+                    external_function->get_buffer_index(node->get_output_tensor(0).get_name());
                 auto size = node->get_output_tensor(0).size();
-                auto functor = [&, dest, src, size](CPURuntimeContext* ctx) {
-                    for (auto p : dest)
+                auto functor = [&, dest_indices, src_index, size](CPURuntimeContext* ctx) {
+                    for (auto p : dest_indices)
                     {
-                        memcpy(*p, src, size);
+                        memcpy(ctx->buffer_data[p], ctx->buffer_data[src_index], size);
                     }
                 };
                 functors.emplace_back(functor);
             }
 
-#define TI(x) type_index(typeid(x))
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Acos)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::acos);
+            }
 
-            const BuildOpMap build_dispatcher{
-                {TI(ngraph::op::Add), &runtime::cpu::Builder::build<ngraph::op::Add>},
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Asin)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::asin);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Atan)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::atan);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Cos)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::cos);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Cosh)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::cosh);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Exp)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::exp);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Floor)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::floor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Log)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::log);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Negative)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::negative);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sign)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sign);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sin)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sin);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sinh)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sinh);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sqrt)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::sqrt);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Tan)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::tan);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Tanh)
+            {
+                BUILD_UNARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::tanh);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Divide)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::divide);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Maximum)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::maximum);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Minimum)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::minimum);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Power)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::power);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Subtract)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::subtract);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Equal)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::equal);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::NotEqual)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::not_equal);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Greater)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::greater);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::GreaterEq)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::greater_eq);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Less)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::less);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::LessEq)
+            {
+                BUILD_BINARY_ELEMWISE_FUNCTOR(runtime::cpu::kernel::less_eq);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Not)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto element_count = out[0].get_size();
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&, element_count, arg0_buffer_index, out0_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    runtime::reference::logical_not(
+                        static_cast<char*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<char*>(ctx->buffer_data[out0_buffer_index]),
+                        element_count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::And)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto element_count = out[0].get_size();
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor =
+                    [&, element_count, arg0_buffer_index, arg1_buffer_index, out0_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        runtime::reference::logical_and(
+                            static_cast<char*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<char*>(ctx->buffer_data[arg1_buffer_index]),
+                            static_cast<char*>(ctx->buffer_data[out0_buffer_index]),
+                            element_count);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Or)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto element_count = out[0].get_size();
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor =
+                    [&, element_count, arg0_buffer_index, arg1_buffer_index, out0_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        runtime::reference::logical_or(
+                            static_cast<char*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<char*>(ctx->buffer_data[arg1_buffer_index]),
+                            static_cast<char*>(ctx->buffer_data[out0_buffer_index]),
+                            element_count);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            template <typename ElementType>
+            static void build_select(CPU_ExternalFunction* external_function,
+                                     const ngraph::Node* node,
+                                     const vector<TensorViewWrapper>& args,
+                                     const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto element_count = out[0].get_size();
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                element_count,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                arg2_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::select<ElementType>(
+                        static_cast<char*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[arg2_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        element_count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Select)
+            {
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_select);
+            }
+
+            template <typename InputElementType>
+            struct ConvertKernel
+            {
+                template <typename OutputElementType>
+                static void convert(void* arg, void* out, size_t count)
+                {
+                    runtime::reference::convert<InputElementType, OutputElementType>(
+                        static_cast<InputElementType*>(arg),
+                        static_cast<OutputElementType*>(out),
+                        count);
+                }
+            };
+
+            template <typename InputElementType>
+            static void build_convert(CPU_ExternalFunction* external_function,
+                                      const ngraph::Node* node,
+                                      const vector<TensorViewWrapper>& args,
+                                      const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                std::function<void(void*, void*, size_t)> kernel;
+
+                SELECT_KERNEL(kernel,
+                              out[0].get_element_type(),
+                              ConvertKernel<InputElementType>::template convert);
+                if (!kernel)
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       out[0].get_element_type().c_type_string() + " for " +
+                                       node->description());
+                }
+
+                auto element_count = out[0].get_size();
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&, kernel, element_count, arg0_buffer_index, out0_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[out0_buffer_index],
+                           element_count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Convert)
+            {
+                BUILD_TYPED_FUNCTOR(args[0].get_element_type(), build_convert);
+            }
+
+            template <typename InputElementType, typename OutputElementType>
+            static void build_quantize(CPU_ExternalFunction* external_function,
+                                       const ngraph::Node* node,
+                                       const vector<TensorViewWrapper>& args,
+                                       const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto quantize = static_cast<const ngraph::op::Quantize*>(node);
+
+                auto element_count = out[0].get_size();
+                auto scale = quantize->get_scale();
+                auto zero_point = quantize->get_zero_point();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor =
+                    [&, element_count, scale, zero_point, arg0_buffer_index, out0_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        runtime::reference::quantize(
+                            static_cast<InputElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<OutputElementType*>(ctx->buffer_data[out0_buffer_index]),
+                            element_count,
+                            scale,
+                            zero_point);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Quantize)
+            {
+                auto& input_type = args[0].get_element_type();
+                bool is_i8 = out[0].get_element_type() == element::i8;
+                BuildOpFunction builder;
+                if (input_type == element::f32)
+                {
+                    builder =
+                        is_i8 ? build_quantize<float, int8_t> : build_quantize<float, uint8_t>;
+                }
+                else if (input_type == element::f64)
+                {
+                    builder =
+                        is_i8 ? build_quantize<double, int8_t> : build_quantize<double, uint8_t>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " + input_type.c_type_string() +
+                                       " for " + node->description());
+                }
+                builder(external_function, node, args, out);
+            }
+
+            template <typename InputElementType, typename OutputElementType>
+            static void build_dequantize(CPU_ExternalFunction* external_function,
+                                         const ngraph::Node* node,
+                                         const vector<TensorViewWrapper>& args,
+                                         const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto dequantize = static_cast<const ngraph::op::Dequantize*>(node);
+
+                auto element_count = out[0].get_size();
+                auto scale = dequantize->get_scale();
+                auto zero_point = dequantize->get_zero_point();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor =
+                    [&, element_count, scale, zero_point, arg0_buffer_index, out0_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        runtime::reference::dequantize(
+                            static_cast<InputElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<OutputElementType*>(ctx->buffer_data[out0_buffer_index]),
+                            element_count,
+                            scale,
+                            zero_point);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Dequantize)
+            {
+                auto& output_type = out[0].get_element_type();
+                bool is_i8 = args[0].get_element_type() == element::i8;
+                BuildOpFunction builder;
+                if (output_type == element::f32)
+                {
+                    builder =
+                        is_i8 ? build_dequantize<int8_t, float> : build_dequantize<uint8_t, float>;
+                }
+                else if (output_type == element::f64)
+                {
+                    builder = is_i8 ? build_dequantize<int8_t, double>
+                                    : build_dequantize<uint8_t, double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " + output_type.c_type_string() +
+                                       " for " + node->description());
+                }
+                builder(external_function, node, args, out);
+            }
+
+            // Selects B<TA, TB, TO>::build for the i8 or u8 arguments and the real or quantized
+            // output of a quantized op
+            template <template <typename, typename, typename> class B, typename TA, typename TB>
+            static BuildOpFunction select_quantized_builder(const element::Type& output_type)
+            {
+                if (output_type == element::f32)
+                {
+                    return B<TA, TB, float>::build;
+                }
+                else if (output_type == element::f64)
+                {
+                    return B<TA, TB, double>::build;
+                }
+                else if (output_type == element::i8)
+                {
+                    return B<TA, TB, int8_t>::build;
+                }
+                else if (output_type == element::u8)
+                {
+                    return B<TA, TB, uint8_t>::build;
+                }
+                return nullptr;
+            }
+
+            template <template <typename, typename, typename> class B, typename TA>
+            static BuildOpFunction select_quantized_builder(const element::Type& arg1_type,
+                                                            const element::Type& output_type)
+            {
+                return arg1_type == element::i8
+                           ? select_quantized_builder<B, TA, int8_t>(output_type)
+                           : select_quantized_builder<B, TA, uint8_t>(output_type);
+            }
+
+            template <template <typename, typename, typename> class B>
+            static void build_quantized(CPU_ExternalFunction* external_function,
+                                        const ngraph::Node* node,
+                                        const vector<TensorViewWrapper>& args,
+                                        const vector<TensorViewWrapper>& out)
+            {
+                auto& arg1_type = args[1].get_element_type();
+                auto& output_type = out[0].get_element_type();
+                BuildOpFunction builder =
+                    args[0].get_element_type() == element::i8
+                        ? select_quantized_builder<B, int8_t>(arg1_type, output_type)
+                        : select_quantized_builder<B, uint8_t>(arg1_type, output_type);
+                if (!builder)
+                {
+                    throw ngraph_error("Unsupported element type " + output_type.c_type_string() +
+                                       " for " + node->description());
+                }
+                builder(external_function, node, args, out);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::GetOutputElement)
+            {
+                auto get_tuple_element = static_cast<const ngraph::op::GetOutputElement*>(node);
+                build_copy_functor(external_function, args[get_tuple_element->get_n()], out[0]);
+            }
+
+            template <typename ElementType>
+            static void build_broadcast(CPU_ExternalFunction* external_function,
+                                        const ngraph::Node* node,
+                                        const vector<TensorViewWrapper>& args,
+                                        const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto broadcast = static_cast<const ngraph::op::Broadcast*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto broadcast_axes = broadcast->get_broadcast_axes();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                std::function<void(void*, void*, const Shape&, const Shape&)> kernel;
+                SELECT_RANK(
+                    kernel, ElementType, result_shape.size(), runtime::cpu::kernel::broadcast);
+                if (kernel)
+                {
+                    // The kernel expects the argument shape padded to the rank of the result
+                    Shape padded_arg0_shape;
+                    for (size_t i = 0, j = 0; i < result_shape.size(); i++)
+                    {
+                        padded_arg0_shape.push_back(broadcast_axes.count(i) ? 1 : arg0_shape[j++]);
+                    }
+
+                    auto functor = [&,
+                                    kernel,
+                                    padded_arg0_shape,
+                                    result_shape,
+                                    arg0_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[out0_buffer_index],
+                               padded_arg0_shape,
+                               result_shape);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                auto functor = [&,
+                                arg0_shape,
+                                result_shape,
+                                broadcast_axes,
+                                arg0_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::broadcast<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        result_shape,
+                        broadcast_axes);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Broadcast)
+            {
+                auto broadcast = static_cast<const ngraph::op::Broadcast*>(node);
+                if (broadcast->get_broadcast_axes().empty())
+                {
+                    build_copy_functor(external_function, args[0], out[0]);
+                    return;
+                }
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_broadcast);
+            }
+
+            template <typename ElementType>
+            static void build_reshape(CPU_ExternalFunction* external_function,
+                                      const ngraph::Node* node,
+                                      const vector<TensorViewWrapper>& args,
+                                      const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto reshape = static_cast<const ngraph::op::Reshape*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto input_order = reshape->get_input_order();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg0_shape,
+                                result_shape,
+                                input_order,
+                                arg0_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::reshape<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        input_order,
+                        result_shape);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Reshape)
+            {
+                auto& functors = external_function->get_functors();
+                auto reshape = static_cast<const ngraph::op::Reshape*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto input_order = reshape->get_input_order();
+                bool same_layout = is_sorted(input_order.begin(), input_order.end());
+
+                // If there is no layout change or we are just going from 1^n to 1^m or a
+                // zero-size tensor, we can just copy.
+                if (same_layout || shape_size(result_shape) < 2)
+                {
+                    build_copy_functor(external_function, args[0], out[0]);
+                    return;
+                }
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                if (args[0].get_element_type() == element::f32 && arg0_shape.size() == 2)
+                {
+                    auto functor = [&, arg0_shape, arg0_buffer_index, out0_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        mkl::MKL_Somatcopy('R',
+                                           'T',
+                                           arg0_shape[0],
+                                           arg0_shape[1],
+                                           1.0f,
+                                           static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                                           arg0_shape[1],
+                                           static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                                           arg0_shape[0]);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else if (args[0].get_element_type() == element::f32 &&
+                         (arg0_shape.size() == 3 || arg0_shape.size() == 4) &&
+                         result_shape.size() == arg0_shape.size())
+                {
+                    auto kernel = (arg0_shape.size() == 3)
+                                      ? runtime::cpu::kernel::reshape_3d_3d_float32
+                                      : runtime::cpu::kernel::reshape_4d_4d_float32;
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    result_shape,
+                                    input_order,
+                                    arg0_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                               static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                               arg0_shape,
+                               input_order,
+                               result_shape);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_reshape);
+                }
+            }
+
+            template <typename ElementType>
+            static void build_concat(CPU_ExternalFunction* external_function,
+                                     const ngraph::Node* node,
+                                     const vector<TensorViewWrapper>& args,
+                                     const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto concat = static_cast<const ngraph::op::Concat*>(node);
+
+                auto axis = concat->get_concatenation_axis();
+                auto result_shape = out[0].get_shape();
+
+                vector<size_t> arg_buffer_indices;
+                vector<Shape> arg_shapes;
+                for (auto& arg : args)
+                {
+                    auto arg_buffer_index = external_function->get_buffer_index(arg.get_name());
+                    arg_buffer_indices.push_back(arg_buffer_index);
+                    arg_shapes.push_back(arg.get_shape());
+                }
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                std::function<void(
+                    const vector<void*>&, const vector<Shape>&, void*, const Shape&, size_t)>
+                    kernel;
+                SELECT_RANK(kernel, ElementType, result_shape.size(), runtime::cpu::kernel::concat);
+                if (kernel)
+                {
+                    auto functor = [&,
+                                    kernel,
+                                    axis,
+                                    result_shape,
+                                    arg_buffer_indices,
+                                    arg_shapes,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        vector<void*> arg_tensors;
+                        for (auto index : arg_buffer_indices)
+                        {
+                            arg_tensors.push_back(ctx->buffer_data[index]);
+                        }
+                        kernel(arg_tensors,
+                               arg_shapes,
+                               ctx->buffer_data[out0_buffer_index],
+                               result_shape,
+                               axis);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                auto functor = [&,
+                                axis,
+                                result_shape,
+                                arg_buffer_indices,
+                                arg_shapes,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    vector<const ElementType*> arg_tensors;
+                    for (auto index : arg_buffer_indices)
+                    {
+                        arg_tensors.push_back(static_cast<ElementType*>(ctx->buffer_data[index]));
+                    }
+                    runtime::reference::concat<ElementType>(
+                        arg_tensors,
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg_shapes,
+                        result_shape,
+                        axis);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Concat)
+            {
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    std::vector<mkldnn::memory::desc> inputs_data_desc;
+
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    for (size_t i = 0; i < args.size(); i++)
+                    {
+                        auto input_format =
+                            runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, i);
+                        inputs_data_desc.push_back(
+                            mkldnn_emitter->build_memory_descriptor(args[i], input_format));
+                    }
+
+                    auto result_format =
+                        runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+                    auto result_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[0], result_format);
+
+                    size_t concat_dim =
+                        (static_cast<const ngraph::op::Concat*>(node))->get_concatenation_axis();
+                    size_t concat_index =
+                        mkldnn_emitter->build_concat(inputs_data_desc, result_desc, concat_dim);
+
+                    vector<TensorViewWrapper> tensors(args);
+                    tensors.push_back(out[0]);
+                    build_mkldnn_functor(external_function, concat_index, tensors);
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_concat);
+                }
+            }
+
+            template <typename ElementType>
+            static void build_slice(CPU_ExternalFunction* external_function,
+                                    const ngraph::Node* node,
+                                    const vector<TensorViewWrapper>& args,
+                                    const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto slice = static_cast<const ngraph::op::Slice*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto lower_bounds = slice->get_lower_bounds();
+                auto upper_bounds = slice->get_upper_bounds();
+                auto strides = slice->get_strides();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                std::function<void(void*,
+                                   void*,
+                                   const Shape&,
+                                   const Shape&,
+                                   const Coordinate&,
+                                   const Coordinate&,
+                                   const Strides&)>
+                    kernel;
+                SELECT_RANK(kernel, ElementType, arg0_shape.size(), runtime::cpu::kernel::slice);
+                if (kernel)
+                {
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    result_shape,
+                                    lower_bounds,
+                                    upper_bounds,
+                                    strides,
+                                    arg0_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(ctx->buffer_data[arg0_buffer_index],
+                               ctx->buffer_data[out0_buffer_index],
+                               arg0_shape,
+                               result_shape,
+                               lower_bounds,
+                               upper_bounds,
+                               strides);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                auto functor = [&,
+                                arg0_shape,
+                                result_shape,
+                                lower_bounds,
+                                upper_bounds,
+                                strides,
+                                arg0_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::slice<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        lower_bounds,
+                        upper_bounds,
+                        strides,
+                        result_shape);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Slice)
+            {
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_slice);
+            }
+
+            template <typename ElementType>
+            static void build_replace_slice(CPU_ExternalFunction* external_function,
+                                            const ngraph::Node* node,
+                                            const vector<TensorViewWrapper>& args,
+                                            const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto replace_slice = static_cast<const ngraph::op::ReplaceSlice*>(node);
+
+                auto arg1_shape = args[1].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto lower_bounds = replace_slice->get_lower_bounds();
+                auto upper_bounds = replace_slice->get_upper_bounds();
+                auto strides = replace_slice->get_strides();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg1_shape,
+                                result_shape,
+                                lower_bounds,
+                                upper_bounds,
+                                strides,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::replace_slice<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg1_shape,
+                        lower_bounds,
+                        upper_bounds,
+                        strides,
+                        result_shape);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ReplaceSlice)
+            {
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_replace_slice);
+            }
+
+            template <typename ElementType>
+            static void build_pad(CPU_ExternalFunction* external_function,
+                                  const ngraph::Node* node,
+                                  const vector<TensorViewWrapper>& args,
+                                  const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto pad = static_cast<const ngraph::op::Pad*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto padding_below = pad->get_padding_below();
+                auto padding_above = pad->get_padding_above();
+                auto padding_interior = pad->get_padding_interior();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg0_shape,
+                                result_shape,
+                                padding_below,
+                                padding_above,
+                                padding_interior,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::pad<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        result_shape,
+                        padding_below,
+                        padding_above,
+                        padding_interior);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Pad)
+            {
+                auto pad = static_cast<const ngraph::op::Pad*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+
+                if (arg0_shape.size() == 4 && args[0].get_element_type() == element::f32 &&
+                    pad->get_padding_interior() == Shape(arg0_shape.size()))
+                {
+                    auto& functors = external_function->get_functors();
+
+                    auto padding_below = pad->get_padding_below();
+                    auto padding_above = pad->get_padding_above();
+
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out0_buffer_index =
+                        external_function->get_buffer_index(out[0].get_name());
+
+                    auto functor = [&,
+                                    arg0_shape,
+                                    result_shape,
+                                    padding_below,
+                                    padding_above,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        runtime::cpu::kernel::pad_4d_float32(
+                            static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                            *static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                            arg0_shape,
+                            result_shape,
+                            padding_below,
+                            padding_above);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_pad);
+                }
+            }
+
+            template <typename ElementType>
+            static void build_reverse(CPU_ExternalFunction* external_function,
+                                      const ngraph::Node* node,
+                                      const vector<TensorViewWrapper>& args,
+                                      const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto reverse = static_cast<const ngraph::op::Reverse*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto reversed_axes = reverse->get_reversed_axes();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg0_shape,
+                                result_shape,
+                                reversed_axes,
+                                arg0_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::reverse<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        result_shape,
+                        reversed_axes);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Reverse)
+            {
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_reverse);
+            }
+
+            template <typename ElementType, typename SequenceLengthType>
+            static void build_reverse_sequence_kernel(CPU_ExternalFunction* external_function,
+                                                      const ngraph::Node* node,
+                                                      const vector<TensorViewWrapper>& args,
+                                                      const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto rs = static_cast<const ngraph::op::ReverseSequence*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto batch_axis = rs->get_batch_axis();
+                auto sequence_axis = rs->get_sequence_axis();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg0_shape,
+                                batch_axis,
+                                sequence_axis,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::reverse_sequence<ElementType, SequenceLengthType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        batch_axis,
+                        sequence_axis,
+                        static_cast<SequenceLengthType*>(ctx->buffer_data[arg1_buffer_index]));
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename ElementType>
+            static void build_reverse_sequence(CPU_ExternalFunction* external_function,
+                                               const ngraph::Node* node,
+                                               const vector<TensorViewWrapper>& args,
+                                               const vector<TensorViewWrapper>& out)
+            {
+                if (args[1].get_element_type() == element::i32)
+                {
+                    build_reverse_sequence_kernel<ElementType, int32_t>(
+                        external_function, node, args, out);
+                }
+                else if (args[1].get_element_type() == element::i64)
+                {
+                    build_reverse_sequence_kernel<ElementType, int64_t>(
+                        external_function, node, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported sequence length type " +
+                                       args[1].get_element_type().c_type_string() + " for " +
+                                       node->description());
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ReverseSequence)
+            {
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_reverse_sequence);
+            }
+
+            template <typename ElementType>
+            static void build_one_hot(CPU_ExternalFunction* external_function,
+                                      const ngraph::Node* node,
+                                      const vector<TensorViewWrapper>& args,
+                                      const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto oh = static_cast<const ngraph::op::OneHot*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto one_hot_axis = oh->get_one_hot_axis();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg0_shape,
+                                result_shape,
+                                one_hot_axis,
+                                arg0_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::one_hot<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        result_shape,
+                        one_hot_axis);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::OneHot)
+            {
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_one_hot);
+            }
+
+            template <typename ElementType>
+            static void build_reduction_functor(
+                CPU_ExternalFunction* external_function,
+                const TensorViewWrapper& arg,
+                const TensorViewWrapper& out,
+                const AxisSet& reduction_axes,
+                void (*kernel)(
+                    const ElementType*, ElementType*, const Shape&, const Shape&, const AxisSet&))
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg_shape = arg.get_shape();
+                auto result_shape = out.get_shape();
+
+                auto arg_buffer_index = external_function->get_buffer_index(arg.get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out.get_name());
+
+                auto functor = [&,
+                                kernel,
+                                arg_shape,
+                                result_shape,
+                                reduction_axes,
+                                arg_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    kernel(static_cast<ElementType*>(ctx->buffer_data[arg_buffer_index]),
+                           static_cast<ElementType*>(ctx->buffer_data[out_buffer_index]),
+                           arg_shape,
+                           result_shape,
+                           reduction_axes);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename ElementType>
+            static void build_sum(CPU_ExternalFunction* external_function,
+                                  const ngraph::Node* node,
+                                  const vector<TensorViewWrapper>& args,
+                                  const vector<TensorViewWrapper>& out)
+            {
+                auto sum = static_cast<const ngraph::op::Sum*>(node);
+                build_reduction_functor<ElementType>(external_function,
+                                                     args[0],
+                                                     out[0],
+                                                     sum->get_reduction_axes(),
+                                                     runtime::reference::sum<ElementType>);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sum)
+            {
+                auto& functors = external_function->get_functors();
+                auto sum = static_cast<const ngraph::op::Sum*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto reduction_axes = sum->get_reduction_axes();
+                auto arg0_rank = arg0_shape.size();
+                auto reduction_rank = reduction_axes.size();
+
+                if (reduction_axes.empty())
+                {
+                    build_copy_functor(external_function, args[0], out[0]);
+                    return;
+                }
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                if (args[0].get_element_type() == element::f32 &&
+                    ((arg0_rank == 1 && reduction_rank == 1) ||
+                     (arg0_rank == 2 && reduction_rank == 2) ||
+                     (arg0_rank == 4 && reduction_rank == 4)))
+                {
+                    auto kernel = runtime::cpu::kernel::reduce_sum_all_1d_float32;
+                    if (arg0_rank == 2)
+                    {
+                        kernel = runtime::cpu::kernel::reduce_sum_all_2d_float32;
+                    }
+                    else if (arg0_rank == 4)
+                    {
+                        kernel = runtime::cpu::kernel::reduce_sum_all_4d_float32;
+                    }
+
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    result_shape,
+                                    arg0_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                               static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                               arg0_shape,
+                               result_shape);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else if (args[0].get_element_type() == element::f32 &&
+                         ((arg0_rank == 2 && reduction_rank == 1) ||
+                          (arg0_rank == 4 && reduction_rank == 2)))
+                {
+                    auto kernel = (arg0_rank == 2)
+                                      ? runtime::cpu::kernel::reduce_sum_2d_1rd_float32
+                                      : runtime::cpu::kernel::reduce_sum_4d_2rd_float32;
+
+                    auto functor = [&,
+                                    kernel,
+                                    arg0_shape,
+                                    result_shape,
+                                    reduction_axes,
+                                    arg0_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        kernel(static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                               static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                               arg0_shape,
+                               result_shape,
+                               reduction_axes);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_sum);
+                }
+            }
+
+            template <typename ElementType>
+            static void build_product(CPU_ExternalFunction* external_function,
+                                      const ngraph::Node* node,
+                                      const vector<TensorViewWrapper>& args,
+                                      const vector<TensorViewWrapper>& out)
+            {
+                auto product = static_cast<const ngraph::op::Product*>(node);
+                build_reduction_functor<ElementType>(external_function,
+                                                     args[0],
+                                                     out[0],
+                                                     product->get_reduction_axes(),
+                                                     runtime::reference::product<ElementType>);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Product)
+            {
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_product);
+            }
+
+            template <typename ElementType>
+            static void build_max(CPU_ExternalFunction* external_function,
+                                  const ngraph::Node* node,
+                                  const vector<TensorViewWrapper>& args,
+                                  const vector<TensorViewWrapper>& out)
+            {
+                auto max = static_cast<const ngraph::op::Max*>(node);
+                build_reduction_functor<ElementType>(external_function,
+                                                     args[0],
+                                                     out[0],
+                                                     max->get_reduction_axes(),
+                                                     runtime::reference::max<ElementType>);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Max)
+            {
+                auto max = static_cast<const ngraph::op::Max*>(node);
+
+                if (args[0].get_element_type() == element::f32 && args[0].get_shape().size() == 2 &&
+                    max->get_reduction_axes().size() == 1)
+                {
+                    auto& functors = external_function->get_functors();
+
+                    auto arg0_shape = args[0].get_shape();
+                    auto result_shape = out[0].get_shape();
+                    auto reduction_axes = max->get_reduction_axes();
+
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto out0_buffer_index =
+                        external_function->get_buffer_index(out[0].get_name());
+
+                    auto functor = [&,
+                                    arg0_shape,
+                                    result_shape,
+                                    reduction_axes,
+                                    arg0_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        runtime::cpu::kernel::reduce_max_2d_1rd_float32(
+                            static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                            arg0_shape,
+                            result_shape,
+                            reduction_axes);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_max);
+                }
+            }
+
+            template <typename ElementType>
+            static void build_min(CPU_ExternalFunction* external_function,
+                                  const ngraph::Node* node,
+                                  const vector<TensorViewWrapper>& args,
+                                  const vector<TensorViewWrapper>& out)
+            {
+                auto min = static_cast<const ngraph::op::Min*>(node);
+                build_reduction_functor<ElementType>(external_function,
+                                                     args[0],
+                                                     out[0],
+                                                     min->get_reduction_axes(),
+                                                     runtime::reference::min<ElementType>);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Min)
+            {
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_min);
+            }
+
+            template <typename ElementType>
+            static void build_softmax(CPU_ExternalFunction* external_function,
+                                      const ngraph::Node* node,
+                                      const vector<TensorViewWrapper>& args,
+                                      const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto softmax = static_cast<const ngraph::op::Softmax*>(node);
+
+                auto result_shape = out[0].get_shape();
+                auto axes = softmax->get_axes();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                // Softmax over the innermost axes, as in classifiers and attention, runs as a
+                // fused per-row kernel.
+                size_t row_size =
+                    runtime::reference::softmax_innermost_row_size(result_shape, axes);
+                if (row_size != 0)
+                {
+                    size_t rows = shape_size(result_shape) / row_size;
+                    auto functor = [&, rows, row_size, arg0_buffer_index, out0_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        runtime::reference::softmax_innermost<ElementType>(
+                            static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                            rows,
+                            row_size);
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                auto functor = [&, result_shape, axes, arg0_buffer_index, out0_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    runtime::reference::softmax<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        result_shape,
+                        axes);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Softmax)
+            {
+                BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_softmax);
+            }
+
+            template <typename ElementType>
+            static void build_dot(CPU_ExternalFunction* external_function,
+                                  const ngraph::Node* node,
+                                  const vector<TensorViewWrapper>& args,
+                                  const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto dot = static_cast<const ngraph::op::Dot*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto arg1_shape = args[1].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto reduction_axes_count = dot->get_reduction_axes_count();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg0_shape,
+                                arg1_shape,
+                                result_shape,
+                                reduction_axes_count,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::dot<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        arg1_shape,
+                        result_shape,
+                        reduction_axes_count);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Dot)
+            {
+                auto dot = static_cast<const ngraph::op::Dot*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto arg1_shape = args[1].get_shape();
+
+                if (arg0_shape.size() == 2 && arg1_shape.size() == 2 &&
+                    dot->get_reduction_axes_count() == 1 &&
+                    args[0].get_element_type() == element::f32)
+                {
+                    auto& functors = external_function->get_functors();
+
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out0_buffer_index =
+                        external_function->get_buffer_index(out[0].get_name());
+
+                    auto functor = [&,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        cblas::cblas_sgemm(cblas::Layout::RowMajor,
+                                           cblas::Transpose::None,
+                                           cblas::Transpose::None,
+                                           arg0_shape[0],
+                                           arg1_shape[1],
+                                           arg0_shape[1],
+                                           1.0f,
+                                           static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                                           max(1UL, arg0_shape[1]),
+                                           static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                                           max(1UL, arg1_shape[1]),
+                                           0.0f,
+                                           static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                                           max(1UL, arg1_shape[1]));
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_dot);
+                }
+            }
+
+            template <typename Arg0ElementType,
+                      typename Arg1ElementType,
+                      typename OutputElementType>
+            struct QuantizedDotBuilder
+            {
+                static void build(CPU_ExternalFunction* external_function,
+                                  const ngraph::Node* node,
+                                  const vector<TensorViewWrapper>& args,
+                                  const vector<TensorViewWrapper>& out)
+                {
+                    auto& functors = external_function->get_functors();
+                    auto qdot = static_cast<const ngraph::op::QuantizedDot*>(node);
+
+                    auto arg0_shape = args[0].get_shape();
+                    auto arg1_shape = args[1].get_shape();
+                    auto result_shape = out[0].get_shape();
+                    auto reduction_axes_count = qdot->get_reduction_axes_count();
+                    auto arg0_scale = qdot->get_arg0_scale();
+                    auto arg0_zero_point = qdot->get_arg0_zero_point();
+                    auto arg1_scale = qdot->get_arg1_scale();
+                    auto arg1_zero_point = qdot->get_arg1_zero_point();
+                    auto output_scale = qdot->get_output_scale();
+                    auto output_zero_point = qdot->get_output_zero_point();
+
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out0_buffer_index =
+                        external_function->get_buffer_index(out[0].get_name());
+
+                    auto functor = [&,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    result_shape,
+                                    reduction_axes_count,
+                                    arg0_scale,
+                                    arg0_zero_point,
+                                    arg1_scale,
+                                    arg1_zero_point,
+                                    output_scale,
+                                    output_zero_point,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        runtime::reference::quantized_dot(
+                            static_cast<Arg0ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<Arg1ElementType*>(ctx->buffer_data[arg1_buffer_index]),
+                            static_cast<OutputElementType*>(ctx->buffer_data[out0_buffer_index]),
+                            arg0_shape,
+                            arg1_shape,
+                            result_shape,
+                            reduction_axes_count,
+                            arg0_scale,
+                            arg0_zero_point,
+                            arg1_scale,
+                            arg1_zero_point,
+                            output_scale,
+                            output_zero_point);
+                    };
+                    functors.emplace_back(functor);
+                }
+            };
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedDot)
+            {
+                build_quantized<QuantizedDotBuilder>(external_function, node, args, out);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchDot)
+            {
+                auto& functors = external_function->get_functors();
+                auto batch_dot = static_cast<const ngraph::op::BatchDot*>(node);
+
+                if (out[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("BatchDot is only supported for f32");
+                }
+
+                const Shape& shape_a = args[0].get_shape();
+                const Shape& shape_b = args[1].get_shape();
+
+                int64_t m = shape_a[1];
+                int64_t k = shape_a[2];
+                int64_t n = shape_b[2];
+                int64_t lda = std::max(1L, k);
+                int64_t ldb = std::max(1L, n);
+                auto transpose_a = cblas::Transpose::None;
+                auto transpose_b = cblas::Transpose::None;
+                if (batch_dot->get_is_a_transposed())
+                {
+                    transpose_a = cblas::Transpose::Transpose;
+                    m = shape_a[2];
+                    k = shape_a[1];
+                    lda = std::max(1L, m);
+                }
+                if (batch_dot->get_is_b_transposed())
+                {
+                    transpose_b = cblas::Transpose::Transpose;
+                    n = shape_b[1];
+                    ldb = std::max(1L, k);
+                }
+                int64_t ldc = std::max(1L, n);
+                const size_t offset_a = m * k;
+                const size_t offset_b = k * n;
+                const size_t offset_c = m * n;
+                int64_t group_size = shape_a[0];
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                transpose_a,
+                                transpose_b,
+                                m,
+                                n,
+                                k,
+                                lda,
+                                ldb,
+                                ldc,
+                                offset_a,
+                                offset_b,
+                                offset_c,
+                                group_size,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    auto mat_a = static_cast<float*>(ctx->buffer_data[arg0_buffer_index]);
+                    auto mat_b = static_cast<float*>(ctx->buffer_data[arg1_buffer_index]);
+                    auto mat_c = static_cast<float*>(ctx->buffer_data[out0_buffer_index]);
+
+                    std::vector<const float*> a(group_size);
+                    std::vector<const float*> b(group_size);
+                    std::vector<float*> c(group_size);
+                    for (int64_t i = 0; i < group_size; i++)
+                    {
+                        a[i] = mat_a + i * offset_a;
+                        b[i] = mat_b + i * offset_b;
+                        c[i] = mat_c + i * offset_c;
+                    }
+
+                    float alpha = 1.0f;
+                    float beta = 0.0f;
+                    cblas::cblas_sgemm_batch(cblas::Layout::RowMajor,
+                                             &transpose_a,
+                                             &transpose_b,
+                                             &m,
+                                             &n,
+                                             &k,
+                                             &alpha,
+                                             a.data(),
+                                             &lda,
+                                             b.data(),
+                                             &ldb,
+                                             &beta,
+                                             c.data(),
+                                             &ldc,
+                                             1,
+                                             &group_size);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename ElementType>
+            static void build_convolution(CPU_ExternalFunction* external_function,
+                                          const ngraph::Node* node,
+                                          const vector<TensorViewWrapper>& args,
+                                          const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto convolution = static_cast<const ngraph::op::Convolution*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto arg1_shape = args[1].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto window_movement_strides = convolution->get_window_movement_strides();
+                auto window_dilation_strides = convolution->get_window_dilation_strides();
+                auto padding_below = convolution->get_padding_below();
+                auto padding_above = convolution->get_padding_above();
+                auto data_dilation_strides = convolution->get_data_dilation_strides();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg0_shape,
+                                arg1_shape,
+                                result_shape,
+                                window_movement_strides,
+                                window_dilation_strides,
+                                padding_below,
+                                padding_above,
+                                data_dilation_strides,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::convolution<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        arg1_shape,
+                        result_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        padding_above,
+                        data_dilation_strides,
+                        0,
+                        1,
+                        1,
+                        0,
+                        0,
+                        1,
+                        false);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Convolution)
+            {
+                auto convolution = static_cast<const ngraph::op::Convolution*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto input_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                    auto weights_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1);
+                    // HACK to help MKLDNN pick the right implementation
+                    if (weights_format == mkldnn::memory::format::nchw)
+                    {
+                        weights_format = mkldnn::memory::format::oihw;
+                    }
+                    auto output_format =
+                        runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_data_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[0], input_format);
+                    auto weights_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[1], weights_format);
+                    auto result_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+
+                    size_t conv_index = mkldnn_emitter->build_convolution_forward(
+                        input_data_desc,
+                        weights_desc,
+                        result_desc,
+                        convolution->get_window_movement_strides(),
+                        mkldnn_dilation_strides(convolution->get_window_dilation_strides()),
+                        convolution->get_padding_below(),
+                        convolution->get_padding_above());
+                    build_mkldnn_functor(external_function, conv_index, {args[0], args[1], out[0]});
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_convolution);
+                }
+            }
+
+            template <typename ElementType>
+            static void build_convolution_backprop_filters(CPU_ExternalFunction* external_function,
+                                                           const ngraph::Node* node,
+                                                           const vector<TensorViewWrapper>& args,
+                                                           const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto convolution = static_cast<const ngraph::op::ConvolutionBackpropFilters*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto arg1_shape = args[1].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto window_movement_strides = convolution->get_window_movement_strides_backward();
+                auto window_dilation_strides = convolution->get_window_dilation_strides_backward();
+                auto padding_below = convolution->get_padding_below_backward();
+                auto padding_above = convolution->get_padding_above_backward();
+                auto data_dilation_strides = convolution->get_data_dilation_strides_backward();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg0_shape,
+                                arg1_shape,
+                                result_shape,
+                                window_movement_strides,
+                                window_dilation_strides,
+                                padding_below,
+                                padding_above,
+                                data_dilation_strides,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::convolution<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg0_shape,
+                        arg1_shape,
+                        result_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        padding_above,
+                        data_dilation_strides,
+                        1,
+                        0,
+                        0,
+                        1,
+                        1,
+                        0,
+                        false);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename DataElementType,
+                      typename FilterElementType,
+                      typename OutputElementType>
+            struct QuantizedConvolutionBuilder
+            {
+                static void build(CPU_ExternalFunction* external_function,
+                                  const ngraph::Node* node,
+                                  const vector<TensorViewWrapper>& args,
+                                  const vector<TensorViewWrapper>& out)
+                {
+                    auto& functors = external_function->get_functors();
+                    auto qconv = static_cast<const ngraph::op::QuantizedConvolution*>(node);
+
+                    auto arg0_shape = args[0].get_shape();
+                    auto arg1_shape = args[1].get_shape();
+                    auto result_shape = out[0].get_shape();
+                    auto window_movement_strides = qconv->get_window_movement_strides();
+                    auto window_dilation_strides = qconv->get_window_dilation_strides();
+                    auto padding_below = qconv->get_padding_below();
+                    auto padding_above = qconv->get_padding_above();
+                    auto data_dilation_strides = qconv->get_data_dilation_strides();
+                    auto data_scale = qconv->get_data_scale();
+                    auto data_zero_point = qconv->get_data_zero_point();
+                    auto filter_scale = qconv->get_filter_scale();
+                    auto output_scale = qconv->get_output_scale();
+                    auto output_zero_point = qconv->get_output_zero_point();
+
+                    auto arg0_buffer_index =
+                        external_function->get_buffer_index(args[0].get_name());
+                    auto arg1_buffer_index =
+                        external_function->get_buffer_index(args[1].get_name());
+                    auto out0_buffer_index =
+                        external_function->get_buffer_index(out[0].get_name());
+
+                    auto functor = [&,
+                                    arg0_shape,
+                                    arg1_shape,
+                                    result_shape,
+                                    window_movement_strides,
+                                    window_dilation_strides,
+                                    padding_below,
+                                    padding_above,
+                                    data_dilation_strides,
+                                    data_scale,
+                                    data_zero_point,
+                                    filter_scale,
+                                    output_scale,
+                                    output_zero_point,
+                                    arg0_buffer_index,
+                                    arg1_buffer_index,
+                                    out0_buffer_index](CPURuntimeContext* ctx) {
+                        runtime::reference::quantized_convolution(
+                            static_cast<DataElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                            static_cast<FilterElementType*>(ctx->buffer_data[arg1_buffer_index]),
+                            static_cast<OutputElementType*>(ctx->buffer_data[out0_buffer_index]),
+                            arg0_shape,
+                            arg1_shape,
+                            result_shape,
+                            window_movement_strides,
+                            window_dilation_strides,
+                            padding_below,
+                            padding_above,
+                            data_dilation_strides,
+                            data_scale,
+                            data_zero_point,
+                            filter_scale,
+                            output_scale,
+                            output_zero_point);
+                    };
+                    functors.emplace_back(functor);
+                }
+            };
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::QuantizedConvolution)
+            {
+                build_quantized<QuantizedConvolutionBuilder>(external_function, node, args, out);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ConvolutionBackpropFilters)
+            {
+                auto convolution = static_cast<const ngraph::op::ConvolutionBackpropFilters*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+                    auto delta_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[1], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1));
+                    auto result_desc = mkldnn_emitter->build_memory_descriptor(
+                        out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                    size_t conv_index = mkldnn_emitter->build_convolution_backward_weights(
+                        input_desc,
+                        delta_desc,
+                        result_desc,
+                        convolution->get_window_movement_strides_forward(),
+                        mkldnn_dilation_strides(
+                            convolution->get_window_dilation_strides_forward()),
+                        convolution->get_padding_below_forward(),
+                        convolution->get_padding_above_forward());
+                    build_mkldnn_functor(external_function, conv_index, {args[0], args[1], out[0]});
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(),
+                                        build_convolution_backprop_filters);
+                }
+            }
+
+            template <typename ElementType>
+            static void build_convolution_backprop_data(CPU_ExternalFunction* external_function,
+                                                        const ngraph::Node* node,
+                                                        const vector<TensorViewWrapper>& args,
+                                                        const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto convolution = static_cast<const ngraph::op::ConvolutionBackpropData*>(node);
+
+                auto arg0_shape = args[0].get_shape();
+                auto arg1_shape = args[1].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto window_movement_strides = convolution->get_window_movement_strides_backward();
+                auto window_dilation_strides = convolution->get_window_dilation_strides_backward();
+                auto padding_below = convolution->get_padding_below_backward();
+                auto padding_above = convolution->get_padding_above_backward();
+                auto data_dilation_strides = convolution->get_data_dilation_strides_backward();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                // Note that args[1] and args[0] are switched here from the usual order.
+                auto functor = [&,
+                                arg0_shape,
+                                arg1_shape,
+                                result_shape,
+                                window_movement_strides,
+                                window_dilation_strides,
+                                padding_below,
+                                padding_above,
+                                data_dilation_strides,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::convolution<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg1_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[arg0_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out0_buffer_index]),
+                        arg1_shape,
+                        arg0_shape,
+                        result_shape,
+                        window_movement_strides,
+                        window_dilation_strides,
+                        padding_below,
+                        padding_above,
+                        data_dilation_strides,
+                        0,
+                        1,
+                        0,
+                        1,
+                        0,
+                        1,
+                        true);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ConvolutionBackpropData)
+            {
+                auto convolution = static_cast<const ngraph::op::ConvolutionBackpropData*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    // HACK to help MKLDNN pick the right implementation
+                    auto weights_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                    if (weights_format == mkldnn::memory::format::nchw)
+                    {
+                        weights_format = mkldnn::memory::format::oihw;
+                    }
+                    auto weights_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[0], weights_format);
+                    auto delta_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[1], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1));
+                    auto result_desc = mkldnn_emitter->build_memory_descriptor(
+                        out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                    size_t conv_index = mkldnn_emitter->build_convolution_backward_data(
+                        weights_desc,
+                        delta_desc,
+                        result_desc,
+                        convolution->get_window_movement_strides_forward(),
+                        mkldnn_dilation_strides(
+                            convolution->get_window_dilation_strides_forward()),
+                        convolution->get_padding_below_forward(),
+                        convolution->get_padding_above_forward());
+                    build_mkldnn_functor(external_function, conv_index, {args[0], args[1], out[0]});
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_convolution_backprop_data);
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ConvolutionRelu)
+            {
+                auto convolution = static_cast<const ngraph::op::ConvolutionRelu*>(node);
+
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error("ConvolutionRelu is only supported with MKLDNN kernel.");
+                }
+
+                auto input_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                auto weights_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1);
+                // HACK to help MKLDNN pick the right implementation
+                if (weights_format == mkldnn::memory::format::nchw)
+                {
+                    weights_format = mkldnn::memory::format::oihw;
+                }
+                auto output_format = runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto input_data_desc =
+                    mkldnn_emitter->build_memory_descriptor(args[0], input_format);
+                auto weights_desc =
+                    mkldnn_emitter->build_memory_descriptor(args[1], weights_format);
+                auto result_desc = mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+
+                const float ops_scale = 1.f;
+                const float ops_alpha = -0.f; // relu negative slope
+                const float ops_beta = 0.f;
+
+                mkldnn::post_ops ops;
+                ops.append_eltwise(ops_scale, mkldnn::algorithm::eltwise_relu, ops_alpha, ops_beta);
+
+                size_t conv_index = mkldnn_emitter->build_convolution_forward(
+                    input_data_desc,
+                    weights_desc,
+                    result_desc,
+                    convolution->get_window_movement_strides(),
+                    mkldnn_dilation_strides(convolution->get_window_dilation_strides()),
+                    convolution->get_padding_below(),
+                    convolution->get_padding_above(),
+                    ops);
+                build_mkldnn_functor(external_function, conv_index, {args[0], args[1], out[0]});
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ConvolutionBias)
+            {
+                auto convolution = static_cast<const ngraph::op::ConvolutionBias*>(node);
+
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error("ConvolutionBias is only supported with MKLDNN kernel.");
+                }
+
+                auto data_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                auto weights_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1);
+                auto bias_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 2);
+                // HACK to help MKLDNN pick the right implementation
+                if (weights_format == mkldnn::memory::format::nchw)
+                {
+                    weights_format = mkldnn::memory::format::oihw;
+                }
+                auto result_format = runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto data_desc = mkldnn_emitter->build_memory_descriptor(args[0], data_format);
+                auto weights_desc =
+                    mkldnn_emitter->build_memory_descriptor(args[1], weights_format);
+                auto bias_desc = mkldnn_emitter->build_memory_descriptor(args[2], bias_format);
+                auto result_desc = mkldnn_emitter->build_memory_descriptor(out[0], result_format);
+
+                size_t conv_index = mkldnn_emitter->build_convolution_forward(
+                    data_desc,
+                    weights_desc,
+                    bias_desc,
+                    result_desc,
+                    convolution->get_window_movement_strides(),
+                    mkldnn_dilation_strides(convolution->get_window_dilation_strides()),
+                    convolution->get_padding_below(),
+                    convolution->get_padding_above());
+                build_mkldnn_functor(
+                    external_function, conv_index, {args[0], args[1], args[2], out[0]});
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ConvolutionBiasRelu)
+            {
+                auto convolution = static_cast<const ngraph::op::ConvolutionBiasRelu*>(node);
+
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error(
+                        "ConvolutionBiasRelu is only supported with MKLDNN kernel.");
+                }
+
+                auto input_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                auto weights_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1);
+                auto bias_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 2);
+                // HACK to help MKLDNN pick the right implementation
+                if (weights_format == mkldnn::memory::format::nchw)
+                {
+                    weights_format = mkldnn::memory::format::oihw;
+                }
+                auto output_format = runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto input_data_desc =
+                    mkldnn_emitter->build_memory_descriptor(args[0], input_format);
+                auto weights_desc =
+                    mkldnn_emitter->build_memory_descriptor(args[1], weights_format);
+                auto bias_desc = mkldnn_emitter->build_memory_descriptor(args[2], bias_format);
+                auto result_desc = mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+
+                const float ops_scale = 1.f;
+                const float ops_alpha = -0.f; // relu negative slope
+                const float ops_beta = 0.f;
+
+                mkldnn::post_ops ops;
+                ops.append_eltwise(ops_scale, mkldnn::algorithm::eltwise_relu, ops_alpha, ops_beta);
+
+                size_t conv_index = mkldnn_emitter->build_convolution_forward(
+                    input_data_desc,
+                    weights_desc,
+                    bias_desc,
+                    result_desc,
+                    convolution->get_window_movement_strides(),
+                    mkldnn_dilation_strides(convolution->get_window_dilation_strides()),
+                    convolution->get_padding_below(),
+                    convolution->get_padding_above(),
+                    ops);
+                build_mkldnn_functor(
+                    external_function, conv_index, {args[0], args[1], args[2], out[0]});
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ConvolutionBiasBackpropFiltersBias)
+            {
+                auto convolution =
+                    static_cast<const ngraph::op::ConvolutionBiasBackpropFiltersBias*>(node);
+
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error(
+                        "ConvolutionBiasBackpropFiltersBias is only supported with MKLDNN kernel.");
+                }
+
+                auto data_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                auto delta_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1);
+                auto weights_delta_format =
+                    runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+                auto bias_delta_format =
+                    runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 1);
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto data_desc = mkldnn_emitter->build_memory_descriptor(args[0], data_format);
+                auto delta_desc = mkldnn_emitter->build_memory_descriptor(args[1], delta_format);
+                auto weights_delta_desc =
+                    mkldnn_emitter->build_memory_descriptor(out[0], weights_delta_format);
+                auto bias_delta_desc =
+                    mkldnn_emitter->build_memory_descriptor(out[1], bias_delta_format);
+
+                size_t conv_index = mkldnn_emitter->build_convolution_backward_weights_bias(
+                    data_desc,
+                    delta_desc,
+                    weights_delta_desc,
+                    bias_delta_desc,
+                    convolution->get_window_movement_strides_forward(),
+                    mkldnn_dilation_strides(convolution->get_window_dilation_strides_forward()),
+                    convolution->get_padding_below_forward(),
+                    convolution->get_padding_above_forward());
+                build_mkldnn_functor(
+                    external_function, conv_index, {args[0], args[1], out[0], out[1]});
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::GroupConvolution)
+            {
+                auto convolution = static_cast<const ngraph::op::GroupConvolution*>(node);
+
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error("unsupported parameters for GroupConvolution");
+                }
+
+                auto& functors = external_function->get_functors();
+
+                Strides window_dilation_strides_adjusted =
+                    mkldnn_dilation_strides(convolution->get_window_dilation_strides());
+
+                auto input_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0);
+                auto output_format = runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto input_data_desc =
+                    mkldnn_emitter->build_memory_descriptor(args[0], input_format);
+
+                Shape weights_shape_groups = convolution->get_weights_dimensions();
+
+                auto weights_desc_any = mkldnn::memory::desc(
+                    mkldnn::memory::dims(weights_shape_groups.begin(), weights_shape_groups.end()),
+                    mkldnn_utils::get_mkldnn_data_type(args[1].get_element_type()),
+                    mkldnn::memory::format::any);
+
+                auto padding_below = convolution->get_padding_below();
+                auto padding_above = convolution->get_padding_above();
+                auto filter_strides = convolution->get_window_movement_strides();
+
+                auto result_desc = mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+
+                auto weights_optimized_format =
+                    mkldnn_emitter->query_convolution_forward_weight_format(
+                        input_data_desc,
+                        weights_desc_any,
+                        result_desc,
+                        filter_strides,
+                        window_dilation_strides_adjusted,
+                        padding_below,
+                        padding_above);
+
+                //create workspace for holding the result of converting weights layouts
+                auto ws = std::unique_ptr<MKLDNNWorkspace>(new MKLDNNWorkspace(
+                    shape_size(args[1].get_shape()) * args[1].get_element_type().size()));
+                auto ws_buf_index = mkldnn_emitter->insert_workspace(ws);
+
+                //descriptors for reorder operation
+                auto input_reorder_desc = mkldnn_emitter->build_memory_descriptor(
+                    weights_shape_groups,
+                    args[1].get_element_type(),
+                    mkldnn::memory::format::goihw);
+
+                auto result_reorder_desc = mkldnn_emitter->build_memory_descriptor(
+                    weights_shape_groups, args[1].get_element_type(), weights_optimized_format);
+
+                auto weights_desc = mkldnn::memory::desc(
+                    mkldnn::memory::dims(weights_shape_groups.begin(), weights_shape_groups.end()),
+                    mkldnn_utils::get_mkldnn_data_type(args[1].get_element_type()),
+                    weights_optimized_format);
+
+                auto prim_indices = mkldnn_emitter->build_group_convolution_forward(
+                    input_reorder_desc, //weights
+                    input_data_desc,
+                    weights_desc,
+                    result_reorder_desc,
+                    result_desc,
+                    filter_strides,
+                    window_dilation_strides_adjusted,
+                    padding_below,
+                    padding_above);
+
+                size_t reorder_index = prim_indices.first;
+                auto& reorder_deps = mkldnn_emitter->get_primitive_deps(reorder_index);
+                size_t conv_index = prim_indices.second;
+                auto& conv_deps = mkldnn_emitter->get_primitive_deps(conv_index);
+
+                auto reorder_input_dep = reorder_deps[0];
+                auto reorder_output_dep = reorder_deps[1];
+                auto conv_input_dep = conv_deps[0];
+                auto conv_weights_dep = conv_deps[1];
+                auto conv_output_dep = conv_deps[2];
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                reorder_index,
+                                reorder_input_dep,
+                                reorder_output_dep,
+                                conv_index,
+                                conv_input_dep,
+                                conv_weights_dep,
+                                conv_output_dep,
+                                ws_buf_index,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out0_buffer_index](CPURuntimeContext* ctx) {
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, reorder_input_dep, ctx->buffer_data[arg1_buffer_index]);
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, reorder_output_dep, ctx->mkldnn_workspaces[ws_buf_index]);
+                    mkldnn_utils::mkldnn_invoke_primitive(ctx, reorder_index);
+
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, conv_input_dep, ctx->buffer_data[arg0_buffer_index]);
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, conv_weights_dep, ctx->mkldnn_workspaces[ws_buf_index]);
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, conv_output_dep, ctx->buffer_data[out0_buffer_index]);
+                    mkldnn_utils::mkldnn_invoke_primitive(ctx, conv_index);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename ElementType>
+            static void build_max_pool(CPU_ExternalFunction* external_function,
+                                       const ngraph::Node* node,
+                                       const vector<TensorViewWrapper>& args,
+                                       const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto max_pool = static_cast<const ngraph::op::MaxPool*>(node);
+
+                auto arg_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto window_shape = max_pool->get_window_shape();
+                auto window_movement_strides = max_pool->get_window_movement_strides();
+                auto padding_below = max_pool->get_padding_below();
+                auto padding_above = max_pool->get_padding_above();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg_shape,
+                                result_shape,
+                                window_shape,
+                                window_movement_strides,
+                                padding_below,
+                                padding_above,
+                                arg_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::max_pool<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out_buffer_index]),
+                        arg_shape,
+                        result_shape,
+                        window_shape,
+                        window_movement_strides,
+                        padding_below,
+                        padding_above);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MaxPool)
+            {
+                auto max_pool = static_cast<const ngraph::op::MaxPool*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+                    auto result_desc = mkldnn_emitter->build_memory_descriptor(
+                        out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                    size_t max_pool_index = mkldnn_emitter->build_pooling_forward(
+                        mkldnn::algorithm::pooling_max,
+                        input_desc,
+                        result_desc,
+                        max_pool->get_window_movement_strides(),
+                        max_pool->get_window_shape(),
+                        max_pool->get_padding_below(),
+                        max_pool->get_padding_above());
+                    build_mkldnn_functor(external_function, max_pool_index, {args[0], out[0]});
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_max_pool);
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MaxPoolWithIndices)
+            {
+                auto max_pool = static_cast<const ngraph::op::MaxPoolWithIndices*>(node);
+
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error("MaxPoolWithIndices isn't supported");
+                }
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                    args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+                auto result_desc = mkldnn_emitter->build_memory_descriptor(
+                    out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                size_t max_pool_index = mkldnn_emitter->build_max_pooling_with_indices_forward(
+                    mkldnn::algorithm::pooling_max,
+                    input_desc,
+                    result_desc,
+                    max_pool->get_window_movement_strides(),
+                    max_pool->get_window_shape(),
+                    max_pool->get_padding_below(),
+                    max_pool->get_padding_above());
+                build_mkldnn_functor(external_function, max_pool_index, {args[0], out[0], out[1]});
+            }
+
+            template <typename ElementType>
+            static void build_avg_pool(CPU_ExternalFunction* external_function,
+                                       const ngraph::Node* node,
+                                       const vector<TensorViewWrapper>& args,
+                                       const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto avg_pool = static_cast<const ngraph::op::AvgPool*>(node);
+
+                auto arg_shape = args[0].get_shape();
+                auto result_shape = out[0].get_shape();
+                auto window_shape = avg_pool->get_window_shape();
+                auto window_movement_strides = avg_pool->get_window_movement_strides();
+                auto padding_below = avg_pool->get_padding_below();
+                auto padding_above = avg_pool->get_padding_above();
+                auto include_padding = avg_pool->get_include_padding_in_avg_computation();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                arg_shape,
+                                result_shape,
+                                window_shape,
+                                window_movement_strides,
+                                padding_below,
+                                padding_above,
+                                include_padding,
+                                arg_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::avg_pool<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out_buffer_index]),
+                        arg_shape,
+                        result_shape,
+                        window_shape,
+                        window_movement_strides,
+                        padding_below,
+                        padding_above,
+                        include_padding);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AvgPool)
+            {
+                auto avg_pool = static_cast<const ngraph::op::AvgPool*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+                    auto result_desc = mkldnn_emitter->build_memory_descriptor(
+                        out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                    size_t avg_pool_index = mkldnn_emitter->build_pooling_forward(
+                        (avg_pool->get_include_padding_in_avg_computation()
+                             ? mkldnn::algorithm::pooling_avg_include_padding
+                             : mkldnn::algorithm::pooling_avg_exclude_padding),
+                        input_desc,
+                        result_desc,
+                        avg_pool->get_window_movement_strides(),
+                        avg_pool->get_window_shape(),
+                        avg_pool->get_padding_below(),
+                        avg_pool->get_padding_above());
+                    build_mkldnn_functor(external_function, avg_pool_index, {args[0], out[0]});
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_avg_pool);
+                }
+            }
+
+            template <typename ElementType>
+            static void build_avg_pool_backprop(CPU_ExternalFunction* external_function,
+                                                const ngraph::Node* node,
+                                                const vector<TensorViewWrapper>& args,
+                                                const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto apb = static_cast<const ngraph::op::AvgPoolBackprop*>(node);
+
+                auto delta_shape = args[0].get_shape();
+                auto out_shape = out[0].get_shape();
+                auto window_shape = apb->get_window_shape();
+                auto window_movement_strides = apb->get_window_movement_strides();
+                auto padding_below = apb->get_padding_below();
+                auto padding_above = apb->get_padding_above();
+                auto include_padding = apb->get_include_padding_in_avg_computation();
+
+                auto delta_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                delta_shape,
+                                out_shape,
+                                window_shape,
+                                window_movement_strides,
+                                padding_below,
+                                padding_above,
+                                include_padding,
+                                delta_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::avg_pool_backprop<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[delta_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out_buffer_index]),
+                        delta_shape,
+                        out_shape,
+                        window_shape,
+                        window_movement_strides,
+                        padding_below,
+                        padding_above,
+                        include_padding);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AvgPoolBackprop)
+            {
+                auto apb = static_cast<const ngraph::op::AvgPoolBackprop*>(node);
+
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto diff_dst_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+                    auto diff_src_desc = mkldnn_emitter->build_memory_descriptor(
+                        out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                    size_t avg_pool_index = mkldnn_emitter->build_pooling_backward(
+                        (apb->get_include_padding_in_avg_computation()
+                             ? mkldnn::algorithm::pooling_avg_include_padding
+                             : mkldnn::algorithm::pooling_avg_exclude_padding),
+                        diff_dst_desc,
+                        diff_src_desc,
+                        apb->get_window_movement_strides(),
+                        apb->get_window_shape(),
+                        apb->get_padding_below(),
+                        apb->get_padding_above());
+                    build_mkldnn_functor(external_function, avg_pool_index, {args[0], out[0]});
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_avg_pool_backprop);
+                }
+            }
+
+            template <typename ElementType>
+            static void build_max_pool_backprop(CPU_ExternalFunction* external_function,
+                                                const ngraph::Node* node,
+                                                const vector<TensorViewWrapper>& args,
+                                                const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto mpb = static_cast<const ngraph::op::MaxPoolBackprop*>(node);
+
+                auto delta_shape = args[1].get_shape();
+                auto out_shape = out[0].get_shape();
+                auto window_shape = mpb->get_window_shape();
+                auto window_movement_strides = mpb->get_window_movement_strides();
+                auto padding_below = mpb->get_padding_below();
+                auto padding_above = mpb->get_padding_above();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto delta_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                delta_shape,
+                                out_shape,
+                                window_shape,
+                                window_movement_strides,
+                                padding_below,
+                                padding_above,
+                                arg_buffer_index,
+                                delta_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    runtime::reference::max_pool_backprop<ElementType>(
+                        static_cast<ElementType*>(ctx->buffer_data[arg_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[delta_buffer_index]),
+                        static_cast<ElementType*>(ctx->buffer_data[out_buffer_index]),
+                        delta_shape,
+                        out_shape,
+                        window_shape,
+                        window_movement_strides,
+                        padding_below,
+                        padding_above);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MaxPoolBackprop)
+            {
+                auto mpb = static_cast<const ngraph::op::MaxPoolBackprop*>(node);
+
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_max_pool_backprop);
+                    return;
+                }
+
+                auto& functors = external_function->get_functors();
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto fprop_src_desc = mkldnn_emitter->build_memory_descriptor(
+                    args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+                auto diff_dst_desc = mkldnn_emitter->build_memory_descriptor(
+                    args[1], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1));
+                auto diff_src_desc = mkldnn_emitter->build_memory_descriptor(
+                    out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                size_t max_pool_index = mkldnn_emitter->build_max_pooling_backward(
+                    mkldnn::algorithm::pooling_max,
+                    fprop_src_desc,
+                    diff_dst_desc,
+                    diff_src_desc,
+                    mpb->get_window_movement_strides(),
+                    mpb->get_window_shape(),
+                    mpb->get_padding_below(),
+                    mpb->get_padding_above());
+
+                // The backward primitive is preceded by a forward pass that fills the
+                // workspace recording where each maximum came from. Both primitives take the
+                // workspace index as their last dependency.
+                size_t fwd_pool_index = max_pool_index - 1;
+                auto fdeps = mkldnn_emitter->get_primitive_deps(fwd_pool_index);
+                auto bdeps = mkldnn_emitter->get_primitive_deps(max_pool_index);
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto delta_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                fwd_pool_index,
+                                max_pool_index,
+                                fdeps,
+                                bdeps,
+                                arg_buffer_index,
+                                delta_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, fdeps[0], ctx->buffer_data[arg_buffer_index]);
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, fdeps[1], ctx->buffer_data[out_buffer_index]);
+                    mkldnn_utils::set_memory_ptr(ctx, fdeps[2], ctx->mkldnn_workspaces[fdeps[3]]);
+                    mkldnn_utils::mkldnn_invoke_primitive(ctx, fwd_pool_index);
+
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, bdeps[0], ctx->buffer_data[delta_buffer_index]);
+                    mkldnn_utils::set_memory_ptr(ctx, bdeps[1], ctx->mkldnn_workspaces[bdeps[3]]);
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, bdeps[2], ctx->buffer_data[out_buffer_index]);
+                    mkldnn_utils::mkldnn_invoke_primitive(ctx, max_pool_index);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::MaxPoolWithIndicesBackprop)
+            {
+                auto mpb = static_cast<const ngraph::op::MaxPoolWithIndicesBackprop*>(node);
+
+                if (!runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error("MaxPoolWithIndicesBackprop isn't supported");
+                }
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto diff_dst_desc = mkldnn_emitter->build_memory_descriptor(
+                    args[1], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1));
+                auto diff_src_desc = mkldnn_emitter->build_memory_descriptor(
+                    out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                size_t max_pool_index = mkldnn_emitter->build_max_pooling_with_indices_backward(
+                    mkldnn::algorithm::pooling_max,
+                    diff_dst_desc,
+                    diff_src_desc,
+                    mpb->get_window_movement_strides(),
+                    mpb->get_window_shape(),
+                    mpb->get_padding_below(),
+                    mpb->get_padding_above());
+                build_mkldnn_functor(external_function, max_pool_index, {args[1], args[2], out[0]});
+            }
+
+            void Builder::buildBatchNorm(CPU_ExternalFunction* external_function,
+                                         const ngraph::Node* node,
+                                         const vector<TensorViewWrapper>& args,
+                                         const vector<TensorViewWrapper>& out,
+                                         bool append_relu)
+            {
+                auto& functors = external_function->get_functors();
+                auto batchnorm = static_cast<const ngraph::op::BatchNorm*>(node);
+
+                const float ops_scale = 1.f;
+                const float ops_alpha = -0.f; // relu negative slope
+                const float ops_beta = 0.f;
+
+                mkldnn::post_ops ops;
+                if (append_relu)
+                {
+                    ops.append_eltwise(
+                        ops_scale, mkldnn::algorithm::eltwise_relu, ops_alpha, ops_beta);
+                }
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto weights_shape = Shape{2, args[0].get_size()};
+                auto weights_desc = mkldnn_emitter->build_memory_descriptor(
+                    weights_shape, args[0].get_element_type(), mkldnn::memory::format::nc);
+
+                // MKLDNN wants gamma and beta packed into a single weights tensor, which is
+                // staged in a per-call scratch buffer so that concurrent calls do not share it.
+                size_t gamma_size = args[0].get_size() * args[0].get_element_type().size();
+                size_t beta_size = args[1].get_size() * args[1].get_element_type().size();
+                auto gamma_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto beta_buffer_index = external_function->get_buffer_index(args[1].get_name());
+
+                size_t batchnorm_index;
+                vector<pair<size_t, size_t>> bindings;
+                size_t weights_dep;
+                if (batchnorm->get_training_flag() && args.size() == 3)
+                {
+                    auto input_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 2);
+                    auto result_format =
+                        runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+                    auto mean_format =
+                        runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 1);
+                    auto variance_format =
+                        runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 2);
+
+                    auto input_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[2], input_format);
+                    auto results_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[0], result_format);
+                    auto mean_desc = mkldnn_emitter->build_memory_descriptor(out[1], mean_format);
+                    auto variance_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[2], variance_format);
+
+                    batchnorm_index =
+                        mkldnn_emitter->build_batchnorm_forward(input_desc,
+                                                                weights_desc,
+                                                                results_desc,
+                                                                mean_desc,
+                                                                variance_desc,
+                                                                batchnorm->get_eps_value(),
+                                                                false,
+                                                                batchnorm->get_training_flag(),
+                                                                ops);
+
+                    auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
+                    weights_dep = deps[1];
+                    vector<pair<size_t, TensorViewWrapper>> tensors{
+                        {deps[0], args[2]},
+                        {deps[2], out[0]},
+                        {deps[3], out[1]},
+                        {deps[4], out[2]},
+                    };
+                    for (auto& tensor : tensors)
+                    {
+                        bindings.emplace_back(
+                            tensor.first,
+                            external_function->get_buffer_index(tensor.second.get_name()));
+                    }
+                }
+                else
+                {
+                    auto input_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 2);
+                    auto mean_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 3);
+                    auto variance_format =
+                        runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 4);
+                    auto result_format =
+                        runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                    auto input_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[2], input_format);
+                    auto mean_desc = mkldnn_emitter->build_memory_descriptor(args[3], mean_format);
+                    auto variance_desc =
+                        mkldnn_emitter->build_memory_descriptor(args[4], variance_format);
+                    auto results_desc =
+                        mkldnn_emitter->build_memory_descriptor(out[0], result_format);
+
+                    batchnorm_index =
+                        mkldnn_emitter->build_batchnorm_forward(input_desc,
+                                                                weights_desc,
+                                                                results_desc,
+                                                                mean_desc,
+                                                                variance_desc,
+                                                                batchnorm->get_eps_value(),
+                                                                true,
+                                                                batchnorm->get_training_flag(),
+                                                                ops);
+
+                    auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
+                    weights_dep = deps[3];
+                    vector<pair<size_t, TensorViewWrapper>> tensors{
+                        {deps[0], args[2]},
+                        {deps[1], args[3]},
+                        {deps[2], args[4]},
+                        {deps[4], out[0]},
+                    };
+                    for (auto& tensor : tensors)
+                    {
+                        bindings.emplace_back(
+                            tensor.first,
+                            external_function->get_buffer_index(tensor.second.get_name()));
+                    }
+                }
+
+                auto functor = [&,
+                                batchnorm_index,
+                                bindings,
+                                weights_dep,
+                                gamma_size,
+                                beta_size,
+                                gamma_buffer_index,
+                                beta_buffer_index](CPURuntimeContext* ctx) {
+                    vector<char> bn_weights(gamma_size + beta_size);
+                    memcpy(bn_weights.data(), ctx->buffer_data[gamma_buffer_index], gamma_size);
+                    memcpy(bn_weights.data() + gamma_size,
+                           ctx->buffer_data[beta_buffer_index],
+                           beta_size);
+
+                    for (const auto& binding : bindings)
+                    {
+                        mkldnn_utils::set_memory_ptr(
+                            ctx, binding.first, ctx->buffer_data[binding.second]);
+                    }
+                    mkldnn_utils::set_memory_ptr(ctx, weights_dep, bn_weights.data());
+                    mkldnn_utils::mkldnn_invoke_primitive(ctx, batchnorm_index);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename ElementType>
+            static void build_batch_norm(CPU_ExternalFunction* external_function,
+                                         const ngraph::Node* node,
+                                         const vector<TensorViewWrapper>& args,
+                                         const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto batchnorm = static_cast<const ngraph::op::BatchNorm*>(node);
+
+                auto eps = batchnorm->get_eps_value();
+                auto arg2_shape = args[2].get_shape();
+
+                vector<size_t> arg_buffer_indices;
+                for (auto& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                }
+                vector<size_t> out_buffer_indices;
+                for (auto& result : out)
+                {
+                    out_buffer_indices.push_back(
+                        external_function->get_buffer_index(result.get_name()));
+                }
+
+                if (batchnorm->get_training_flag() && args.size() == 3)
+                {
+                    auto functor = [&, eps, arg2_shape, arg_buffer_indices, out_buffer_indices](
+                        CPURuntimeContext* ctx) {
+                        runtime::reference::batch_norm_three_outputs<ElementType>(
+                            eps,
+                            static_cast<ElementType*>(ctx->buffer_data[arg_buffer_indices[0]]),
+                            static_cast<ElementType*>(ctx->buffer_data[arg_buffer_indices[1]]),
+                            static_cast<ElementType*>(ctx->buffer_data[arg_buffer_indices[2]]),
+                            static_cast<ElementType*>(ctx->buffer_data[out_buffer_indices[0]]),
+                            static_cast<ElementType*>(ctx->buffer_data[out_buffer_indices[1]]),
+                            static_cast<ElementType*>(ctx->buffer_data[out_buffer_indices[2]]),
+                            arg2_shape);
+                    };
+                    functors.emplace_back(functor);
+                }
+                else
+                {
+                    auto functor = [&, eps, arg2_shape, arg_buffer_indices, out_buffer_indices](
+                        CPURuntimeContext* ctx) {
+                        runtime::reference::batch_norm_one_output<ElementType>(
+                            eps,
+                            static_cast<ElementType*>(ctx->buffer_data[arg_buffer_indices[0]]),
+                            static_cast<ElementType*>(ctx->buffer_data[arg_buffer_indices[1]]),
+                            static_cast<ElementType*>(ctx->buffer_data[arg_buffer_indices[2]]),
+                            static_cast<ElementType*>(ctx->buffer_data[arg_buffer_indices[3]]),
+                            static_cast<ElementType*>(ctx->buffer_data[arg_buffer_indices[4]]),
+                            static_cast<ElementType*>(ctx->buffer_data[out_buffer_indices[0]]),
+                            arg2_shape);
+                    };
+                    functors.emplace_back(functor);
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchNorm)
+            {
+                if (!mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_batch_norm);
+                }
+                else
+                {
+                    buildBatchNorm(external_function, node, args, out, false);
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchNormRelu)
+            {
+                if (!mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error("BatchNormRelu is only supported with 4-D MKLDNN kernel.");
+                }
+                buildBatchNorm(external_function, node, args, out, true);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchNormBackprop)
+            {
+                auto& functors = external_function->get_functors();
+                auto batchnorm = static_cast<const ngraph::op::BatchNormBackprop*>(node);
+
+                auto input_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 2);
+                auto mean_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 3);
+                auto variance_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 4);
+                auto delta_format = runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 5);
+                auto dinput_format = runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0);
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto weights_shape = Shape{2, args[0].get_size()};
+                auto weights_desc = mkldnn_emitter->build_memory_descriptor(
+                    weights_shape, args[0].get_element_type(), mkldnn::memory::format::nc);
+                auto input_desc = mkldnn_emitter->build_memory_descriptor(args[2], input_format);
+                auto mean_desc = mkldnn_emitter->build_memory_descriptor(args[3], mean_format);
+                auto variance_desc =
+                    mkldnn_emitter->build_memory_descriptor(args[4], variance_format);
+                auto delta_desc = mkldnn_emitter->build_memory_descriptor(args[5], delta_format);
+                auto dinput_desc = mkldnn_emitter->build_memory_descriptor(out[0], dinput_format);
+                auto dweights_desc = mkldnn_emitter->build_memory_descriptor(
+                    weights_shape, args[0].get_element_type(), mkldnn::memory::format::nc);
+
+                auto batchnorm_index =
+                    mkldnn_emitter->build_batchnorm_backward(weights_desc,
+                                                             input_desc,
+                                                             mean_desc,
+                                                             variance_desc,
+                                                             delta_desc,
+                                                             dinput_desc,
+                                                             dweights_desc,
+                                                             batchnorm->get_eps_value());
+                auto deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
+
+                size_t gamma_size = args[0].get_size() * args[0].get_element_type().size();
+                size_t beta_size = args[1].get_size() * args[1].get_element_type().size();
+
+                vector<size_t> arg_buffer_indices;
+                for (auto& arg : args)
+                {
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(arg.get_name()));
+                }
+                vector<size_t> out_buffer_indices;
+                for (auto& result : out)
+                {
+                    out_buffer_indices.push_back(
+                        external_function->get_buffer_index(result.get_name()));
+                }
+
+                auto functor = [&,
+                                batchnorm_index,
+                                deps,
+                                gamma_size,
+                                beta_size,
+                                arg_buffer_indices,
+                                out_buffer_indices](CPURuntimeContext* ctx) {
+                    vector<char> bn_weights(gamma_size + beta_size);
+                    vector<char> bn_dweights(gamma_size + beta_size);
+                    memcpy(bn_weights.data(),
+                           ctx->buffer_data[arg_buffer_indices[0]],
+                           gamma_size);
+                    memcpy(bn_weights.data() + gamma_size,
+                           ctx->buffer_data[arg_buffer_indices[1]],
+                           beta_size);
+
+                    mkldnn_utils::set_memory_ptr(ctx, deps[0], bn_weights.data());
+                    for (size_t i = 0; i < 4; i++)
+                    {
+                        mkldnn_utils::set_memory_ptr(
+                            ctx, deps[i + 1], ctx->buffer_data[arg_buffer_indices[i + 2]]);
+                    }
+                    mkldnn_utils::set_memory_ptr(
+                        ctx, deps[5], ctx->buffer_data[out_buffer_indices[0]]);
+                    mkldnn_utils::set_memory_ptr(ctx, deps[6], bn_dweights.data());
+                    mkldnn_utils::mkldnn_invoke_primitive(ctx, batchnorm_index);
+
+                    memcpy(ctx->buffer_data[out_buffer_indices[1]],
+                           bn_dweights.data(),
+                           gamma_size);
+                    memcpy(ctx->buffer_data[out_buffer_indices[2]],
+                           bn_dweights.data() + gamma_size,
+                           beta_size);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename ElementType>
+            static void build_relu_backprop(CPU_ExternalFunction* external_function,
+                                            const ngraph::Node* node,
+                                            const vector<TensorViewWrapper>& args,
+                                            const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto count = out[0].get_size();
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto delta_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor =
+                    [&, count, arg_buffer_index, delta_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx) {
+                        runtime::reference::relu_backprop<ElementType>(
+                            static_cast<ElementType*>(ctx->buffer_data[arg_buffer_index]),
+                            static_cast<ElementType*>(ctx->buffer_data[delta_buffer_index]),
+                            static_cast<ElementType*>(ctx->buffer_data[out_buffer_index]),
+                            count);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ReluBackprop)
+            {
+                if (runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                    auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[0], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 0));
+                    auto delta_desc = mkldnn_emitter->build_memory_descriptor(
+                        args[1], runtime::cpu::mkldnn_utils::get_input_mkldnn_format(node, 1));
+                    auto result_desc = mkldnn_emitter->build_memory_descriptor(
+                        out[0], runtime::cpu::mkldnn_utils::get_output_mkldnn_format(node, 0));
+
+                    size_t relu_index =
+                        mkldnn_emitter->build_relu_backward(input_desc, delta_desc, result_desc);
+                    build_mkldnn_functor(external_function, relu_index, {args[0], args[1], out[0]});
+                }
+                else
+                {
+                    BUILD_TYPED_FUNCTOR(out[0].get_element_type(), build_relu_backprop);
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Sigmoid)
+            {
+                int input_1d_size = static_cast<int>(shape_size(args[0].get_shape()));
+                int result_1d_size = static_cast<int>(shape_size(out[0].get_shape()));
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto input_desc = mkldnn::memory::desc(
+                    {input_1d_size},
+                    mkldnn_utils::get_mkldnn_data_type(args[0].get_element_type()),
+                    mkldnn::memory::format::x);
+                auto result_desc = mkldnn::memory::desc(
+                    {result_1d_size},
+                    mkldnn_utils::get_mkldnn_data_type(out[0].get_element_type()),
+                    mkldnn::memory::format::x);
+
+                size_t sigmoid_index =
+                    mkldnn_emitter->build_sigmoid_forward(input_desc, result_desc);
+                build_mkldnn_functor(external_function, sigmoid_index, {args[0], out[0]});
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SigmoidBackprop)
+            {
+                int input_1d_size = static_cast<int>(shape_size(args[0].get_shape()));
+                int delta_1d_size = static_cast<int>(shape_size(args[1].get_shape()));
+                int result_1d_size = static_cast<int>(shape_size(out[0].get_shape()));
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto input_desc = mkldnn::memory::desc(
+                    {input_1d_size},
+                    mkldnn_utils::get_mkldnn_data_type(args[0].get_element_type()),
+                    mkldnn::memory::format::x);
+                auto delta_desc = mkldnn::memory::desc(
+                    {delta_1d_size},
+                    mkldnn_utils::get_mkldnn_data_type(args[1].get_element_type()),
+                    mkldnn::memory::format::x);
+                auto result_desc = mkldnn::memory::desc(
+                    {result_1d_size},
+                    mkldnn_utils::get_mkldnn_data_type(out[0].get_element_type()),
+                    mkldnn::memory::format::x);
+
+                size_t sigmoid_index =
+                    mkldnn_emitter->build_sigmoid_backward(input_desc, delta_desc, result_desc);
+                build_mkldnn_functor(
+                    external_function, sigmoid_index, {args[0], args[1], out[0]});
+            }
+
+            // Splits the activation applied to one input of SigmoidMultiply into a numerator and
+            // a denominator, and optionally the numerator and denominator of its derivative. This
+            // mirrors generate_sigmoid_mul_func in the code generator.
+            static void sigmoid_multiply_terms(ngraph::op::SigmoidMultiply::FunctionType type,
+                                               float input,
+                                               float& numer,
+                                               float& denom,
+                                               float* d_numer = nullptr,
+                                               float* d_denom = nullptr)
+            {
+                switch (type)
+                {
+                case ngraph::op::SigmoidMultiply::FunctionType::Logistic:
+                {
+                    auto e_x = exp(input);
+                    numer = e_x;
+                    denom = e_x + 1;
+                    if (d_numer)
+                    {
+                        *d_numer = numer;
+                        *d_denom = denom * denom;
+                    }
+                    break;
+                }
+                case ngraph::op::SigmoidMultiply::FunctionType::Tanh:
+                {
+                    auto e_2x = exp(2.0f * input);
+                    numer = e_2x - 1;
+                    denom = e_2x + 1;
+                    if (d_numer)
+                    {
+                        *d_numer = 4.0f * e_2x;
+                        *d_denom = denom * denom;
+                    }
+                    break;
+                }
+                case ngraph::op::SigmoidMultiply::FunctionType::Identity:
+                    numer = input;
+                    denom = 1;
+                    if (d_numer)
+                    {
+                        *d_numer = 1;
+                        *d_denom = 1;
+                    }
+                    break;
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SigmoidMultiply)
+            {
+                auto& functors = external_function->get_functors();
+                auto sigmoid_mul = static_cast<const ngraph::op::SigmoidMultiply*>(node);
+
+                auto input_0_type = sigmoid_mul->get_input_func_type(0);
+                auto input_1_type = sigmoid_mul->get_input_func_type(1);
+                auto count = out[0].get_size();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                input_0_type,
+                                input_1_type,
+                                count,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx) {
+                    auto input_0 = static_cast<float*>(ctx->buffer_data[arg0_buffer_index]);
+                    auto input_1 = static_cast<float*>(ctx->buffer_data[arg1_buffer_index]);
+                    auto output = static_cast<float*>(ctx->buffer_data[out_buffer_index]);
+#pragma omp parallel for simd
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        float numer_0, denom_0, numer_1, denom_1;
+                        sigmoid_multiply_terms(input_0_type, input_0[i], numer_0, denom_0);
+                        sigmoid_multiply_terms(input_1_type, input_1[i], numer_1, denom_1);
+                        output[i] = (numer_0 * numer_1) / (denom_0 * denom_1);
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SigmoidMultiplyBackprop)
+            {
+                // math: we have sigmoid functions f(x) and g(y) multiplied, z = f(x) * g(y)
+                // dz/dx = dz/df * df/dx = g(y) * f'(x)
+                // dz/dy = dz/dg * dg/dy = f(x) * g'(y)
+                auto& functors = external_function->get_functors();
+                auto sigmoid_mul_backprop =
+                    static_cast<const ngraph::op::SigmoidMultiplyBackprop*>(node);
+
+                auto input_0_type = sigmoid_mul_backprop->get_input_func_type(0);
+                auto input_1_type = sigmoid_mul_backprop->get_input_func_type(1);
+                auto count = out[0].get_size();
+
+                auto data_0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto data_1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto delta_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto input_0_delta_buffer_index =
+                    external_function->get_buffer_index(out[0].get_name());
+                auto input_1_delta_buffer_index =
+                    external_function->get_buffer_index(out[1].get_name());
+
+                auto functor = [&,
+                                input_0_type,
+                                input_1_type,
+                                count,
+                                data_0_buffer_index,
+                                data_1_buffer_index,
+                                delta_buffer_index,
+                                input_0_delta_buffer_index,
+                                input_1_delta_buffer_index](CPURuntimeContext* ctx) {
+                    auto data_0 = static_cast<float*>(ctx->buffer_data[data_0_buffer_index]);
+                    auto data_1 = static_cast<float*>(ctx->buffer_data[data_1_buffer_index]);
+                    auto delta = static_cast<float*>(ctx->buffer_data[delta_buffer_index]);
+                    auto input_0_delta =
+                        static_cast<float*>(ctx->buffer_data[input_0_delta_buffer_index]);
+                    auto input_1_delta =
+                        static_cast<float*>(ctx->buffer_data[input_1_delta_buffer_index]);
+#pragma omp parallel for simd
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        float numer_0, denom_0, d_numer_0, d_denom_0;
+                        float numer_1, denom_1, d_numer_1, d_denom_1;
+                        sigmoid_multiply_terms(
+                            input_0_type, data_0[i], numer_0, denom_0, &d_numer_0, &d_denom_0);
+                        sigmoid_multiply_terms(
+                            input_1_type, data_1[i], numer_1, denom_1, &d_numer_1, &d_denom_1);
+                        input_0_delta[i] =
+                            delta[i] * (numer_1 * d_numer_0) / (denom_1 * d_denom_0);
+                        input_1_delta[i] =
+                            delta[i] * (numer_0 * d_numer_1) / (denom_0 * d_denom_1);
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::ConvertLayout)
+            {
+                auto input_tvl =
+                    node->get_inputs()[0].get_output().get_tensor_view()->get_tensor_view_layout();
+                auto input_cpu_tvl =
+                    dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(input_tvl);
+                auto input_format = input_cpu_tvl->get_mkldnn_format();
+
+                // Reorder input shape if needed
+                auto input_axis_order = input_cpu_tvl->get_axis_order();
+                Shape input_shape(input_axis_order.size());
+                for (size_t idx = 0; idx < input_axis_order.size(); idx++)
+                {
+                    input_shape[idx] = args[0].get_shape()[input_axis_order[idx]];
+                }
+
+                auto output_tvl = node->get_output_tensor_view(0)->get_tensor_view_layout();
+                auto output_format =
+                    dynamic_cast<runtime::cpu::LayoutDescriptor&>(*output_tvl).get_mkldnn_format();
+
+                // MKLDNN relies on format names for selecting optimized kernel implementations
+                // Hacky way to deal with this until they move to using canonicalized layouts
+                if (input_format == mkldnn::memory::format::nchw &&
+                    runtime::cpu::mkldnn_utils::is_mkldnn_filter_format(output_format))
+                {
+                    input_format = mkldnn::memory::format::oihw;
+                }
+                if (output_format == mkldnn::memory::format::nchw &&
+                    runtime::cpu::mkldnn_utils::is_mkldnn_filter_format(input_format))
+                {
+                    output_format = mkldnn::memory::format::oihw;
+                }
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto input_desc = mkldnn_emitter->build_memory_descriptor(
+                    input_shape, args[0].get_element_type(), input_format);
+                auto result_desc = mkldnn_emitter->build_memory_descriptor(out[0], output_format);
+
+                size_t reorder_index = mkldnn_emitter->build_reorder(input_desc, result_desc);
+                build_mkldnn_functor(external_function, reorder_index, {args[0], out[0]});
+            }
+
+            // Lstm and Rnn lower to the same fused MKLDNN RNN primitive and only differ in
+            // the validation performed before building it.
+            template <typename OP>
+            static void build_rnn_functor(CPU_ExternalFunction* external_function,
+                                          const OP* rnn_node,
+                                          const vector<TensorViewWrapper>& args,
+                                          const vector<TensorViewWrapper>& out)
+            {
+                const int src_sequence_length_max = rnn_node->get_src_sequence_length();
+                const int direction = rnn_node->get_direction();
+                const int num_fused_layers = rnn_node->get_num_fused_layers();
+                const int rnn_cell_n_gates = rnn_node->get_gates_per_cell();
+                const int rnn_cell_n_states = rnn_node->get_num_cell_states();
+                const int feature_size = rnn_node->get_src_iter_feature_size();
+                const int batch = rnn_node->get_batch_size();
+                const int src_layer_feature_size = rnn_node->get_src_layer_feature_size();
+
+                if (out[0].get_shape().size() == 2 && (out[0].get_shape()[1] != feature_size))
+                {
+                    throw ngraph_error(
+                        "input slc{ht} feature size is not equal to output dlc{ht} feature size ");
+                }
+
+                mkldnn::memory::dims src_layer_tz = {
+                    src_sequence_length_max, batch, src_layer_feature_size};
+                mkldnn::memory::dims src_iter_tz = {
+                    num_fused_layers, direction, rnn_cell_n_states, batch, feature_size};
+                mkldnn::memory::dims weights_layer_tz = {num_fused_layers,
+                                                         direction,
+                                                         src_layer_feature_size,
+                                                         rnn_cell_n_gates,
+                                                         feature_size};
+                mkldnn::memory::dims weights_iter_tz = {
+                    num_fused_layers, direction, feature_size, rnn_cell_n_gates, feature_size};
+                mkldnn::memory::dims bias_tz = {
+                    num_fused_layers, direction, rnn_cell_n_gates, feature_size};
+                mkldnn::memory::dims dst_layer_tz = {src_sequence_length_max, batch, feature_size};
+                mkldnn::memory::dims dst_iter_tz = {
+                    num_fused_layers, direction, rnn_cell_n_states, batch, feature_size};
+
+                // We create the memory descriptors used by the user
+                auto src_layer_md = mkldnn::memory::desc(
+                    {src_layer_tz}, mkldnn::memory::data_type::f32, mkldnn::memory::format::tnc);
+                auto src_iter_md = mkldnn::memory::desc(
+                    {src_iter_tz}, mkldnn::memory::data_type::f32, mkldnn::memory::format::ldsnc);
+                auto wei_layer_md = mkldnn::memory::desc({weights_layer_tz},
+                                                         mkldnn::memory::data_type::f32,
+                                                         mkldnn::memory::format::ldigo);
+                auto wei_iter_md = mkldnn::memory::desc({weights_iter_tz},
+                                                        mkldnn::memory::data_type::f32,
+                                                        mkldnn::memory::format::ldigo);
+                auto bias_md = mkldnn::memory::desc(
+                    {bias_tz}, mkldnn::memory::data_type::f32, mkldnn::memory::format::ldgo);
+                auto dst_layer_md = mkldnn::memory::desc(
+                    {dst_layer_tz}, mkldnn::memory::data_type::f32, mkldnn::memory::format::tnc);
+                auto dst_iter_md = mkldnn::memory::desc(
+                    {dst_iter_tz}, mkldnn::memory::data_type::f32, mkldnn::memory::format::ldsnc);
+
+                auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
+                auto rnn_index = mkldnn_emitter->build_rnn_forward(src_layer_md,
+                                                                   src_iter_md,
+                                                                   wei_layer_md,
+                                                                   wei_iter_md,
+                                                                   bias_md,
+                                                                   dst_layer_md,
+                                                                   dst_iter_md);
+                build_mkldnn_functor(external_function,
+                                     rnn_index,
+                                     {args[0], args[1], args[2], args[3], args[4], out[0], out[1]});
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Lstm)
+            {
+                auto lstm_node = static_cast<const ngraph::op::Lstm*>(node);
+                if (args.size() != 5 || !lstm_node->get_fused_inputs())
+                {
+                    throw ngraph_error(
+                        "Lstm op doesnt have the required number of inputs to emit MKLDNN kernel");
+                }
+                if (out[1].get_shape().size() == 2 &&
+                    (out[1].get_shape()[1] != lstm_node->get_src_iter_feature_size()) &&
+                    lstm_node->get_num_timesteps() != 1)
+                {
+                    throw ngraph_error(
+                        "input sic{ht_1|ct_1} feature size is not equal to output dlc{ht_1|ct_1} "
+                        "feature size ");
+                }
+                build_rnn_functor(external_function, lstm_node, args, out);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Rnn)
+            {
+                auto rnn_node = static_cast<const ngraph::op::Rnn*>(node);
+                if (out[1].get_shape().size() == 2 &&
+                    (out[1].get_shape()[1] != rnn_node->get_src_iter_feature_size()))
+                {
+                    throw ngraph_error(
+                        "input sic{ht_1|ct_1} feature size is not equal to output dlc{ht_1|ct_1} "
+                        "feature size ");
+                }
+                build_rnn_functor(external_function, rnn_node, args, out);
+            }
+
+#define TI(x) type_index(typeid(x))
+
+            // The DEX LoopKernel evaluates its ops one block of elements at a time, so the
+            // intermediate results of a block stay in cache between ops.
+            enum class LoopKernelOp
+            {
+                Abs,
+                Add,
+                Divide,
+                Exp,
+                Log,
+                Maximum,
+                Minimum,
+                Multiply,
+                Negative,
+                Relu,
+                Sigmoid,
+                Sqrt,
+                Subtract,
+                Tanh
+            };
+
+            struct LoopKernelStep
+            {
+                LoopKernelOp op;
+                size_t src0;
+                size_t src1;
+                size_t dst;
+            };
+
+            static LoopKernelOp get_loop_kernel_op(const Node& node)
+            {
+                static const unordered_map<type_index, LoopKernelOp> ops{
+                    {TI(ngraph::op::Abs), LoopKernelOp::Abs},
+                    {TI(ngraph::op::Add), LoopKernelOp::Add},
+                    {TI(ngraph::op::Divide), LoopKernelOp::Divide},
+                    {TI(ngraph::op::Exp), LoopKernelOp::Exp},
+                    {TI(ngraph::op::Log), LoopKernelOp::Log},
+                    {TI(ngraph::op::Maximum), LoopKernelOp::Maximum},
+                    {TI(ngraph::op::Minimum), LoopKernelOp::Minimum},
+                    {TI(ngraph::op::Multiply), LoopKernelOp::Multiply},
+                    {TI(ngraph::op::Negative), LoopKernelOp::Negative},
+                    {TI(ngraph::op::Relu), LoopKernelOp::Relu},
+                    {TI(ngraph::op::Sigmoid), LoopKernelOp::Sigmoid},
+                    {TI(ngraph::op::Sqrt), LoopKernelOp::Sqrt},
+                    {TI(ngraph::op::Subtract), LoopKernelOp::Subtract},
+                    {TI(ngraph::op::Tanh), LoopKernelOp::Tanh}};
+
+                auto it = ops.find(TI(node));
+                if (it == ops.end())
+                {
+                    throw ngraph_error("Unsupported op '" + node.description() +
+                                       "' in LoopKernel");
+                }
+                return it->second;
+            }
+
+            template <typename ElementType>
+            static void run_loop_kernel_step(const LoopKernelStep& step,
+                                             ElementType* const* slots,
+                                             size_t count)
+            {
+                const ElementType* a = slots[step.src0];
+                const ElementType* b = slots[step.src1];
+                ElementType* y = slots[step.dst];
+                switch (step.op)
+                {
+                case LoopKernelOp::Abs:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = std::abs(a[i]);
+                    }
+                    break;
+                case LoopKernelOp::Add:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = a[i] + b[i];
+                    }
+                    break;
+                case LoopKernelOp::Divide:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = a[i] / b[i];
+                    }
+                    break;
+                case LoopKernelOp::Exp:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = std::exp(a[i]);
+                    }
+                    break;
+                case LoopKernelOp::Log:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = std::log(a[i]);
+                    }
+                    break;
+                case LoopKernelOp::Maximum:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = std::max(a[i], b[i]);
+                    }
+                    break;
+                case LoopKernelOp::Minimum:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = std::min(a[i], b[i]);
+                    }
+                    break;
+                case LoopKernelOp::Multiply:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = a[i] * b[i];
+                    }
+                    break;
+                case LoopKernelOp::Negative:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = -a[i];
+                    }
+                    break;
+                case LoopKernelOp::Relu:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = a[i] > 0 ? a[i] : 0;
+                    }
+                    break;
+                case LoopKernelOp::Sigmoid:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = 1 / (1 + std::exp(-a[i]));
+                    }
+                    break;
+                case LoopKernelOp::Sqrt:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = std::sqrt(a[i]);
+                    }
+                    break;
+                case LoopKernelOp::Subtract:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = a[i] - b[i];
+                    }
+                    break;
+                case LoopKernelOp::Tanh:
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        y[i] = std::tanh(a[i]);
+                    }
+                    break;
+                }
+            }
+
+            template <typename ElementType>
+            static void build_loop_kernel(CPU_ExternalFunction* external_function,
+                                          const runtime::cpu::op::LoopKernel* loop_kernel,
+                                          const vector<TensorViewWrapper>& args,
+                                          const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+
+                // Every value of the kernel lives in a slot: the arguments first, then the
+                // outputs, then one block-sized temporary per remaining op.
+                unordered_map<const Node*, size_t> slot_of;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    slot_of[loop_kernel->get_kernel_inputs().at(i).get()] = i;
+                }
+                for (size_t i = 0; i < out.size(); i++)
+                {
+                    slot_of[loop_kernel->get_kernel_outputs().at(i).get()] = args.size() + i;
+                }
+                const size_t first_temp = args.size() + out.size();
+                size_t num_slots = first_temp;
+
+                vector<LoopKernelStep> steps;
+                for (auto& n : loop_kernel->get_node_list())
+                {
+                    LoopKernelStep step;
+                    step.op = get_loop_kernel_op(*n);
+                    step.src0 = slot_of.at(n->get_argument(0).get());
+                    step.src1 = n->get_input_size() > 1 ? slot_of.at(n->get_argument(1).get())
+                                                        : step.src0;
+                    if (slot_of.count(n.get()) == 0)
+                    {
+                        slot_of[n.get()] = num_slots++;
+                    }
+                    step.dst = slot_of.at(n.get());
+                    steps.push_back(step);
+                }
+
+                vector<size_t> buffer_indices;
+                for (auto& arg : args)
+                {
+                    buffer_indices.push_back(external_function->get_buffer_index(arg.get_name()));
+                }
+                for (auto& result : out)
+                {
+                    buffer_indices.push_back(
+                        external_function->get_buffer_index(result.get_name()));
+                }
+
+                auto count = out[0].get_size();
+                const size_t block_size = 1024;
+
+                auto functor = [&, steps, buffer_indices, first_temp, num_slots, count, block_size](
+                    CPURuntimeContext* ctx) {
+                    size_t num_blocks = (count + block_size - 1) / block_size;
+#pragma omp parallel
+                    {
+                        vector<ElementType> temps((num_slots - first_temp) * block_size);
+                        vector<ElementType*> slots(num_slots);
+#pragma omp for
+                        for (size_t block = 0; block < num_blocks; block++)
+                        {
+                            size_t begin = block * block_size;
+                            size_t block_count = std::min(block_size, count - begin);
+                            for (size_t i = 0; i < first_temp; i++)
+                            {
+                                slots[i] =
+                                    static_cast<ElementType*>(ctx->buffer_data[buffer_indices[i]]) +
+                                    begin;
+                            }
+                            for (size_t i = first_temp; i < num_slots; i++)
+                            {
+                                slots[i] = temps.data() + (i - first_temp) * block_size;
+                            }
+                            for (auto& step : steps)
+                            {
+                                run_loop_kernel_step(step, slots.data(), block_count);
+                            }
+                        }
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::LoopKernel)
+            {
+                auto loop_kernel = static_cast<const ngraph::runtime::cpu::op::LoopKernel*>(node);
+                if (out[0].get_element_type() == element::f32)
+                {
+                    build_loop_kernel<float>(external_function, loop_kernel, args, out);
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    build_loop_kernel<double>(external_function, loop_kernel, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       out[0].get_element_type().c_type_string() +
+                                       " for LoopKernel");
+                }
+            }
+
+#ifdef NGRAPH_DISTRIBUTED
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AllReduce)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto data_type = MPI_FLOAT;
+                if (args[0].get_element_type() == element::f64)
+                {
+                    data_type = MPI_DOUBLE;
+                }
+                int count = static_cast<int>(out[0].get_size());
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&, data_type, count, arg_buffer_index, out_buffer_index](
+                    CPURuntimeContext* ctx) {
+                    MPI_Allreduce(ctx->buffer_data[arg_buffer_index],
+                                  ctx->buffer_data[out_buffer_index],
+                                  count,
+                                  data_type,
+                                  MPI_SUM,
+                                  MPI_COMM_WORLD);
+                };
+                functors.emplace_back(functor);
+            }
+#endif
+
+            const BuildOpMap build_dispatcher{
+                {TI(ngraph::op::Add), &runtime::cpu::Builder::build<ngraph::op::Add>},
+#ifdef NGRAPH_DISTRIBUTED
+                {TI(ngraph::op::AllReduce), &runtime::cpu::Builder::build<ngraph::op::AllReduce>},
+#endif
                 {TI(ngraph::op::Multiply), &runtime::cpu::Builder::build<ngraph::op::Multiply>},
-                {TI(ngraph::op::Parameter), &runtime::cpu::Builder::nop},
+                {TI(ngraph::op::Parameter), &runtime::cpu::Builder::build<ngraph::op::Parameter>},
                 {TI(ngraph::op::Abs), &runtime::cpu::Builder::build<ngraph::op::Abs>},
                 {TI(ngraph::op::Ceiling), &runtime::cpu::Builder::build<ngraph::op::Ceiling>},
                 {TI(ngraph::op::Relu), &runtime::cpu::Builder::build<ngraph::op::Relu>},
                 {TI(ngraph::op::Result), &runtime::cpu::Builder::build<ngraph::op::Result>},
                 {TI(ngraph::op::MatmulBias), &runtime::cpu::Builder::build<ngraph::op::MatmulBias>},
-                {TI(ngraph::op::Constant), &runtime::cpu::Builder::build<ngraph::op::Constant>}};
+                {TI(ngraph::op::Constant), &runtime::cpu::Builder::build<ngraph::op::Constant>},
+                {TI(ngraph::op::Acos), &runtime::cpu::Builder::build<ngraph::op::Acos>},
+                {TI(ngraph::op::Asin), &runtime::cpu::Builder::build<ngraph::op::Asin>},
+                {TI(ngraph::op::Atan), &runtime::cpu::Builder::build<ngraph::op::Atan>},
+                {TI(ngraph::op::Cos), &runtime::cpu::Builder::build<ngraph::op::Cos>},
+                {TI(ngraph::op::Cosh), &runtime::cpu::Builder::build<ngraph::op::Cosh>},
+                {TI(ngraph::op::Exp), &runtime::cpu::Builder::build<ngraph::op::Exp>},
+                {TI(ngraph::op::Floor), &runtime::cpu::Builder::build<ngraph::op::Floor>},
+                {TI(ngraph::op::Log), &runtime::cpu::Builder::build<ngraph::op::Log>},
+                {TI(ngraph::op::Negative), &runtime::cpu::Builder::build<ngraph::op::Negative>},
+                {TI(ngraph::op::Sign), &runtime::cpu::Builder::build<ngraph::op::Sign>},
+                {TI(ngraph::op::Sin), &runtime::cpu::Builder::build<ngraph::op::Sin>},
+                {TI(ngraph::op::Sinh), &runtime::cpu::Builder::build<ngraph::op::Sinh>},
+                {TI(ngraph::op::Sqrt), &runtime::cpu::Builder::build<ngraph::op::Sqrt>},
+                {TI(ngraph::op::Tan), &runtime::cpu::Builder::build<ngraph::op::Tan>},
+                {TI(ngraph::op::Tanh), &runtime::cpu::Builder::build<ngraph::op::Tanh>},
+                {TI(ngraph::op::Divide), &runtime::cpu::Builder::build<ngraph::op::Divide>},
+                {TI(ngraph::op::Maximum), &runtime::cpu::Builder::build<ngraph::op::Maximum>},
+                {TI(ngraph::op::Minimum), &runtime::cpu::Builder::build<ngraph::op::Minimum>},
+                {TI(ngraph::op::Power), &runtime::cpu::Builder::build<ngraph::op::Power>},
+                {TI(ngraph::op::Subtract), &runtime::cpu::Builder::build<ngraph::op::Subtract>},
+                {TI(ngraph::op::Equal), &runtime::cpu::Builder::build<ngraph::op::Equal>},
+                {TI(ngraph::op::NotEqual), &runtime::cpu::Builder::build<ngraph::op::NotEqual>},
+                {TI(ngraph::op::Greater), &runtime::cpu::Builder::build<ngraph::op::Greater>},
+                {TI(ngraph::op::GreaterEq), &runtime::cpu::Builder::build<ngraph::op::GreaterEq>},
+                {TI(ngraph::op::Less), &runtime::cpu::Builder::build<ngraph::op::Less>},
+                {TI(ngraph::op::LessEq), &runtime::cpu::Builder::build<ngraph::op::LessEq>},
+                {TI(ngraph::op::Not), &runtime::cpu::Builder::build<ngraph::op::Not>},
+                {TI(ngraph::op::And), &runtime::cpu::Builder::build<ngraph::op::And>},
+                {TI(ngraph::op::Or), &runtime::cpu::Builder::build<ngraph::op::Or>},
+                {TI(ngraph::op::Select), &runtime::cpu::Builder::build<ngraph::op::Select>},
+                {TI(ngraph::op::Convert), &runtime::cpu::Builder::build<ngraph::op::Convert>},
+                {TI(ngraph::op::Quantize), &runtime::cpu::Builder::build<ngraph::op::Quantize>},
+                {TI(ngraph::op::Dequantize),
+                 &runtime::cpu::Builder::build<ngraph::op::Dequantize>},
+                {TI(ngraph::op::GetOutputElement),
+                 &runtime::cpu::Builder::build<ngraph::op::GetOutputElement>},
+                {TI(ngraph::op::Broadcast), &runtime::cpu::Builder::build<ngraph::op::Broadcast>},
+                {TI(ngraph::op::Reshape), &runtime::cpu::Builder::build<ngraph::op::Reshape>},
+                {TI(ngraph::op::Concat), &runtime::cpu::Builder::build<ngraph::op::Concat>},
+                {TI(ngraph::op::Slice), &runtime::cpu::Builder::build<ngraph::op::Slice>},
+                {TI(ngraph::op::ReplaceSlice),
+                 &runtime::cpu::Builder::build<ngraph::op::ReplaceSlice>},
+                {TI(ngraph::op::Pad), &runtime::cpu::Builder::build<ngraph::op::Pad>},
+                {TI(ngraph::op::Reverse), &runtime::cpu::Builder::build<ngraph::op::Reverse>},
+                {TI(ngraph::op::ReverseSequence),
+                 &runtime::cpu::Builder::build<ngraph::op::ReverseSequence>},
+                {TI(ngraph::op::OneHot), &runtime::cpu::Builder::build<ngraph::op::OneHot>},
+                {TI(ngraph::op::Sum), &runtime::cpu::Builder::build<ngraph::op::Sum>},
+                {TI(ngraph::op::Product), &runtime::cpu::Builder::build<ngraph::op::Product>},
+                {TI(ngraph::op::Max), &runtime::cpu::Builder::build<ngraph::op::Max>},
+                {TI(ngraph::op::Min), &runtime::cpu::Builder::build<ngraph::op::Min>},
+                {TI(ngraph::op::Softmax), &runtime::cpu::Builder::build<ngraph::op::Softmax>},
+                {TI(ngraph::op::Dot), &runtime::cpu::Builder::build<ngraph::op::Dot>},
+                {TI(ngraph::op::BatchDot), &runtime::cpu::Builder::build<ngraph::op::BatchDot>},
+                {TI(ngraph::op::QuantizedDot),
+                 &runtime::cpu::Builder::build<ngraph::op::QuantizedDot>},
+                {TI(ngraph::op::Convolution),
+                 &runtime::cpu::Builder::build<ngraph::op::Convolution>},
+                {TI(ngraph::op::QuantizedConvolution),
+                 &runtime::cpu::Builder::build<ngraph::op::QuantizedConvolution>},
+                {TI(ngraph::op::ConvolutionBackpropFilters),
+                 &runtime::cpu::Builder::build<ngraph::op::ConvolutionBackpropFilters>},
+                {TI(ngraph::op::ConvolutionBackpropData),
+                 &runtime::cpu::Builder::build<ngraph::op::ConvolutionBackpropData>},
+                {TI(ngraph::op::ConvolutionRelu),
+                 &runtime::cpu::Builder::build<ngraph::op::ConvolutionRelu>},
+                {TI(ngraph::op::ConvolutionBias),
+                 &runtime::cpu::Builder::build<ngraph::op::ConvolutionBias>},
+                {TI(ngraph::op::ConvolutionBiasRelu),
+                 &runtime::cpu::Builder::build<ngraph::op::ConvolutionBiasRelu>},
+                {TI(ngraph::op::ConvolutionBiasBackpropFiltersBias),
+                 &runtime::cpu::Builder::build<ngraph::op::ConvolutionBiasBackpropFiltersBias>},
+                {TI(ngraph::op::GroupConvolution),
+                 &runtime::cpu::Builder::build<ngraph::op::GroupConvolution>},
+                {TI(ngraph::op::MaxPool), &runtime::cpu::Builder::build<ngraph::op::MaxPool>},
+                {TI(ngraph::op::MaxPoolWithIndices),
+                 &runtime::cpu::Builder::build<ngraph::op::MaxPoolWithIndices>},
+                {TI(ngraph::op::AvgPool), &runtime::cpu::Builder::build<ngraph::op::AvgPool>},
+                {TI(ngraph::op::AvgPoolBackprop),
+                 &runtime::cpu::Builder::build<ngraph::op::AvgPoolBackprop>},
+                {TI(ngraph::op::MaxPoolBackprop),
+                 &runtime::cpu::Builder::build<ngraph::op::MaxPoolBackprop>},
+                {TI(ngraph::op::MaxPoolWithIndicesBackprop),
+                 &runtime::cpu::Builder::build<ngraph::op::MaxPoolWithIndicesBackprop>},
+                {TI(ngraph::op::BatchNorm), &runtime::cpu::Builder::build<ngraph::op::BatchNorm>},
+                {TI(ngraph::op::BatchNormRelu),
+                 &runtime::cpu::Builder::build<ngraph::op::BatchNormRelu>},
+                {TI(ngraph::op::BatchNormBackprop),
+                 &runtime::cpu::Builder::build<ngraph::op::BatchNormBackprop>},
+                {TI(ngraph::op::ReluBackprop),
+                 &runtime::cpu::Builder::build<ngraph::op::ReluBackprop>},
+                {TI(ngraph::op::Sigmoid), &runtime::cpu::Builder::build<ngraph::op::Sigmoid>},
+                {TI(ngraph::op::SigmoidBackprop),
+                 &runtime::cpu::Builder::build<ngraph::op::SigmoidBackprop>},
+                {TI(ngraph::op::SigmoidMultiply),
+                 &runtime::cpu::Builder::build<ngraph::op::SigmoidMultiply>},
+                {TI(ngraph::op::SigmoidMultiplyBackprop),
+                 &runtime::cpu::Builder::build<ngraph::op::SigmoidMultiplyBackprop>},
+                {TI(ngraph::runtime::cpu::op::ConvertLayout),
+                 &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::ConvertLayout>},
+                {TI(ngraph::runtime::cpu::op::LoopKernel),
+                 &runtime::cpu::Builder::build<ngraph::runtime::cpu::op::LoopKernel>},
+                {TI(ngraph::op::Lstm), &runtime::cpu::Builder::build<ngraph::op::Lstm>},
+                {TI(ngraph::op::Rnn), &runtime::cpu::Builder::build<ngraph::op::Rnn>}};
         }
     }
 }
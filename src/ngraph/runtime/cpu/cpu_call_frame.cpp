@@ -15,6 +15,8 @@
 *******************************************************************************/
 
 #include <algorithm>
+#include <cstdlib>
+#include <thread>
 
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
@@ -29,13 +31,25 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
                                            EntryPoint compiled_function)
     : m_external_function(external_function)
     , m_compiled_function(compiled_function)
+    , m_last_context(nullptr)
+    , m_max_contexts(std::max(1u, std::thread::hardware_concurrency()))
 {
-    setup_runtime_context();
+    if (const char* concurrency = std::getenv("NGRAPH_CPU_CONCURRENCY"))
+    {
+        m_max_contexts = std::max(1, std::atoi(concurrency));
+    }
+
+    auto ctx = setup_runtime_context();
+    m_contexts.push_back(ctx);
+    m_idle_contexts.push_back(ctx);
 }
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
-    cleanup_runtime_context();
+    for (auto ctx : m_contexts)
+    {
+        cleanup_runtime_context(ctx);
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::call(
@@ -45,15 +59,27 @@ void runtime::cpu::CPU_CallFrame::call(
     vector<void*> inputs;
     vector<void*> outputs;
 
-    propagate_layouts(input_tvs, m_external_function->get_parameter_layout_descriptors());
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+    CPURuntimeContext* ctx;
+    {
+        unique_lock<mutex> lock(m_mutex);
+
+        propagate_layouts(input_tvs, m_external_function->get_parameter_layout_descriptors());
+        propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+
+        ctx = acquire_runtime_context(lock);
+    }
+    // Intermediates cached in a context are only valid if that context executed
+    // the most recent call
+    bool same_context = (m_last_context.exchange(ctx) == ctx);
 
     for (size_t i = 0; i < input_tvs.size(); i++)
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
             static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
-        ctx->p_en[i] = tv->get_stale();
-        inputs.push_back(tv->get_data_ptr());
+        void* data_ptr = tv->get_data_ptr();
+        ctx->p_en[i] = tv->get_stale() || !same_context || ctx->last_inputs[i] != data_ptr;
+        ctx->last_inputs[i] = data_ptr;
+        inputs.push_back(data_ptr);
     }
     for (size_t i = 0; i < output_tvs.size(); i++)
     {
@@ -62,18 +88,66 @@ void runtime::cpu::CPU_CallFrame::call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    try
+    {
+        execute(ctx, inputs, outputs);
+    }
+    catch (...)
+    {
+        release_runtime_context(ctx);
+        throw;
+    }
+
+    release_runtime_context(ctx);
+}
+
+shared_ptr<runtime::cpu::CPU_Binding>
+    runtime::cpu::CPU_CallFrame::bind(const vector<shared_ptr<runtime::TensorView>>& output_tvs,
+                                      const vector<shared_ptr<runtime::TensorView>>& input_tvs)
+{
+    CPURuntimeContext* ctx;
+    {
+        lock_guard<mutex> lock(m_mutex);
+
+        propagate_layouts(input_tvs, m_external_function->get_parameter_layout_descriptors());
+        propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
+
+        // Bindings hold their context for their whole lifetime so it is not taken from the
+        // pool used by call
+        ctx = setup_runtime_context();
+    }
+
+    return shared_ptr<CPU_Binding>(
+        new CPU_Binding(shared_from_this(), ctx, output_tvs, input_tvs));
+}
+
+void runtime::cpu::CPU_CallFrame::execute(CPURuntimeContext* ctx,
+                                          vector<void*>& inputs,
+                                          vector<void*>& outputs)
+{
     // Invoke compiled computation
-    if (!m_external_function->is_direct_execution())
+    try
     {
-        m_compiled_function(inputs.data(), outputs.data(), ctx);
+        if (!m_external_function->is_direct_execution())
+        {
+            m_compiled_function(inputs.data(), outputs.data(), ctx);
+        }
+        else
+        {
+            m_external_function->get_executor()(ctx, inputs, outputs);
+        }
     }
-    else
+    catch (...)
     {
-        m_external_function->get_executor()(ctx, inputs, outputs);
+        // Partially executed contexts must recompute everything on their next use
+        ctx->first_iteration = true;
+        throw;
     }
+    ctx->first_iteration = false;
 
     if (runtime::cpu::IsTracingEnabled())
     {
+        lock_guard<mutex> lock(m_mutex);
         GenerateTimeline(m_external_function->get_op_attrs(),
                          ctx->op_durations,
                          m_external_function->get_function_name() + ".timeline.json");
@@ -100,16 +174,45 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::setup_runtime_context()
+runtime::cpu::CPURuntimeContext*
+    runtime::cpu::CPU_CallFrame::acquire_runtime_context(std::unique_lock<std::mutex>& lock)
 {
-    ctx = new CPURuntimeContext;
+    if (m_idle_contexts.empty() && m_contexts.size() < m_max_contexts)
+    {
+        auto ctx = setup_runtime_context();
+        m_contexts.push_back(ctx);
+        return ctx;
+    }
+
+    m_context_available.wait(lock, [this]() { return !m_idle_contexts.empty(); });
+    auto ctx = m_idle_contexts.back();
+    m_idle_contexts.pop_back();
+    return ctx;
+}
+
+void runtime::cpu::CPU_CallFrame::release_runtime_context(CPURuntimeContext* ctx)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_idle_contexts.push_back(ctx);
+    }
+    m_context_available.notify_one();
+}
+
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::setup_runtime_context()
+{
+    auto ctx = new CPURuntimeContext;
 
     ctx->op_durations = nullptr;
     if (runtime::cpu::IsTracingEnabled())
     {
         ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
     }
-    ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+    size_t num_parameters = m_external_function->get_parameter_layout_descriptors().size();
+    ctx->p_en = new bool[num_parameters];
+    ctx->last_inputs.resize(num_parameters, nullptr);
+    ctx->t_en = new bool[m_external_function->get_tensor_enable_count()]();
+    ctx->first_iteration = true;
     // Create temporary buffer pools
     size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
     for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
@@ -117,18 +220,86 @@ void runtime::cpu::CPU_CallFrame::setup_runtime_context()
         auto buffer = new AlignedBuffer(buffer_size, alignment);
         ctx->memory_buffers.push_back(buffer);
     }
+    if (m_external_function->is_direct_execution())
+    {
+        m_external_function->initialize_buffer_data(ctx);
+    }
     const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
-    ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
-    ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces().data();
+    // MKLDNN primitives and workspaces hold per-call state. The first context uses the
+    // emitter's and every additional context gets private copies.
+    if (m_contexts.empty())
+    {
+        ctx->mkldnn_primitives = mkldnn_emitter->get_mkldnn_primitives().data();
+        ctx->workspace_ptrs = mkldnn_emitter->get_mkldnn_workspaces();
+    }
+    else
+    {
+        ctx->owned_mkldnn_primitives = mkldnn_emitter->create_mkldnn_primitives();
+        ctx->mkldnn_primitives = ctx->owned_mkldnn_primitives.data();
+        for (auto workspace_size : mkldnn_emitter->get_mkldnn_workspace_sizes())
+        {
+            auto buffer = new AlignedBuffer(workspace_size, alignment);
+            ctx->workspace_buffers.push_back(buffer);
+            ctx->workspace_ptrs.push_back(static_cast<char*>(buffer->get_ptr()));
+        }
+    }
+    ctx->mkldnn_workspaces = ctx->workspace_ptrs.data();
+    return ctx;
 }
 
-void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
+void runtime::cpu::CPU_CallFrame::cleanup_runtime_context(CPURuntimeContext* ctx)
 {
     delete[] ctx->op_durations;
     delete[] ctx->p_en;
+    delete[] ctx->t_en;
     for (auto buffer : ctx->memory_buffers)
     {
         delete buffer;
     }
+    for (auto buffer : ctx->workspace_buffers)
+    {
+        delete buffer;
+    }
+    for (auto primitive : ctx->owned_mkldnn_primitives)
+    {
+        delete primitive;
+    }
     delete ctx;
 }
+
+runtime::cpu::CPU_Binding::CPU_Binding(shared_ptr<CPU_CallFrame> call_frame,
+                                       CPURuntimeContext* ctx,
+                                       const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                       const vector<shared_ptr<runtime::TensorView>>& inputs)
+    : m_call_frame(call_frame)
+    , m_context(ctx)
+{
+    for (auto& tv : inputs)
+    {
+        m_tensors.push_back(tv);
+        m_input_tensors.push_back(tv.get());
+        m_inputs.push_back(static_pointer_cast<runtime::cpu::CPUTensorView>(tv)->get_data_ptr());
+    }
+    for (auto& tv : outputs)
+    {
+        m_tensors.push_back(tv);
+        m_outputs.push_back(static_pointer_cast<runtime::cpu::CPUTensorView>(tv)->get_data_ptr());
+    }
+}
+
+runtime::cpu::CPU_Binding::~CPU_Binding()
+{
+    m_call_frame->cleanup_runtime_context(m_context);
+}
+
+void runtime::cpu::CPU_Binding::execute()
+{
+    // Input pointers never change so only staleness and the last context are checked
+    bool same_context = (m_call_frame->m_last_context.exchange(m_context) == m_context);
+    for (size_t i = 0; i < m_input_tensors.size(); i++)
+    {
+        m_context->p_en[i] = m_input_tensors[i]->get_stale() || !same_context;
+    }
+
+    m_call_frame->execute(m_context, m_inputs, m_outputs);
+}
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "ngraph/function.hpp"
@@ -31,6 +34,7 @@ namespace ngraph
     {
         namespace cpu
         {
+            class CPU_Binding;
             class CPU_CallFrame;
             class CPU_ExternalFunction;
 
@@ -39,7 +43,7 @@ namespace ngraph
             using EntryPoint = std::function<EntryPoint_t>;
 
             // Compile and execute graphs
-            class CPU_CallFrame
+            class CPU_CallFrame : public std::enable_shared_from_this<CPU_CallFrame>
             {
             public:
                 CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
@@ -49,19 +53,75 @@ namespace ngraph
                 /// @brief Invoke the function with values matching the signature of the function.
                 ///
                 /// Tuples will be expanded into their tensor views to build the call frame.
+                /// Concurrent calls are supported; each in-flight call executes on its own
+                /// runtime context.
                 void call(const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
                           const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
 
+                /// @brief Resolve the tensors of a call once for repeated execution.
+                ///
+                /// The tensors must match the signature of the function.
+                std::shared_ptr<CPU_Binding>
+                    bind(const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                         const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
                 void propagate_layouts(const std::vector<std::shared_ptr<runtime::TensorView>>& tvs,
                                        const LayoutDescriptorPtrs& layouts) const;
 
-                void setup_runtime_context();
-                void cleanup_runtime_context();
+                CPURuntimeContext* setup_runtime_context();
+                void cleanup_runtime_context(CPURuntimeContext* ctx);
 
             protected:
+                friend class CPU_Binding;
+
+                CPURuntimeContext* acquire_runtime_context(std::unique_lock<std::mutex>& lock);
+                void release_runtime_context(CPURuntimeContext* ctx);
+                void execute(CPURuntimeContext* ctx,
+                             std::vector<void*>& inputs,
+                             std::vector<void*>& outputs);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
                 EntryPoint m_compiled_function;
-                CPURuntimeContext* ctx;
+
+                // Runtime contexts are created on demand, up to m_max_contexts
+                // (NGRAPH_CPU_CONCURRENCY), and reused by subsequent calls
+                std::vector<CPURuntimeContext*> m_contexts;
+                std::vector<CPURuntimeContext*> m_idle_contexts;
+                std::atomic<CPURuntimeContext*> m_last_context;
+                size_t m_max_contexts;
+                std::mutex m_mutex;
+                std::condition_variable m_context_available;
+            };
+
+            // Tensors of a call resolved by CPU_CallFrame::bind
+            class CPU_Binding
+            {
+            public:
+                ~CPU_Binding();
+
+                /// @brief Invoke the function on the bound tensors.
+                ///
+                /// The binding owns a runtime context, including private MKLDNN primitives, so
+                /// execution bypasses the call frame's context pool and binds tensors without
+                /// locking or allocating. Kernels may still allocate internally, and tracing
+                /// locks the call frame to write the timeline. A binding must not be executed
+                /// concurrently with itself.
+                void execute();
+
+            private:
+                friend class CPU_CallFrame;
+
+                CPU_Binding(std::shared_ptr<CPU_CallFrame> call_frame,
+                            CPURuntimeContext* ctx,
+                            const std::vector<std::shared_ptr<runtime::TensorView>>& outputs,
+                            const std::vector<std::shared_ptr<runtime::TensorView>>& inputs);
+
+                std::shared_ptr<CPU_CallFrame> m_call_frame;
+                CPURuntimeContext* m_context;
+                std::vector<std::shared_ptr<runtime::TensorView>> m_tensors;
+                std::vector<runtime::TensorView*> m_input_tensors;
+                std::vector<void*> m_inputs;
+                std::vector<void*> m_outputs;
             };
         }
     }
@@ -17,7 +17,9 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <numeric>
+#include <sstream>
 #include <string>
 #include <typeindex>
 #include <unordered_map>
@@ -40,6 +42,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -68,6 +71,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -102,9 +106,12 @@
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/util.hpp"
 
@@ -126,6 +133,15 @@ static string eigen_vector_format(const runtime::cpu::TensorViewWrapper& tvi)
     return "fmt::V{" + to_string(tvi.get_size()) + "}";
 }
 
+// Quantization scales are written with enough digits to read back the same double
+static string emit_scale(double scale)
+{
+    stringstream ss;
+    ss.precision(numeric_limits<double>::max_digits10);
+    ss << scale;
+    return ss.str();
+}
+
 static string eigen_matrix_format(const ngraph::Shape& shape, const ngraph::Strides& strides)
 {
     stringstream ss;
@@ -1018,6 +1034,26 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedDot)
+            {
+                auto qdot = static_cast<const ngraph::op::QuantizedDot*>(node);
+
+                writer << "reference::quantized_dot(" << args[0].get_name() << ",\n";
+                writer << "                         " << args[1].get_name() << ",\n";
+                writer << "                         " << out[0].get_name() << ",\n";
+                writer << "                         {" << join(args[0].get_shape()) << "},\n";
+                writer << "                         {" << join(args[1].get_shape()) << "},\n";
+                writer << "                         {" << join(out[0].get_shape()) << "},\n";
+                writer << "                         " << qdot->get_reduction_axes_count() << ",\n";
+                writer << "                         " << emit_scale(qdot->get_arg0_scale()) << ", "
+                       << qdot->get_arg0_zero_point() << ",\n";
+                writer << "                         " << emit_scale(qdot->get_arg1_scale()) << ", "
+                       << qdot->get_arg1_zero_point() << ",\n";
+                writer << "                         " << emit_scale(qdot->get_output_scale())
+                       << ", " << qdot->get_output_zero_point() << ");\n";
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::GetOutputElement)
             {
@@ -1571,6 +1607,28 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Quantize)
+            {
+                auto quantize = static_cast<const ngraph::op::Quantize*>(node);
+                writer << "reference::quantize(" << args[0].get_name() << ",\n";
+                writer << "                    " << out[0].get_name() << ",\n";
+                writer << "                    " << out[0].get_size() << ",\n";
+                writer << "                    " << emit_scale(quantize->get_scale()) << ",\n";
+                writer << "                    " << quantize->get_zero_point() << ");\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Dequantize)
+            {
+                auto dequantize = static_cast<const ngraph::op::Dequantize*>(node);
+                writer << "reference::dequantize(" << args[0].get_name() << ",\n";
+                writer << "                      " << out[0].get_name() << ",\n";
+                writer << "                      " << out[0].get_size() << ",\n";
+                writer << "                      " << emit_scale(dequantize->get_scale()) << ",\n";
+                writer << "                      " << dequantize->get_zero_point() << ");\n";
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Constant)
             {
@@ -2810,6 +2868,39 @@ namespace ngraph
                 }
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::QuantizedConvolution)
+            {
+                auto qconv = static_cast<const ngraph::op::QuantizedConvolution*>(node);
+
+                writer << "reference::quantized_convolution(" << args[0].get_name() << ",\n";
+                writer << "                                 " << args[1].get_name() << ",\n";
+                writer << "                                 " << out[0].get_name() << ",\n";
+                writer << "                                 {" << join(args[0].get_shape())
+                       << "},\n";
+                writer << "                                 {" << join(args[1].get_shape())
+                       << "},\n";
+                writer << "                                 {" << join(out[0].get_shape())
+                       << "},\n";
+                writer << "                                 {"
+                       << join(qconv->get_window_movement_strides()) << "},\n";
+                writer << "                                 {"
+                       << join(qconv->get_window_dilation_strides()) << "},\n";
+                writer << "                                 {" << join(qconv->get_padding_below())
+                       << "},\n";
+                writer << "                                 {" << join(qconv->get_padding_above())
+                       << "},\n";
+                writer << "                                 {"
+                       << join(qconv->get_data_dilation_strides()) << "},\n";
+                writer << "                                 " << emit_scale(qconv->get_data_scale())
+                       << ", " << qconv->get_data_zero_point() << ",\n";
+                writer << "                                 "
+                       << emit_scale(qconv->get_filter_scale()) << ",\n";
+                writer << "                                 "
+                       << emit_scale(qconv->get_output_scale()) << ", "
+                       << qconv->get_output_zero_point() << ");\n";
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::ConvolutionBackpropFilters)
             {
@@ -4279,6 +4370,39 @@ namespace ngraph
                 auto dims = out[0].get_shape().size();
                 auto axes = softmax->get_axes();
 
+                // Softmax over the innermost axes: one fused pass per row, rows in parallel
+                size_t row_size = runtime::reference::softmax_innermost_row_size(shape, axes);
+                if (row_size != 0)
+                {
+                    writer << "#pragma omp parallel for\n";
+                    writer << "for (size_t i = 0; i < " << shape_size(shape) / row_size
+                           << "; ++i)\n";
+                    writer.block_begin();
+                    writer << "const " << type << "* arg = " << args[0].get_name() << " + i * "
+                           << row_size << ";\n";
+                    writer << type << "* out = " << out[0].get_name() << " + i * " << row_size
+                           << ";\n";
+                    writer << type << " m = arg[0];\n";
+                    writer << "for (size_t j = 1; j < " << row_size << "; ++j)\n";
+                    writer.block_begin();
+                    writer << "m = arg[j] > m ? arg[j] : m;\n";
+                    writer.block_end();
+                    writer << type << " d = 0;\n";
+                    writer << "for (size_t j = 0; j < " << row_size << "; ++j)\n";
+                    writer.block_begin();
+                    writer << "out[j] = exp(arg[j] - m);\n";
+                    writer << "d += out[j];\n";
+                    writer.block_end();
+                    writer << "d = 1 / d;\n";
+                    writer << "for (size_t j = 0; j < " << row_size << "; ++j)\n";
+                    writer.block_begin();
+                    writer << "out[j] *= d;\n";
+                    writer.block_end();
+                    writer.block_end();
+                    writer.block_end();
+                    return;
+                }
+
                 // create arg/out if 1d
                 if (dims < 1)
                 {
@@ -4523,17 +4647,47 @@ namespace ngraph
                 auto abse =
                     std::bind(emit_function_call, std::string("std::abs"), std::placeholders::_1);
                 auto adde = std::bind(emit_infix_operator, std::string("+"), std::placeholders::_1);
+                auto dive = std::bind(emit_infix_operator, std::string("/"), std::placeholders::_1);
+                auto expe =
+                    std::bind(emit_function_call, std::string("std::exp"), std::placeholders::_1);
+                auto loge =
+                    std::bind(emit_function_call, std::string("std::log"), std::placeholders::_1);
+                auto maxe =
+                    std::bind(emit_function_call, std::string("std::max"), std::placeholders::_1);
+                auto mine =
+                    std::bind(emit_function_call, std::string("std::min"), std::placeholders::_1);
+                auto mule = std::bind(emit_infix_operator, std::string("*"), std::placeholders::_1);
                 auto nege =
                     std::bind(emit_prefix_operator, std::string("-"), std::placeholders::_1);
+                auto relue = [](const std::vector<std::string>& args) {
+                    return "(" + args.at(0) + " > 0 ? " + args.at(0) + " : 0)";
+                };
+                auto sigmoide = [](const std::vector<std::string>& args) {
+                    return "1 / (1 + std::exp(-" + args.at(0) + "))";
+                };
+                auto sqrte =
+                    std::bind(emit_function_call, std::string("std::sqrt"), std::placeholders::_1);
                 auto sube = std::bind(emit_infix_operator, std::string("-"), std::placeholders::_1);
+                auto tanhe =
+                    std::bind(emit_function_call, std::string("std::tanh"), std::placeholders::_1);
 
                 return std::unordered_map<
                     std::type_index,
                     std::function<std::string(const std::vector<std::string>&)>>{
                     {TI(ngraph::op::Abs), abse},
                     {TI(ngraph::op::Add), adde},
+                    {TI(ngraph::op::Divide), dive},
+                    {TI(ngraph::op::Exp), expe},
+                    {TI(ngraph::op::Log), loge},
+                    {TI(ngraph::op::Maximum), maxe},
+                    {TI(ngraph::op::Minimum), mine},
+                    {TI(ngraph::op::Multiply), mule},
                     {TI(ngraph::op::Negative), nege},
+                    {TI(ngraph::op::Relu), relue},
+                    {TI(ngraph::op::Sigmoid), sigmoide},
+                    {TI(ngraph::op::Sqrt), sqrte},
                     {TI(ngraph::op::Subtract), sube},
+                    {TI(ngraph::op::Tanh), tanhe},
                 };
             }
 
@@ -4555,7 +4709,7 @@ namespace ngraph
                 for (size_t i = 0; i < args.size(); i++)
                 {
                     std::string sname = std::string(args[i].get_name()) + "[i]";
-                    auto entry = std::make_pair(clk->get_argument(i), sname);
+                    auto entry = std::make_pair(clk->get_kernel_inputs().at(i), sname);
                     loop_symbol_table.insert(entry);
                 }
 
@@ -14,14 +14,22 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
 #include <cstdlib>
 #include <fstream>
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <typeindex>
 #include <typeinfo>
+#include <unistd.h>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "ngraph/codegen/code_writer.hpp"
 #include "ngraph/codegen/compiler.hpp"
@@ -50,6 +58,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -78,6 +87,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -100,6 +110,7 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
@@ -128,6 +139,8 @@
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 #include "ngraph/runtime/cpu/op/max_pool_with_indices.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
@@ -135,8 +148,11 @@
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_quantization.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_shuffle_folding.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
@@ -145,6 +161,10 @@
 #include "ngraph/op/allreduce.hpp"
 #endif
 
+#ifdef NGRAPH_TBB_ENABLE
+#include <tbb/task_group.h>
+#endif
+
 using namespace std;
 using namespace ngraph;
 
@@ -203,6 +223,155 @@ static string emit_string_array(const vector<string>& s, size_t max_line_length)
     return ss.str();
 }
 
+// Byte range of a temporary in the memory pool of its function
+using PoolRange = pair<size_t, size_t>;
+
+static unordered_map<string, PoolRange>
+    get_pool_ranges(const list<shared_ptr<Node>>& ordered_ops)
+{
+    unordered_map<string, PoolRange> pool_ranges;
+    for (auto& node : ordered_ops)
+    {
+        for (auto tensor : node->liveness_new_list)
+        {
+            size_t size = runtime::cpu::mkldnn_utils::get_allocation_size(*tensor);
+            pool_ranges[tensor->get_name()] =
+                PoolRange(tensor->get_pool_offset(), tensor->get_pool_offset() + size);
+        }
+    }
+    return pool_ranges;
+}
+
+// Orders accesses to the temporary pool. The pool is split into disjoint segments, each
+// remembering the last task that wrote it and the tasks that read it since, so a new access
+// only has to look at the segments it overlaps.
+template <typename Task>
+class PoolAccessTracker
+{
+public:
+    // Tasks that have to finish before task can read range
+    void read(const PoolRange& range, const Task& task, set<Task>& predecessors)
+    {
+        for (Segment* segment : segments(range))
+        {
+            if (segment->has_writer && segment->writer != task)
+            {
+                predecessors.insert(segment->writer);
+            }
+            segment->readers.push_back(task);
+        }
+    }
+
+    // Tasks that have to finish before task can overwrite range
+    void write(const PoolRange& range, const Task& task, set<Task>& predecessors)
+    {
+        for (Segment* segment : segments(range))
+        {
+            if (segment->has_writer && segment->writer != task)
+            {
+                predecessors.insert(segment->writer);
+            }
+            for (auto& reader : segment->readers)
+            {
+                if (reader != task)
+                {
+                    predecessors.insert(reader);
+                }
+            }
+            segment->has_writer = true;
+            segment->writer = task;
+            segment->readers.clear();
+        }
+    }
+
+private:
+    struct Segment
+    {
+        size_t end;
+        bool has_writer;
+        Task writer;
+        vector<Task> readers;
+    };
+
+    // Splits the segment containing offset so that a segment starts at offset
+    void split(size_t offset)
+    {
+        auto it = m_segments.upper_bound(offset);
+        if (it == m_segments.begin())
+        {
+            return;
+        }
+        --it;
+        if (it->first < offset && offset < it->second.end)
+        {
+            Segment tail = it->second;
+            it->second.end = offset;
+            m_segments.emplace(offset, tail);
+        }
+    }
+
+    // Segments covering range, creating empty ones for the parts not accessed so far
+    vector<Segment*> segments(const PoolRange& range)
+    {
+        vector<Segment*> result;
+        if (range.first >= range.second)
+        {
+            return result;
+        }
+        split(range.first);
+        split(range.second);
+        size_t offset = range.first;
+        auto it = m_segments.lower_bound(range.first);
+        while (offset < range.second)
+        {
+            if (it == m_segments.end() || it->first > offset)
+            {
+                size_t end = it == m_segments.end() ? range.second : min(it->first, range.second);
+                it = m_segments.emplace_hint(it, offset, Segment{end, false, Task(), {}});
+            }
+            result.push_back(&it->second);
+            offset = it->second.end;
+            ++it;
+        }
+        return result;
+    }
+
+    map<size_t, Segment> m_segments;
+};
+
+// Temporaries whose pool range is reused by another temporary. Their contents do not survive
+// until the next call, so the ops producing them cannot be skipped when their inputs are
+// unchanged.
+static unordered_set<string>
+    get_shared_pool_tensors(const unordered_map<string, PoolRange>& pool_ranges)
+{
+    vector<pair<PoolRange, const string*>> sorted;
+    for (auto& pool_range : pool_ranges)
+    {
+        if (pool_range.second.first < pool_range.second.second)
+        {
+            sorted.emplace_back(pool_range.second, &pool_range.first);
+        }
+    }
+    sort(sorted.begin(), sorted.end());
+
+    // A range overlaps an earlier one if it starts before the furthest end so far, and a later
+    // one if the next range starts before its end.
+    unordered_set<string> shared_tensors;
+    size_t furthest_end = 0;
+    for (size_t i = 0; i < sorted.size(); i++)
+    {
+        const PoolRange& range = sorted[i].first;
+        if ((i > 0 && range.first < furthest_end) ||
+            (i + 1 < sorted.size() && sorted[i + 1].first.first < range.second))
+        {
+            shared_tensors.insert(*sorted[i].second);
+        }
+        furthest_end = max(furthest_end, range.second);
+    }
+    return shared_tensors;
+}
+
 static StaticInitializers s_static_initializers;
 
 #define TI(x) type_index(typeid(x))
@@ -214,6 +383,7 @@ static const runtime::cpu::OpMap dispatcher{
 #endif
     {TI(ngraph::op::MatmulBias), &runtime::cpu::CPU_Emitter::emit<op::MatmulBias>},
     {TI(ngraph::op::Dot), &runtime::cpu::CPU_Emitter::emit<op::Dot>},
+    {TI(ngraph::op::QuantizedDot), &runtime::cpu::CPU_Emitter::emit<op::QuantizedDot>},
     {TI(ngraph::op::Multiply), &runtime::cpu::CPU_Emitter::emit<op::Multiply>},
     {TI(ngraph::op::Parameter), &runtime::cpu::CPU_Emitter::nop},
     {TI(ngraph::op::Abs), &runtime::cpu::CPU_Emitter::emit<op::Abs>},
@@ -236,6 +406,8 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Subtract), &runtime::cpu::CPU_Emitter::emit<op::Subtract>},
     {TI(ngraph::op::Broadcast), &runtime::cpu::CPU_Emitter::emit<op::Broadcast>},
     {TI(ngraph::op::Convert), &runtime::cpu::CPU_Emitter::emit<op::Convert>},
+    {TI(ngraph::op::Quantize), &runtime::cpu::CPU_Emitter::emit<op::Quantize>},
+    {TI(ngraph::op::Dequantize), &runtime::cpu::CPU_Emitter::emit<op::Dequantize>},
     {TI(ngraph::op::Constant), &runtime::cpu::CPU_Emitter::emit<op::Constant>},
     {TI(ngraph::op::Reshape), &runtime::cpu::CPU_Emitter::emit<op::Reshape>},
     {TI(ngraph::op::FunctionCall), &runtime::cpu::CPU_Emitter::emit<op::FunctionCall>},
@@ -259,6 +431,8 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Ceiling), &runtime::cpu::CPU_Emitter::emit<op::Ceiling>},
     {TI(ngraph::op::Sqrt), &runtime::cpu::CPU_Emitter::emit<op::Sqrt>},
     {TI(ngraph::op::Convolution), &runtime::cpu::CPU_Emitter::emit<op::Convolution>},
+    {TI(ngraph::op::QuantizedConvolution),
+     &runtime::cpu::CPU_Emitter::emit<op::QuantizedConvolution>},
     {TI(ngraph::op::ConvolutionBackpropFilters),
      &runtime::cpu::CPU_Emitter::emit<op::ConvolutionBackpropFilters>},
     {TI(ngraph::op::ConvolutionBackpropData),
@@ -320,9 +494,12 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     , m_compiled_function(nullptr)
     , m_emit_timing(false)
     , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    , m_tensor_enable_count(0)
     , m_function_name(function->get_name())
     , m_is_built(false)
     , m_direct_execution(std::getenv("NGRAPH_DEX") != nullptr)
+    , m_disable_memory_sharing(std::getenv("NGRAPH_CPU_DISABLE_MEMORY_SHARING") != nullptr)
+    , m_use_int8(std::getenv("NGRAPH_CPU_INT8") != nullptr)
 {
 }
 
@@ -353,24 +530,43 @@ void runtime::cpu::CPU_ExternalFunction::compile()
     pass_manager.register_pass<runtime::cpu::pass::CPUBatchFusion>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
+    if (m_use_int8)
+    {
+        pass_manager.register_pass<runtime::cpu::pass::CPUQuantization>();
+    }
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPUPostLayoutOptimizations>();
     pass_manager.register_pass<runtime::cpu::pass::CPUShuffleFolding>();
     pass_manager.register_pass<ngraph::pass::ResultCopyElimination>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUMemoryOptimization>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(s_memory_pool_alignment, true);
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        s_memory_pool_alignment,
+        m_disable_memory_sharing,
+        runtime::cpu::mkldnn_utils::get_allocation_size,
+        ngraph::pass::MemoryLayout::Planner::INTERVAL);
     pass_manager.run_passes(m_function);
 
     unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
-        function_ordered_ops.insert({current_function, current_function->get_ordered_ops()});
+        function_ordered_ops.insert({current_function, *current_function->get_ordered_ops()});
     }
 
+    // Backend code generation threads, the IR is still optimized once
+    size_t codegen_thread_count = thread::hardware_concurrency();
+    if (const char* env = std::getenv("NGRAPH_CPU_CODEGEN_THREADS"))
+    {
+        codegen_thread_count = strtoul(env, nullptr, 10);
+    }
+    codegen_thread_count = max<size_t>(codegen_thread_count, 1);
+
     codegen::CodeWriter writer;
 
     writer +=
@@ -388,6 +584,7 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/max_pool.hpp"
@@ -397,6 +594,9 @@ void runtime::cpu::CPU_ExternalFunction::compile()
 #include "ngraph/runtime/reference/or.hpp"
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/quantized_convolution.hpp"
+#include "ngraph/runtime/reference/quantized_dot.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -489,7 +689,10 @@ using namespace ngraph::runtime;
         writer << "\n";
     }
 
+    // Constant addresses are bound after loading so that the generated code does not
+    // depend on the addresses of this process and can be cached
     writer << "// Declare all constants\n";
+    vector<string> constant_bindings;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
         for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
@@ -497,15 +700,26 @@ using namespace ngraph::runtime;
             const ngraph::op::Constant* c = dynamic_cast<ngraph::op::Constant*>(node.get());
             if (c)
             {
-                m_active_constants.push_back(node);
                 shared_ptr<descriptor::TensorView> tv = node->get_outputs()[0].get_tensor_view();
                 string type = tv->get_tensor().get_element_type().c_type_string();
-                writer << "static " << type << "* " << tv->get_tensor().get_name() << " = (("
-                       << type << "*)(" << c->get_data_ptr() << "));\n";
+                writer << "static " << type << "* " << tv->get_tensor().get_name() << ";\n";
+                constant_bindings.push_back(tv->get_tensor().get_name() + " = (" + type +
+                                            "*)constants[" +
+                                            to_string(m_active_constants.size()) + "];");
+                m_active_constants.push_back(node);
                 m_variable_name_map[tv->get_tensor().get_name()] = tv->get_tensor().get_name();
             }
         }
     }
+    writer << "extern \"C\" void bind_constants(void** constants)\n";
+    writer << "{\n";
+    writer.indent++;
+    for (const string& binding : constant_bindings)
+    {
+        writer << binding << "\n";
+    }
+    writer.indent--;
+    writer << "}\n\n";
 
     writer << "// Declare all functions\n";
     for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
@@ -586,6 +800,8 @@ using namespace ngraph::runtime;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
         auto ordered_ops = function_ordered_ops.at(current_function);
+        auto pool_ranges = get_pool_ranges(ordered_ops);
+        auto shared_tensors = get_shared_pool_tensors(pool_ranges);
         set<string> output_names;
         for (shared_ptr<Node> op : current_function->get_results())
         {
@@ -624,6 +840,7 @@ using namespace ngraph::runtime;
         std::map<std::string, size_t> tensor_index_map;
         std::map<std::string, size_t> param_index_map;
         size_t tensor_index = 0;
+        size_t tensor_enable_offset = m_tensor_enable_count;
         for (shared_ptr<Node> node : ordered_ops)
         {
             if (!node->is_parameter() && !node->is_constant())
@@ -637,10 +854,38 @@ using namespace ngraph::runtime;
             }
         }
 
-        writer << "bool " << current_function->get_name() << "_t_en[" << tensor_index << "];\n";
-        writer << "bool " << current_function->get_name() << "_init = true;\n";
+        m_tensor_enable_count += tensor_index;
+
+        // Outline the entry point into several functions so the backend can generate code for
+        // them concurrently
+        size_t part_count = 1;
+        if (codegen_thread_count > 1 && !m_use_tbb && !runtime::cpu::IsTracingEnabled() &&
+            current_function->get_name() == m_function_name)
+        {
+            part_count = min(4 * codegen_thread_count, ordered_ops.size());
+        }
+        auto part_name = [&](size_t part) {
+            return current_function->get_name() + "_part" + to_string(part);
+        };
+        auto emit_prologue = [&]() {
+            if (temporaries_used)
+            {
+                writer << "size_t pool_base_ptr = (size_t) ctx->memory_buffers["
+                       << m_memory_buffer_sizes.size() - 1 << "]->get_ptr();\n";
+                writer << "\n";
+            }
+            // Control flags live in the runtime context so that each context can run independently
+            writer << "bool* t_en = ctx->t_en + " << tensor_enable_offset << ";\n";
+        };
 
-        writer << "extern \"C\" void " << current_function->get_name();
+        if (part_count > 1)
+        {
+            writer << "extern \"C\" __attribute__((noinline)) void " << part_name(0);
+        }
+        else
+        {
+            writer << "extern \"C\" void " << current_function->get_name();
+        }
         writer << "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx)\n";
         writer << "{\n";
         writer.indent++;
@@ -660,10 +905,6 @@ using namespace ngraph::runtime;
 
         if (temporaries_used)
         {
-            writer << "size_t pool_base_ptr = (size_t) ctx->memory_buffers["
-                   << m_memory_buffer_sizes.size() - 1 << "]->get_ptr();\n";
-            writer << "\n";
-
             // Add temporaries to the variable name map
             for (shared_ptr<Node> node : ordered_ops)
             {
@@ -677,7 +918,7 @@ using namespace ngraph::runtime;
             }
         }
 
-        writer << "bool* t_en = (bool*)" << current_function->get_name() << "_t_en;\n";
+        emit_prologue();
 
         // Add inputs to the variable name map
         size_t arg_index = 0;
@@ -717,8 +958,22 @@ using namespace ngraph::runtime;
             }
         }
 
+        size_t op_index = 0;
+        size_t part = 0;
         for (shared_ptr<Node> node : ordered_ops)
         {
+            if (part_count > 1 && op_index++ == (part + 1) * ordered_ops.size() / part_count)
+            {
+                part++;
+                writer.indent--;
+                writer << "}\n\n";
+                writer << "extern \"C\" __attribute__((noinline)) void " << part_name(part);
+                writer << "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx)\n";
+                writer << "{\n";
+                writer.indent++;
+                emit_prologue();
+            }
+
             auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
             // with shared pointers, which is fine here but clang doesn't like it.)
             auto handler = dispatcher.find(type_index(typeid(n)));
@@ -788,7 +1043,7 @@ using namespace ngraph::runtime;
             // Op Control
             if (!node->is_parameter() && !node->is_constant())
             {
-                writer << "if (" << current_function->get_name() << "_init ";
+                writer << "if (ctx->first_iteration ";
                 for (const descriptor::Input& input : node->get_inputs())
                 {
                     const descriptor::Output& output = input.get_output();
@@ -825,8 +1080,19 @@ using namespace ngraph::runtime;
                     }
                     return false;
                 };
-                // Always enable nodes computing output tensors
-                if (computes_output())
+                auto writes_shared_pool = [&]() {
+                    for (auto& output_name : node_output_names)
+                    {
+                        if (shared_tensors.count(output_name) != 0)
+                        {
+                            return true;
+                        }
+                    }
+                    return false;
+                };
+                // Always enable nodes computing output tensors, and nodes whose results may have
+                // been overwritten by other temporaries since the previous call
+                if (computes_output() || writes_shared_pool())
                 {
                     writer << " || 1";
                 }
@@ -912,29 +1178,54 @@ using namespace ngraph::runtime;
         if (m_use_tbb)
         {
             writer << "\n";
-            // Build the flow graph
+            // Build the flow graph. Besides data dependencies, ops touching overlapping ranges
+            // of the temporary pool keep their scheduled order.
             vector<Node*> dependence_graph_heads;
+            PoolAccessTracker<Node*> pool_accesses;
 
-            traverse_nodes(
-                current_function, [&writer, &dependence_graph_heads](shared_ptr<Node> n) {
-                    if (!n->is_parameter() && !n->is_constant())
+            for (shared_ptr<Node> n : ordered_ops)
+            {
+                if (n->is_parameter() || n->is_constant())
+                {
+                    continue;
+                }
+
+                set<Node*> predecessors;
+                for (auto arg : n->get_arguments())
+                {
+                    if (!arg->is_parameter() && !arg->is_constant())
                     {
-                        bool is_head = true;
-                        for (auto arg : n->get_arguments())
-                        {
-                            if (!arg->is_parameter() && !arg->is_constant())
-                            {
-                                is_head = false;
-                                writer << "tbb::flow::make_edge(flowgraph_node_" << arg->get_name()
-                                       << ", flowgraph_node_" << n->get_name() << ");\n";
-                            }
-                        }
-                        if (is_head)
-                        {
-                            dependence_graph_heads.emplace_back(n.get());
-                        }
+                        predecessors.insert(arg.get());
+                    }
+                }
+
+                for (const descriptor::Input& input : n->get_inputs())
+                {
+                    auto it = pool_ranges.find(input.get_output().get_tensor().get_name());
+                    if (it != pool_ranges.end())
+                    {
+                        pool_accesses.read(it->second, n.get(), predecessors);
+                    }
+                }
+                for (const descriptor::Output& output : n->get_outputs())
+                {
+                    auto it = pool_ranges.find(output.get_tensor().get_name());
+                    if (it != pool_ranges.end())
+                    {
+                        pool_accesses.write(it->second, n.get(), predecessors);
                     }
-                });
+                }
+
+                for (Node* predecessor : predecessors)
+                {
+                    writer << "tbb::flow::make_edge(flowgraph_node_" << predecessor->get_name()
+                           << ", flowgraph_node_" << n->get_name() << ");\n";
+                }
+                if (predecessors.empty())
+                {
+                    dependence_graph_heads.emplace_back(n.get());
+                }
+            }
 
             writer << "\n";
 
@@ -949,11 +1240,24 @@ using namespace ngraph::runtime;
                 writer << "try { G.wait_for_all(); } catch(...) { throw; }\n";
             }
         }
-        writer << current_function->get_name() << "_init = false;\n";
 
         writer.indent--;
         // End generated function
         writer += "}\n\n";
+
+        if (part_count > 1)
+        {
+            writer << "extern \"C\" void " << current_function->get_name();
+            writer << "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx)\n";
+            writer << "{\n";
+            writer.indent++;
+            for (size_t i = 0; i < part_count; i++)
+            {
+                writer << part_name(i) << "(inputs, outputs, ctx);\n";
+            }
+            writer.indent--;
+            writer += "}\n\n";
+        }
     }
 
     // TODO: Cleanup and make this a utility function
@@ -964,18 +1268,51 @@ using namespace ngraph::runtime;
     out << code;
     out.close();
 
-    m_compiler.reset(new codegen::Compiler());
     m_execution_engine.reset(new codegen::ExecutionEngine());
+    m_execution_engine->set_codegen_thread_count(codegen_thread_count);
+
+    // Object code cache, keyed by the generated source, the library version and the host CPU.
+    // Debug timers are global objects whose constructors are not run for cached objects.
+    string cache_key;
+    string cache_path;
+    bool cache_hit = false;
+    const char* cache_dir = std::getenv("NGRAPH_CPU_CODEGEN_CACHE");
+    if (cache_dir && !m_emit_timing)
+    {
+        // The number of object files depends on the codegen thread count
+        cache_key = string(LIBRARY_VERSION) + "\n" +
+                    codegen::ExecutionEngine::get_host_cpu_signature() + "\n" +
+                    to_string(codegen_thread_count) + "\n" + code;
+        stringstream ss;
+        ss << hex << std::hash<string>()(cache_key);
+        file_util::make_directory(cache_dir);
+        cache_path = file_util::path_join(cache_dir, m_function_name + "_" + ss.str());
+
+        // The stored key guards against hash collisions and incomplete entries
+        if (file_util::exists(cache_path + ".key") && file_util::exists(cache_path + ".o") &&
+            file_util::read_file_to_string(cache_path + ".key") == cache_key)
+        {
+            cache_hit = m_execution_engine->add_object_file(cache_path + ".o");
+        }
+    }
 
-    m_compiler->set_precompiled_header_source(pch_header_source);
+    if (!cache_hit)
+    {
+        m_compiler.reset(new codegen::Compiler());
+        m_compiler->set_precompiled_header_source(pch_header_source);
 
-    auto codegen_module = m_compiler->compile(code);
+        auto codegen_module = m_compiler->compile(code);
 
-    if (codegen_module == nullptr)
-    {
-        throw runtime_error("function failed to compile");
+        if (codegen_module == nullptr)
+        {
+            throw runtime_error("function failed to compile");
+        }
+        if (!cache_path.empty())
+        {
+            m_execution_engine->set_object_output_file(cache_path + ".o");
+        }
+        m_execution_engine->add_module(codegen_module);
     }
-    m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
     m_compiled_function = m_execution_engine->find_function<EntryPoint_t>(m_function_name);
 
@@ -984,6 +1321,33 @@ using namespace ngraph::runtime;
         throw runtime_error("could not find compiled function");
     }
 
+    auto bind_constants = m_execution_engine->find_function<void(void**)>("bind_constants");
+    if (bind_constants == nullptr)
+    {
+        throw runtime_error("could not find constant binding function");
+    }
+    vector<void*> constant_ptrs;
+    for (auto& node : m_active_constants)
+    {
+        auto c = static_pointer_cast<ngraph::op::Constant>(node);
+        m_constant_data.push_back(c->get_data());
+        constant_ptrs.push_back(const_cast<void*>(m_constant_data.back().get()));
+    }
+    bind_constants(constant_ptrs.data());
+
+    if (!cache_hit && !cache_path.empty() && file_util::exists(cache_path + ".o"))
+    {
+        // Publish the key last so that readers only see complete entries
+        string tmp_key_path = cache_path + ".key." + to_string(getpid());
+        ofstream key_out(tmp_key_path, ios::binary);
+        key_out << cache_key;
+        key_out.close();
+        if (std::rename(tmp_key_path.c_str(), (cache_path + ".key").c_str()) != 0)
+        {
+            file_util::remove_file(tmp_key_path);
+        }
+    }
+
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
     {
@@ -1048,16 +1412,27 @@ void runtime::cpu::CPU_ExternalFunction::build()
     pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
+    if (m_use_int8)
+    {
+        pass_manager.register_pass<runtime::cpu::pass::CPUQuantization>();
+    }
     pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.register_pass<ngraph::pass::ConstantFolding>();
     pass_manager.register_pass<runtime::cpu::pass::CPUWorkspaceInsertion>(nv_cwi);
     pass_manager.register_pass<runtime::cpu::pass::CPUAssignment>(this);
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
     pass_manager.register_pass<runtime::cpu::pass::CPULayout>(this);
     pass_manager.register_pass<runtime::cpu::pass::CPUPostLayoutOptimizations>();
     pass_manager.register_pass<runtime::cpu::pass::CPUShuffleFolding>();
     pass_manager.register_pass<ngraph::pass::ResultCopyElimination>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
+    pass_manager.register_pass<runtime::cpu::pass::CPUMemoryOptimization>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(s_memory_pool_alignment, true);
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        s_memory_pool_alignment,
+        m_disable_memory_sharing,
+        runtime::cpu::mkldnn_utils::get_allocation_size,
+        ngraph::pass::MemoryLayout::Planner::INTERVAL);
     pass_manager.run_passes(m_function);
 
     // Store layouts assigned for arguments
@@ -1097,6 +1472,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
     }
 
     // Build executor
+    auto ordered_ops = m_function->get_ordered_ops();
+
     // Inputs
     size_t arg_index = 0;
     for (auto& param : m_function->get_parameters())
@@ -1104,7 +1481,8 @@ void runtime::cpu::CPU_ExternalFunction::build()
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
             shared_ptr<descriptor::TensorView> tv = param->get_output_tensor_view(i);
-            function_input_index[tv->get_tensor().get_name()] = arg_index;
+            function_input_index.emplace_back(get_buffer_index(tv->get_tensor().get_name()),
+                                              arg_index);
             arg_index++;
         }
     }
@@ -1114,14 +1492,14 @@ void runtime::cpu::CPU_ExternalFunction::build()
     {
         shared_ptr<Node> op = m_function->get_output_op(i);
         shared_ptr<descriptor::TensorView> tv = op->get_output_tensor_view();
-        function_output_index[tv->get_tensor().get_name()] = i;
+        function_output_index.emplace_back(get_buffer_index(tv->get_tensor().get_name()), i);
 
         auto res = std::dynamic_pointer_cast<ngraph::op::Result>(op);
         if (!res->needs_copy())
         {
             shared_ptr<descriptor::TensorView> itv =
                 res->get_inputs().at(0).get_output().get_tensor_view();
-            function_output_index[itv->get_tensor().get_name()] = i;
+            function_output_index.emplace_back(get_buffer_index(itv->get_tensor().get_name()), i);
         }
     }
 
@@ -1130,27 +1508,31 @@ void runtime::cpu::CPU_ExternalFunction::build()
     {
         m_memory_buffer_sizes.push_back(m_function->get_temporary_pool_size());
 
-        for (auto& node : m_function->get_ordered_ops())
+        for (auto& node : *ordered_ops)
         {
             for (auto tensor : node->liveness_new_list)
             {
-                intermediates_offsets[tensor->get_name()] = tensor->get_pool_offset();
+                intermediates_offsets.emplace_back(get_buffer_index(tensor->get_name()),
+                                                   tensor->get_pool_offset());
             }
         }
     }
 
     // Constants
-    for (auto& node : m_function->get_ordered_ops())
+    for (auto& node : *ordered_ops)
     {
         const auto c = dynamic_cast<ngraph::op::Constant*>(node.get());
         if (c)
         {
             auto tv = node->get_outputs()[0].get_tensor_view();
-            tensor_data[tv->get_tensor().get_name()] = const_cast<void*>(c->get_data_ptr());
+            m_constant_data.push_back(c->get_data());
+            constant_tensor_data.emplace_back(get_buffer_index(tv->get_tensor().get_name()),
+                                              const_cast<void*>(m_constant_data.back().get()));
         }
     }
 
-    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    vector<pair<shared_ptr<Node>, size_t>> op_functors;
+    for (shared_ptr<Node> node : *ordered_ops)
     {
         auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
         // with shared pointers, which is fine here but clang doesn't like it.)
@@ -1173,26 +1555,34 @@ void runtime::cpu::CPU_ExternalFunction::build()
             out.push_back(TensorViewWrapper(tv, tv->get_tensor().get_name()));
         }
 
+        size_t functor_count = functors.size();
         handler->second(this, node.get(), in, out);
+        op_functors.emplace_back(node, functors.size() - functor_count);
     }
 
-    executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
-        for (auto& p : intermediates_offsets)
-        {
-            tensor_data[p.first] =
-                static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
-        }
+    if (m_use_tbb)
+    {
+        build_execution_tasks(op_functors);
+    }
 
+    executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
         for (const auto& p : function_input_index)
         {
-            tensor_data[p.first] = inputs[p.second];
+            ctx->buffer_data[p.first] = inputs[p.second];
         }
 
         for (const auto& p : function_output_index)
         {
-            tensor_data[p.first] = outputs[p.second];
+            ctx->buffer_data[p.first] = outputs[p.second];
         }
 
+#ifdef NGRAPH_TBB_ENABLE
+        if (m_use_tbb)
+        {
+            execute_tasks(ctx);
+            return;
+        }
+#endif
         for (const auto& functor : functors)
         {
             functor(ctx);
@@ -1207,6 +1597,154 @@ void runtime::cpu::CPU_ExternalFunction::build()
     }
 }
 
+void runtime::cpu::CPU_ExternalFunction::build_execution_tasks(
+    const vector<pair<shared_ptr<Node>, size_t>>& op_functors)
+{
+    // MemoryLayout may place intermediates with disjoint lifetimes at overlapping offsets of the
+    // temporary pool, so ops touching overlapping ranges have to stay ordered even when no data
+    // flows between them.
+    auto pool_ranges = get_pool_ranges(*m_function->get_ordered_ops());
+    auto pool_range_of = [&](const string& name, vector<PoolRange>& ranges) {
+        auto it = pool_ranges.find(name);
+        if (it != pool_ranges.end())
+        {
+            ranges.push_back(it->second);
+        }
+    };
+
+    // Tasks that have to finish before a tensor can be read. Ops without functors, such as
+    // Parameter, pass on the producers of their inputs.
+    unordered_map<string, vector<size_t>> producers;
+    PoolAccessTracker<size_t> pool_accesses;
+
+    auto functor = functors.begin();
+    for (auto& op_functor : op_functors)
+    {
+        auto& node = op_functor.first;
+
+        set<size_t> predecessors;
+        vector<PoolRange> reads;
+        for (const descriptor::Input& input : node->get_inputs())
+        {
+            auto& name = input.get_output().get_tensor().get_name();
+            auto it = producers.find(name);
+            if (it != producers.end())
+            {
+                predecessors.insert(it->second.begin(), it->second.end());
+            }
+            pool_range_of(name, reads);
+        }
+
+        if (op_functor.second == 0)
+        {
+            for (const descriptor::Output& output : node->get_outputs())
+            {
+                producers[output.get_tensor().get_name()] =
+                    vector<size_t>(predecessors.begin(), predecessors.end());
+            }
+            continue;
+        }
+
+        vector<PoolRange> writes;
+        for (const descriptor::Output& output : node->get_outputs())
+        {
+            pool_range_of(output.get_tensor().get_name(), writes);
+        }
+
+        size_t index = m_execution_tasks.size();
+        for (auto& range : reads)
+        {
+            pool_accesses.read(range, index, predecessors);
+        }
+        for (auto& range : writes)
+        {
+            pool_accesses.write(range, index, predecessors);
+        }
+
+        ExecutionTask task;
+        for (size_t i = 0; i < op_functor.second; i++, functor++)
+        {
+            task.functors.push_back(&*functor);
+        }
+        task.predecessor_count = predecessors.size();
+        for (size_t predecessor : predecessors)
+        {
+            m_execution_tasks[predecessor].successors.push_back(index);
+        }
+        if (predecessors.empty())
+        {
+            m_root_tasks.push_back(index);
+        }
+        m_execution_tasks.push_back(task);
+
+        for (const descriptor::Output& output : node->get_outputs())
+        {
+            producers[output.get_tensor().get_name()] = vector<size_t>{index};
+        }
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::execute_tasks(CPURuntimeContext* ctx) const
+{
+#ifdef NGRAPH_TBB_ENABLE
+    // Dependency counts live in the call so that concurrent calls can share the task graph
+    unique_ptr<atomic<size_t>[]> pending(new atomic<size_t>[m_execution_tasks.size()]);
+    for (size_t i = 0; i < m_execution_tasks.size(); i++)
+    {
+        pending[i] = m_execution_tasks[i].predecessor_count;
+    }
+
+    tbb::task_group group;
+    function<void(size_t)> run_task = [&](size_t index) {
+        const ExecutionTask& task = m_execution_tasks[index];
+        for (auto functor : task.functors)
+        {
+            (*functor)(ctx);
+        }
+        for (size_t successor : task.successors)
+        {
+            if (--pending[successor] == 0)
+            {
+                group.run([&run_task, successor]() { run_task(successor); });
+            }
+        }
+    };
+    for (size_t index : m_root_tasks)
+    {
+        group.run([&run_task, index]() { run_task(index); });
+    }
+    group.wait();
+#else
+    throw ngraph_error("Parallel direct execution requires the CPU backend to be built with TBB");
+#endif
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& name)
+{
+    auto it = buffer_indices.find(name);
+    if (it != buffer_indices.end())
+    {
+        return it->second;
+    }
+    size_t index = buffer_indices.size();
+    buffer_indices[name] = index;
+    return index;
+}
+
+void runtime::cpu::CPU_ExternalFunction::initialize_buffer_data(CPURuntimeContext* ctx) const
+{
+    ctx->buffer_data.assign(buffer_indices.size(), nullptr);
+    for (const auto& p : constant_tensor_data)
+    {
+        ctx->buffer_data[p.first] = p.second;
+    }
+    for (const auto& p : intermediates_offsets)
+    {
+        ctx->buffer_data[p.first] =
+            static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
+    }
+}
+
 shared_ptr<ngraph::runtime::cpu::CPU_CallFrame>
     runtime::cpu::CPU_ExternalFunction::make_call_frame()
 {
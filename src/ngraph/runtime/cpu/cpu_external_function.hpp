@@ -84,6 +84,7 @@ namespace ngraph
                 {
                     return m_memory_buffer_sizes;
                 }
+                size_t get_tensor_enable_count() const { return m_tensor_enable_count; }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
                 const std::unique_ptr<MKLDNNEmitter>& get_mkldnn_emitter() const
                 {
@@ -99,7 +100,9 @@ namespace ngraph
                 {
                     return functors;
                 }
-                std::unordered_map<std::string, void*>& get_tensor_data() { return tensor_data; }
+                /// @brief Slot of a tensor in CPURuntimeContext::buffer_data for direct execution
+                size_t get_buffer_index(const std::string& name);
+                void initialize_buffer_data(CPURuntimeContext* ctx) const;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -129,6 +132,9 @@ namespace ngraph
                     const Node&,
                     const std::unordered_map<const Node*, std::string>& node_cache);
                 std::string emit_op_as_function(const Node&, const std::string& function_name);
+                void build_execution_tasks(
+                    const std::vector<std::pair<std::shared_ptr<Node>, size_t>>& op_functors);
+                void execute_tasks(CPURuntimeContext* ctx) const;
                 std::string strip_comments(const std::string&);
                 void release_function() { m_function = nullptr; }
                 std::shared_ptr<ngraph::Function> m_function;
@@ -147,10 +153,15 @@ namespace ngraph
                 // Constant ops we need to keep a list of shared_ptr to each Constant
                 // so they don't get freed before we are done with them
                 std::vector<std::shared_ptr<Node>> m_active_constants;
+                // The data bound into the compiled function stays alive with it, even if a
+                // Constant's data is released or the Function itself is released after
+                // compiling
+                std::vector<std::shared_ptr<const void>> m_constant_data;
 
                 LayoutDescriptorPtrs parameter_layout_descriptors;
                 LayoutDescriptorPtrs result_layout_descriptors;
                 std::vector<size_t> m_memory_buffer_sizes;
+                size_t m_tensor_enable_count;
                 std::vector<OpAttributes> m_op_attrs;
 
                 std::unique_ptr<MKLDNNEmitter> m_mkldnn_emitter;
@@ -160,11 +171,32 @@ namespace ngraph
                 std::list<std::function<void(CPURuntimeContext*)>> functors;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>
                     executor;
-                std::unordered_map<std::string, void*> tensor_data;
-                std::unordered_map<std::string, size_t> intermediates_offsets;
-                std::unordered_map<std::string, size_t> function_input_index, function_output_index;
+                // Direct execution tensors are resolved to buffer_data slots when the function
+                // is built. Calls only patch the input and output slots.
+                std::unordered_map<std::string, size_t> buffer_indices;
+                std::vector<std::pair<size_t, void*>> constant_tensor_data;
+                std::vector<std::pair<size_t, size_t>> intermediates_offsets;
+                std::vector<std::pair<size_t, size_t>> function_input_index, function_output_index;
                 bool m_is_built;
                 bool m_direct_execution;
+                // Temporaries with disjoint lifetimes share pool space unless
+                // NGRAPH_CPU_DISABLE_MEMORY_SHARING is set.
+                bool m_disable_memory_sharing;
+                // Quantized regions run on the int8 kernels only if NGRAPH_CPU_INT8 is set,
+                // since requantizing may move a result by a quantization step.
+                bool m_use_int8;
+
+                // With NGRAPH_CPU_USE_TBB, the functors of each op are grouped into a task and
+                // tasks run as soon as their predecessors finish. Predecessors cover both data
+                // dependencies and ops touching overlapping ranges of the temporary pool.
+                struct ExecutionTask
+                {
+                    std::vector<std::function<void(CPURuntimeContext*)>*> functors;
+                    std::vector<size_t> successors;
+                    size_t predecessor_count;
+                };
+                std::vector<ExecutionTask> m_execution_tasks;
+                std::vector<size_t> m_root_tasks;
             };
         }
     }
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <vector>
 
 namespace mkldnn
 {
@@ -47,9 +48,24 @@ namespace ngraph
             {
                 int64_t* op_durations;
                 bool* p_en;
+                bool* t_en;
+                bool first_iteration;
                 mkldnn::primitive* const* mkldnn_primitives;
                 std::vector<AlignedBuffer*> memory_buffers;
                 char* const* mkldnn_workspaces;
+
+                // Per-context state that allows several contexts to execute the same
+                // compiled function concurrently
+                std::vector<void*> last_inputs;
+                std::vector<AlignedBuffer*> workspace_buffers;
+                std::vector<char*> workspace_ptrs;
+                // MKLDNN primitives built for this context alone; empty when the context
+                // uses the primitives of the MKLDNNEmitter
+                std::vector<mkldnn::primitive*> owned_mkldnn_primitives;
+
+                // Tensor addresses for direct execution, indexed by
+                // CPU_ExternalFunction::get_buffer_index
+                std::vector<void*> buffer_data;
             };
             }
         }
@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/kernel/eigen_thread_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType, unsigned int Rank>
+                void concat(const std::vector<void*>& inputs,
+                            const std::vector<Shape>& input_shapes,
+                            void* output,
+                            const Shape& output_shape,
+                            size_t axis)
+                {
+                    Eigen::array<Eigen::Index, Rank> out_dims;
+                    Eigen::array<Eigen::Index, Rank> offsets;
+
+                    for (int i = 0; i < Rank; i++)
+                    {
+                        out_dims[i] = output_shape[i];
+                        offsets[i] = 0;
+                    }
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+
+                    for (size_t i = 0; i < inputs.size(); i++)
+                    {
+                        Eigen::array<Eigen::Index, Rank> in_dims;
+                        for (int j = 0; j < Rank; j++)
+                        {
+                            in_dims[j] = input_shapes[i][j];
+                        }
+
+                        Eigen::TensorMap<Eigen::Tensor<ElementType, Rank, Eigen::RowMajor>> in(
+                            static_cast<ElementType*>(inputs[i]), in_dims);
+
+                        out.slice(offsets, in_dims).device(eigen::global_thread_pool_device) = in;
+                        offsets[axis] += in_dims[axis];
+                    }
+                }
+            }
+        }
+    }
+}
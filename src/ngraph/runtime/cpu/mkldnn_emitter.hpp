@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -40,21 +41,37 @@ namespace ngraph
             class MKLDNNWorkspace
             {
             public:
-                MKLDNNWorkspace(size_t size) { buf = reinterpret_cast<char*>(malloc(size)); }
+                MKLDNNWorkspace(size_t size)
+                    : size(size)
+                {
+                    buf = reinterpret_cast<char*>(malloc(size));
+                }
                 ~MKLDNNWorkspace() { free(buf); }
                 char* buf;
+                size_t size;
             };
 
             class MKLDNNEmitter
             {
             public:
+                using Primitives = std::vector<mkldnn::primitive*>;
+                using PrimitiveFactory = std::function<mkldnn::primitive*(const Primitives&)>;
+
                 MKLDNNEmitter() {}
                 ~MKLDNNEmitter();
 
                 const std::vector<mkldnn::primitive*>& get_mkldnn_primitives() const;
                 const std::vector<char*>& get_mkldnn_workspaces();
+                std::vector<size_t> get_mkldnn_workspace_sizes() const;
+
+                // Builds a private copy of every primitive for a runtime context, so that
+                // concurrent calls can bind data handles without synchronizing. The caller
+                // owns the returned primitives.
+                Primitives create_mkldnn_primitives() const;
 
-                size_t insert_primitive(mkldnn::primitive* primitive);
+                // The factory receives the primitives inserted so far and must only
+                // dereference those; it is replayed by create_mkldnn_primitives().
+                size_t insert_primitive(const PrimitiveFactory& factory);
                 size_t insert_workspace(std::unique_ptr<MKLDNNWorkspace>& workspace);
                 const std::vector<size_t>& get_primitive_deps(size_t index) const;
 
@@ -237,6 +254,7 @@ namespace ngraph
 
             private:
                 std::vector<mkldnn::primitive*> m_mkldnn_primitives;
+                std::vector<PrimitiveFactory> m_primitive_factories;
                 std::vector<mkldnn::stream> m_mkldnn_streams;
                 std::unordered_map<size_t, std::vector<size_t>> m_primitive_deps;
                 std::vector<std::unique_ptr<MKLDNNWorkspace>> m_workspaces;
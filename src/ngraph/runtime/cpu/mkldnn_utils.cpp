@@ -19,6 +19,7 @@
 #include <typeinfo>
 #include <unordered_set>
 
+#include "ngraph/descriptor/primary_tensor_view.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/avg_pool.hpp"
@@ -223,10 +224,10 @@ mkldnn::memory::format runtime::cpu::mkldnn_utils::get_output_mkldnn_format(cons
 
 bool runtime::cpu::mkldnn_utils::use_mkldnn_kernel(const ngraph::Node* node)
 {
-    auto op_annotations = static_cast<const ngraph::op::Op*>(node)->get_op_annotations();
-    return (op_annotations &&
-            static_pointer_cast<ngraph::runtime::cpu::CPUOpAnnotations>(op_annotations)
-                ->is_mkldnn_op());
+    // Annotations attached by other backends are not CPUOpAnnotations
+    auto op_annotations = dynamic_pointer_cast<ngraph::runtime::cpu::CPUOpAnnotations>(
+        static_cast<const ngraph::op::Op*>(node)->get_op_annotations());
+    return (op_annotations && op_annotations->is_mkldnn_op());
 }
 
 bool runtime::cpu::mkldnn_utils::compare_mkldnn_formats(mkldnn::memory::format fmt1,
@@ -259,3 +260,26 @@ bool runtime::cpu::mkldnn_utils::is_mkldnn_blocked_data_format(mkldnn::memory::f
     }
     return false;
 }
+
+size_t runtime::cpu::mkldnn_utils::get_allocation_size(const descriptor::Tensor& tensor)
+{
+    size_t size = tensor.size();
+    auto layout = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+        tensor.get_primary_tensor_view()->get_tensor_view_layout());
+    if (!layout)
+    {
+        return size;
+    }
+
+    // Blocked formats round channels up to the block size, so MKLDNN may touch more memory
+    // than the dense shape covers.
+    auto fmt = layout->get_mkldnn_format();
+    if (!is_mkldnn_blocked_data_format(fmt) && !is_mkldnn_filter_format(fmt))
+    {
+        return size;
+    }
+    Shape shape = layout->get_shape();
+    memory::dims dims(shape.begin(), shape.end());
+    memory::desc md(dims, get_mkldnn_data_type(tensor.get_element_type()), fmt);
+    return max(size, memory::primitive_desc(md, global_cpu_engine).get_size());
+}
@@ -47,6 +47,9 @@ namespace ngraph
                                             mkldnn::memory::format fmt2);
                 bool is_mkldnn_filter_format(mkldnn::memory::format fmt);
                 bool is_mkldnn_blocked_data_format(mkldnn::memory::format fmt);
+
+                /// \brief Bytes a tensor needs in the memory pool under its assigned layout.
+                size_t get_allocation_size(const ngraph::descriptor::Tensor& tensor);
             }
         }
     }
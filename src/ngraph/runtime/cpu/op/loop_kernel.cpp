@@ -17,6 +17,7 @@
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/parameter.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -25,47 +26,27 @@ using namespace ngraph;
 shared_ptr<Node>
     ngraph::runtime::cpu::op::LoopKernel::copy_with_new_args(const NodeVector& new_args) const
 {
-    auto args = get_arguments();
-    if (new_args.size() != args.size())
+    if (new_args.size() != m_inputs.size())
     {
         throw ngraph_error("number of arguments don't match");
     }
+    // The internal parameters map directly onto the new arguments. make_shared cannot reach the
+    // private constructor.
+    return shared_ptr<Node>(new LoopKernel(m_node_list, m_outputs, m_inputs, new_args));
+}
 
-    //map inputs
-    NodeMap nm;
-    for (size_t i = 0; i < args.size(); i++)
-    {
-        nm.add(args.at(i), new_args.at(i));
-    }
-
-    NodeVector new_node_list;
-    for (auto n : m_node_list)
-    {
-        NodeVector cur_args;
-        for (auto a : n->get_arguments())
-        {
-            cur_args.push_back(nm.get(a));
-        }
-        auto new_n = n->copy_with_new_args(cur_args);
-        nm.add(n, new_n);
-        new_node_list.push_back(new_n);
-    }
-
-    NodeVector new_outputs;
-    for (auto o : m_outputs)
-    {
-        new_outputs.push_back(nm.get(o));
-    }
-
-    return std::make_shared<LoopKernel>(new_node_list, new_outputs, new_args);
+ngraph::runtime::cpu::op::LoopKernel::LoopKernel(const NodeVector& node_list,
+                                                 const NodeVector& outputs,
+                                                 const NodeVector& args)
+    : LoopKernel(node_list, outputs, args, args)
+{
 }
 
 ngraph::runtime::cpu::op::LoopKernel::LoopKernel(const NodeVector& node_list,
                                                  const NodeVector& outputs,
+                                                 const NodeVector& kernel_args,
                                                  const NodeVector& args)
     : RequiresTensorViewArgs("LoopKernel", {args})
-    , m_node_list(node_list)
-    , m_outputs(outputs)
 {
     auto ref = node_list.at(0);
     for (auto n : node_list)
@@ -76,12 +57,43 @@ ngraph::runtime::cpu::op::LoopKernel::LoopKernel(const NodeVector& node_list,
         }
     }
 
+    //map inputs
+    NodeMap nm;
+    for (size_t i = 0; i < kernel_args.size(); i++)
+    {
+        auto arg = kernel_args.at(i);
+        if (!nm.exists(arg))
+        {
+            auto input =
+                std::make_shared<ngraph::op::Parameter>(arg->get_element_type(), arg->get_shape());
+            nm.add(arg, input);
+        }
+        m_inputs.push_back(nm.get(arg));
+    }
+
+    for (auto n : node_list)
+    {
+        NodeVector cur_args;
+        for (auto a : n->get_arguments())
+        {
+            if (!nm.exists(a))
+            {
+                throw ngraph_error(a->get_name() + " is neither an argument nor in node_list");
+            }
+            cur_args.push_back(nm.get(a));
+        }
+        auto new_n = n->copy_with_new_args(cur_args);
+        nm.add(n, new_n);
+        m_node_list.push_back(new_n);
+    }
+
     for (auto o : outputs)
     {
         if (std::find(node_list.begin(), node_list.end(), o) == node_list.end())
         {
             throw ngraph_error(o->get_name() + " isn't in node_list");
         }
+        m_outputs.push_back(nm.get(o));
         add_output(o->get_element_type(), o->get_shape());
     }
 }
@@ -29,6 +29,10 @@ namespace ngraph
             {
                 /// \brief LoopKernel represents graphs consisting
                 /// of arithmetic operations that can be executed in the same loop
+                ///
+                /// The ops of node_list, which compute from args, are copied onto internal
+                /// parameters, one per arg, so the kernel does not hold on to the surrounding
+                /// graph.
                 class LoopKernel : public ngraph::op::util::RequiresTensorViewArgs
                 {
                 public:
@@ -38,11 +42,21 @@ namespace ngraph
                     virtual std::shared_ptr<Node>
                         copy_with_new_args(const NodeVector& new_args) const override;
 
+                    /// \brief The ops of the kernel in topological order
                     const NodeVector& get_node_list() const { return m_node_list; }
                     const NodeVector& get_kernel_outputs() const { return m_outputs; }
+                    /// \brief The internal parameter standing for each argument
+                    const NodeVector& get_kernel_inputs() const { return m_inputs; }
                 private:
+                    /// \brief node_list computes from kernel_args, which are bound to args
+                    LoopKernel(const NodeVector& node_list,
+                               const NodeVector& outputs,
+                               const NodeVector& kernel_args,
+                               const NodeVector& args);
+
                     NodeVector m_node_list;
                     NodeVector m_outputs;
+                    NodeVector m_inputs;
                 };
             }
         }
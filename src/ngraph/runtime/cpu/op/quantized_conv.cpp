@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "quantized_conv.hpp"
+
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/util/quantization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::QuantizedConvolution::QuantizedConvolution(const shared_ptr<Node>& data_batch,
+                                               const shared_ptr<Node>& filters,
+                                               const Strides& window_movement_strides,
+                                               const Strides& window_dilation_strides,
+                                               const CoordinateDiff& padding_below,
+                                               const CoordinateDiff& padding_above,
+                                               const Strides& data_dilation_strides,
+                                               double data_scale,
+                                               int64_t data_zero_point,
+                                               double filter_scale,
+                                               const element::Type& output_type,
+                                               double output_scale,
+                                               int64_t output_zero_point)
+    : RequiresTensorViewArgs("QuantizedConvolution", {data_batch, filters})
+    , m_window_movement_strides(window_movement_strides)
+    , m_window_dilation_strides(window_dilation_strides)
+    , m_padding_below(padding_below)
+    , m_padding_above(padding_above)
+    , m_data_dilation_strides(data_dilation_strides)
+    , m_data_scale(data_scale)
+    , m_data_zero_point(data_zero_point)
+    , m_filter_scale(filter_scale)
+    , m_output_scale(output_scale)
+    , m_output_zero_point(output_zero_point)
+{
+    util::validate_quantization(
+        "QuantizedConvolution data", data_batch->get_element_type(), data_scale, data_zero_point);
+    util::validate_quantization(
+        "QuantizedConvolution filters", filters->get_element_type(), filter_scale, 0);
+    if (!output_type.is_real())
+    {
+        util::validate_quantization(
+            "QuantizedConvolution output", output_type, output_scale, output_zero_point);
+    }
+
+    set_value_type_checked(
+        output_type,
+        util::infer_convolution_output_shape(data_batch->get_shape(),
+                                             filters->get_shape(),
+                                             window_movement_strides,
+                                             window_dilation_strides,
+                                             padding_below,
+                                             padding_above,
+                                             data_dilation_strides,
+                                             0, /* batch_axis_data,              */
+                                             1, /* input_channel_axis_data,      */
+                                             1, /* input_channel_axis_filters,   */
+                                             0, /* output_channel_axis_filters,  */
+                                             0, /* batch_axis_result,            */
+                                             1, /* output_channel_axis_result,   */
+                                             ""));
+}
+
+shared_ptr<Node> op::QuantizedConvolution::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+
+    return make_shared<QuantizedConvolution>(new_args.at(0),
+                                             new_args.at(1),
+                                             m_window_movement_strides,
+                                             m_window_dilation_strides,
+                                             m_padding_below,
+                                             m_padding_above,
+                                             m_data_dilation_strides,
+                                             m_data_scale,
+                                             m_data_zero_point,
+                                             m_filter_scale,
+                                             get_element_type(),
+                                             m_output_scale,
+                                             m_output_zero_point);
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Forward convolution of i8 or u8 data with i8 or u8 filters, accumulated in 32
+        ///        bits.
+        ///
+        /// The real data is data_scale * (data - data_zero_point) and the real filters are
+        /// filter_scale * filters; filters are quantized symmetrically. With a real output type
+        /// the op produces the real result, with i8 or u8 the result quantized with
+        /// output_scale and output_zero_point, so consecutive quantized ops do not go through
+        /// f32 in between.
+        class QuantizedConvolution : public util::RequiresTensorViewArgs
+        {
+        public:
+            QuantizedConvolution(const std::shared_ptr<Node>& data_batch,
+                                 const std::shared_ptr<Node>& filters,
+                                 const Strides& window_movement_strides,
+                                 const Strides& window_dilation_strides,
+                                 const CoordinateDiff& padding_below,
+                                 const CoordinateDiff& padding_above,
+                                 const Strides& data_dilation_strides,
+                                 double data_scale,
+                                 int64_t data_zero_point,
+                                 double filter_scale,
+                                 const element::Type& output_type,
+                                 double output_scale = 1,
+                                 int64_t output_zero_point = 0);
+
+            const Strides& get_window_movement_strides() const { return m_window_movement_strides; }
+            const Strides& get_window_dilation_strides() const { return m_window_dilation_strides; }
+            const CoordinateDiff& get_padding_below() const { return m_padding_below; }
+            const CoordinateDiff& get_padding_above() const { return m_padding_above; }
+            const Strides& get_data_dilation_strides() const { return m_data_dilation_strides; }
+            double get_data_scale() const { return m_data_scale; }
+            int64_t get_data_zero_point() const { return m_data_zero_point; }
+            double get_filter_scale() const { return m_filter_scale; }
+            double get_output_scale() const { return m_output_scale; }
+            int64_t get_output_zero_point() const { return m_output_zero_point; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            Strides m_window_movement_strides;
+            Strides m_window_dilation_strides;
+            CoordinateDiff m_padding_below;
+            CoordinateDiff m_padding_above;
+            Strides m_data_dilation_strides;
+            double m_data_scale;
+            int64_t m_data_zero_point;
+            double m_filter_scale;
+            double m_output_scale;
+            int64_t m_output_zero_point;
+        };
+    }
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "quantized_dot.hpp"
+
+#include "ngraph/op/util/quantization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::QuantizedDot::QuantizedDot(const shared_ptr<Node>& arg0,
+                               const shared_ptr<Node>& arg1,
+                               size_t reduction_axes_count,
+                               double arg0_scale,
+                               int64_t arg0_zero_point,
+                               double arg1_scale,
+                               int64_t arg1_zero_point,
+                               const element::Type& output_type,
+                               double output_scale,
+                               int64_t output_zero_point)
+    : RequiresTensorViewArgs("QuantizedDot", {arg0, arg1})
+    , m_reduction_axes_count(reduction_axes_count)
+    , m_arg0_scale(arg0_scale)
+    , m_arg0_zero_point(arg0_zero_point)
+    , m_arg1_scale(arg1_scale)
+    , m_arg1_zero_point(arg1_zero_point)
+    , m_output_scale(output_scale)
+    , m_output_zero_point(output_zero_point)
+{
+    util::validate_quantization(
+        "QuantizedDot arg0", arg0->get_element_type(), arg0_scale, arg0_zero_point);
+    util::validate_quantization(
+        "QuantizedDot arg1", arg1->get_element_type(), arg1_scale, arg1_zero_point);
+    if (!output_type.is_real())
+    {
+        util::validate_quantization(
+            "QuantizedDot output", output_type, output_scale, output_zero_point);
+    }
+
+    const Shape& arg0_shape = arg0->get_shape();
+    const Shape& arg1_shape = arg1->get_shape();
+    if (reduction_axes_count > arg0_shape.size() || reduction_axes_count > arg1_shape.size())
+    {
+        throw ngraph_error("QuantizedDot has too many reduction axes");
+    }
+    for (size_t i = 0; i < reduction_axes_count; i++)
+    {
+        if (arg0_shape[arg0_shape.size() - reduction_axes_count + i] != arg1_shape[i])
+        {
+            throw ngraph_error("QuantizedDot axes do not have same length");
+        }
+    }
+
+    Shape result_shape(arg0_shape.begin(), arg0_shape.end() - reduction_axes_count);
+    result_shape.insert(
+        result_shape.end(), arg1_shape.begin() + reduction_axes_count, arg1_shape.end());
+    set_value_type_checked(output_type, result_shape);
+}
+
+shared_ptr<Node> op::QuantizedDot::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 2)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+
+    return make_shared<QuantizedDot>(new_args.at(0),
+                                     new_args.at(1),
+                                     m_reduction_axes_count,
+                                     m_arg0_scale,
+                                     m_arg0_zero_point,
+                                     m_arg1_scale,
+                                     m_arg1_zero_point,
+                                     get_element_type(),
+                                     m_output_scale,
+                                     m_output_zero_point);
+}
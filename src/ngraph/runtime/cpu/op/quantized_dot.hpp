@@ -0,0 +1,66 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "ngraph/op/util/requires_tensor_view_args.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Dot of i8 or u8 arguments, accumulated in 32 bits.
+        ///
+        /// The real arguments are arg0_scale * (arg0 - arg0_zero_point) and arg1_scale *
+        /// (arg1 - arg1_zero_point). The output type and quantization are as for
+        /// QuantizedConvolution.
+        class QuantizedDot : public util::RequiresTensorViewArgs
+        {
+        public:
+            QuantizedDot(const std::shared_ptr<Node>& arg0,
+                         const std::shared_ptr<Node>& arg1,
+                         size_t reduction_axes_count,
+                         double arg0_scale,
+                         int64_t arg0_zero_point,
+                         double arg1_scale,
+                         int64_t arg1_zero_point,
+                         const element::Type& output_type,
+                         double output_scale = 1,
+                         int64_t output_zero_point = 0);
+
+            size_t get_reduction_axes_count() const { return m_reduction_axes_count; }
+            double get_arg0_scale() const { return m_arg0_scale; }
+            int64_t get_arg0_zero_point() const { return m_arg0_zero_point; }
+            double get_arg1_scale() const { return m_arg1_scale; }
+            int64_t get_arg1_zero_point() const { return m_arg1_zero_point; }
+            double get_output_scale() const { return m_output_scale; }
+            int64_t get_output_zero_point() const { return m_output_zero_point; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            size_t m_reduction_axes_count;
+            double m_arg0_scale;
+            int64_t m_arg0_zero_point;
+            double m_arg1_scale;
+            int64_t m_arg1_zero_point;
+            double m_output_scale;
+            int64_t m_output_zero_point;
+        };
+    }
+}
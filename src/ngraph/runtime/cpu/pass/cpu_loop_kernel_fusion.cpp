@@ -0,0 +1,317 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
+
+#include <algorithm>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/exp.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/log.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/tanh.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+bool runtime::cpu::pass::CPULoopKernelFusion::is_fusible(const Node& node)
+{
+    static const unordered_set<type_index> fusible_ops{TI(ngraph::op::Abs),
+                                                       TI(ngraph::op::Add),
+                                                       TI(ngraph::op::Divide),
+                                                       TI(ngraph::op::Exp),
+                                                       TI(ngraph::op::Log),
+                                                       TI(ngraph::op::Maximum),
+                                                       TI(ngraph::op::Minimum),
+                                                       TI(ngraph::op::Multiply),
+                                                       TI(ngraph::op::Negative),
+                                                       TI(ngraph::op::Relu),
+                                                       TI(ngraph::op::Sigmoid),
+                                                       TI(ngraph::op::Sqrt),
+                                                       TI(ngraph::op::Subtract),
+                                                       TI(ngraph::op::Tanh)};
+
+    if (fusible_ops.count(TI(node)) == 0 || node.get_output_size() != 1 ||
+        (node.get_element_type() != element::f32 && node.get_element_type() != element::f64) ||
+        runtime::cpu::mkldnn_utils::use_mkldnn_kernel(&node))
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        if (node.get_input_shape(i) != node.get_shape() ||
+            node.get_input_element_type(i) != node.get_element_type())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace
+{
+    // Fusion regions over the positions of a topologically sorted op list, merged with
+    // union-find
+    class Regions
+    {
+    public:
+        Regions(const vector<shared_ptr<Node>>& ops)
+            : m_ops(ops)
+        {
+            for (size_t i = 0; i < ops.size(); i++)
+            {
+                m_positions[ops[i].get()] = i;
+            }
+            m_region_of.assign(ops.size(), none);
+        }
+
+        size_t find(size_t region)
+        {
+            while (m_parents[region] != region)
+            {
+                m_parents[region] = m_parents[m_parents[region]];
+                region = m_parents[region];
+            }
+            return region;
+        }
+
+        size_t region_of(const Node* node)
+        {
+            auto it = m_positions.find(node);
+            if (it == m_positions.end() || m_region_of[it->second] == none)
+            {
+                return none;
+            }
+            return find(m_region_of[it->second]);
+        }
+
+        size_t create(size_t position)
+        {
+            size_t region = m_parents.size();
+            m_parents.push_back(region);
+            m_members.push_back({position});
+            m_region_of[position] = region;
+            return region;
+        }
+
+        // Merges region b into region a unless the op that results from collapsing both into
+        // one would depend on itself
+        bool try_merge(size_t a, size_t b)
+        {
+            if (creates_cycle(a, b))
+            {
+                return false;
+            }
+            m_parents[b] = a;
+            m_members[a].insert(m_members[a].end(), m_members[b].begin(), m_members[b].end());
+            m_members[b].clear();
+            return true;
+        }
+
+        const vector<size_t>& members(size_t region) const { return m_members[region]; }
+        static const size_t none = static_cast<size_t>(-1);
+
+    private:
+        // Searches backwards from the external arguments of a and b for a member of either.
+        // Other regions are treated as the single op they will become.
+        bool creates_cycle(size_t a, size_t b)
+        {
+            vector<size_t> stack;
+            unordered_set<size_t> visited;
+            unordered_set<size_t> visited_regions;
+            // Returns true when an argument of the op at position lies in a or b
+            auto push_args = [&](size_t position) {
+                for (auto& arg : m_ops[position]->get_arguments())
+                {
+                    auto it = m_positions.find(arg.get());
+                    if (it == m_positions.end())
+                    {
+                        continue;
+                    }
+                    size_t region = region_of(arg.get());
+                    if (region == a || region == b)
+                    {
+                        return true;
+                    }
+                    if (visited.insert(it->second).second)
+                    {
+                        stack.push_back(it->second);
+                    }
+                }
+                return false;
+            };
+
+            for (size_t region : {a, b})
+            {
+                for (size_t position : m_members[region])
+                {
+                    for (auto& arg : m_ops[position]->get_arguments())
+                    {
+                        auto it = m_positions.find(arg.get());
+                        size_t arg_region = region_of(arg.get());
+                        if (it != m_positions.end() && arg_region != a && arg_region != b &&
+                            visited.insert(it->second).second)
+                        {
+                            stack.push_back(it->second);
+                        }
+                    }
+                }
+            }
+            while (!stack.empty())
+            {
+                size_t position = stack.back();
+                stack.pop_back();
+                size_t region = region_of(m_ops[position].get());
+                if (region == none)
+                {
+                    if (push_args(position))
+                    {
+                        return true;
+                    }
+                }
+                else if (visited_regions.insert(region).second)
+                {
+                    for (size_t member : m_members[region])
+                    {
+                        if (push_args(member))
+                        {
+                            return true;
+                        }
+                    }
+                }
+            }
+            return false;
+        }
+
+        const vector<shared_ptr<Node>>& m_ops;
+        unordered_map<const Node*, size_t> m_positions;
+        vector<size_t> m_region_of;
+        vector<size_t> m_parents;
+        vector<vector<size_t>> m_members;
+    };
+
+    const size_t Regions::none;
+}
+
+bool runtime::cpu::pass::CPULoopKernelFusion::run_on_function(shared_ptr<Function> function)
+{
+    auto ordered_ops = function->get_ordered_ops();
+    vector<shared_ptr<Node>> ops(ordered_ops->begin(), ordered_ops->end());
+    Regions regions(ops);
+
+    for (size_t position = 0; position < ops.size(); position++)
+    {
+        auto& node = ops[position];
+        if (!is_fusible(*node))
+        {
+            continue;
+        }
+        size_t region = regions.create(position);
+        for (auto& arg : node->get_arguments())
+        {
+            size_t arg_region = regions.region_of(arg.get());
+            if (arg_region != Regions::none && arg_region != region &&
+                regions.try_merge(arg_region, region))
+            {
+                region = arg_region;
+            }
+        }
+    }
+
+    bool replaced = false;
+    unordered_set<size_t> seen;
+    for (size_t position = 0; position < ops.size(); position++)
+    {
+        size_t region = regions.region_of(ops[position].get());
+        if (region == Regions::none || !seen.insert(region).second)
+        {
+            continue;
+        }
+        vector<size_t> positions = regions.members(region);
+        if (positions.size() < m_min_kernel_size)
+        {
+            continue;
+        }
+        sort(positions.begin(), positions.end());
+
+        NodeVector node_list;
+        unordered_set<Node*> members;
+        for (size_t member : positions)
+        {
+            node_list.push_back(ops[member]);
+            members.insert(ops[member].get());
+        }
+
+        NodeVector args;
+        NodeVector outputs;
+        for (auto& member : node_list)
+        {
+            for (auto& arg : member->get_arguments())
+            {
+                if (members.count(arg.get()) == 0 &&
+                    find(args.begin(), args.end(), arg) == args.end())
+                {
+                    args.push_back(arg);
+                }
+            }
+            for (auto& user : member->get_users())
+            {
+                if (members.count(user.get()) == 0)
+                {
+                    outputs.push_back(member);
+                    break;
+                }
+            }
+        }
+
+        auto loop_kernel = make_shared<runtime::cpu::op::LoopKernel>(node_list, outputs, args);
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            auto goe = make_shared<ngraph::op::GetOutputElement>(loop_kernel, i);
+            auto& output = outputs[i]->get_outputs().at(0);
+            set<descriptor::Input*> inputs{begin(output.get_inputs()), end(output.get_inputs())};
+            for (auto input : inputs)
+            {
+                if (members.count(input->get_node().get()) == 0)
+                {
+                    input->replace_output(goe->get_outputs().at(0));
+                }
+            }
+        }
+        NGRAPH_DEBUG << "Fused " << node_list.size() << " ops into " << loop_kernel->get_name();
+        replaced = true;
+    }
+    return replaced;
+}
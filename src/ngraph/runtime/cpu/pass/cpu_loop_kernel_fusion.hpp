@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                class CPULoopKernelFusion;
+            }
+        }
+    }
+}
+
+/// \brief Replaces connected regions of same-shape elementwise ops with LoopKernel ops, so a
+///        chain of unary and binary arithmetic is computed in a single sweep over memory.
+///
+/// Regions are grown in topological order and never absorb a node that would make the fused
+/// op depend on itself through an op outside the region. Every member with a consumer outside
+/// the region becomes an output of the LoopKernel. Ops assigned to MKLDNN are left alone, so
+/// the pass runs after CPUAssignment and before CPULayout.
+class ngraph::runtime::cpu::pass::CPULoopKernelFusion : public ngraph::pass::FunctionPass
+{
+public:
+    CPULoopKernelFusion(size_t min_kernel_size = 2)
+        : FunctionPass()
+        , m_min_kernel_size(min_kernel_size)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+    /// \brief Whether the LoopKernel emitters and builders can evaluate node.
+    static bool is_fusible(const Node& node);
+
+private:
+    size_t m_min_kernel_size;
+};
@@ -110,7 +110,8 @@ bool runtime::cpu::pass::CPURnnMatFusion::run_on_function(std::shared_ptr<Functi
 
     std::map<std::shared_ptr<Node>, NodeVector> op_seg_map; //add to list of params
     std::map<NodeVector, NodeVector> param_list;
-    for (auto n : function->get_ordered_ops())
+    auto ordered_ops = function->get_ordered_ops();
+    for (auto n : *ordered_ops)
     {
         NodeVector params;
         NodeVector matched_nodes;
@@ -382,7 +383,8 @@ bool runtime::cpu::pass::CPUBatchFusion::run_on_function(std::shared_ptr<Functio
 {
     bool modified = false;
 
-    for (auto n : func->get_ordered_ops())
+    auto ordered_ops = func->get_ordered_ops();
+    for (auto n : *ordered_ops)
     {
         const Node& node = *n;
         if (TI(node) == TI(op::Concat))
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
+
+#include "ngraph/descriptor/output.hpp"
+#include "ngraph/descriptor/primary_tensor_view.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/op/sigmoid.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Both the Eigen/loop kernels and the MKLDNN eltwise and sum primitives read element i of every
+// input before writing element i of the output, so these ops can run in place.
+static bool is_in_place_elementwise(const shared_ptr<Node>& node)
+{
+    if (dynamic_pointer_cast<op::Softmax>(node))
+    {
+        return false;
+    }
+    return dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(node) ||
+           dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(node) ||
+           dynamic_pointer_cast<op::Convert>(node) || dynamic_pointer_cast<op::Sigmoid>(node);
+}
+
+static bool same_layout(const descriptor::Tensor& a, const descriptor::Tensor& b)
+{
+    auto layout_a = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+        a.get_primary_tensor_view()->get_tensor_view_layout());
+    auto layout_b = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(
+        b.get_primary_tensor_view()->get_tensor_view_layout());
+    return layout_a && layout_b && layout_a->get_mkldnn_format() == layout_b->get_mkldnn_format() &&
+           layout_a->get_strides() == layout_b->get_strides();
+}
+
+bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(shared_ptr<Function> function)
+{
+    auto ordered_ops = function->get_ordered_ops();
+    for (shared_ptr<Node> node : *ordered_ops)
+    {
+        auto op = dynamic_pointer_cast<ngraph::op::Op>(node);
+        if (!op || !is_in_place_elementwise(node))
+        {
+            continue;
+        }
+
+        descriptor::Tensor& output = node->get_output_tensor(0);
+        for (size_t i = 0; i < node->get_input_size(); i++)
+        {
+            descriptor::Tensor& input = node->get_inputs().at(i).get_tensor();
+            if (input.get_element_type().size() != output.get_element_type().size() ||
+                !same_layout(input, output))
+            {
+                continue;
+            }
+            auto op_annotations = op->get_op_annotations();
+            if (!op_annotations)
+            {
+                op_annotations = make_shared<runtime::cpu::CPUOpAnnotations>();
+                op->set_op_annotations(op_annotations);
+            }
+            op_annotations->add_in_place_oi_pair({0, i});
+        }
+    }
+    return false;
+}
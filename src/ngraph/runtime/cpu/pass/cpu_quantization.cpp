@@ -0,0 +1,220 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "ngraph/runtime/cpu/pass/cpu_quantization.hpp"
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Ops that only select or reorder elements, so they commute with Dequantize
+static bool commutes_with_dequantize(const shared_ptr<Node>& node)
+{
+    if (dynamic_pointer_cast<op::Reshape>(node) || dynamic_pointer_cast<op::Slice>(node))
+    {
+        return true;
+    }
+    // Elements of the padding are not part of the tensor, so they have no quantized value
+    if (auto max_pool = dynamic_pointer_cast<op::MaxPool>(node))
+    {
+        for (size_t i = 0; i < max_pool->get_padding_below().size(); i++)
+        {
+            if (max_pool->get_padding_below()[i] != 0 || max_pool->get_padding_above()[i] != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+static shared_ptr<Node> quantize_convolution(const shared_ptr<op::Convolution>& convolution)
+{
+    auto data = dynamic_pointer_cast<op::Dequantize>(convolution->get_argument(0));
+    auto filters = dynamic_pointer_cast<op::Dequantize>(convolution->get_argument(1));
+    if (!data || !filters || filters->get_zero_point() != 0)
+    {
+        return nullptr;
+    }
+    return make_shared<op::QuantizedConvolution>(data->get_argument(0),
+                                                 filters->get_argument(0),
+                                                 convolution->get_window_movement_strides(),
+                                                 convolution->get_window_dilation_strides(),
+                                                 convolution->get_padding_below(),
+                                                 convolution->get_padding_above(),
+                                                 convolution->get_data_dilation_strides(),
+                                                 data->get_scale(),
+                                                 data->get_zero_point(),
+                                                 filters->get_scale(),
+                                                 convolution->get_element_type());
+}
+
+static shared_ptr<Node> quantize_dot(const shared_ptr<op::Dot>& dot)
+{
+    auto arg0 = dynamic_pointer_cast<op::Dequantize>(dot->get_argument(0));
+    auto arg1 = dynamic_pointer_cast<op::Dequantize>(dot->get_argument(1));
+    if (!arg0 || !arg1)
+    {
+        return nullptr;
+    }
+    return make_shared<op::QuantizedDot>(arg0->get_argument(0),
+                                         arg1->get_argument(0),
+                                         dot->get_reduction_axes_count(),
+                                         arg0->get_scale(),
+                                         arg0->get_zero_point(),
+                                         arg1->get_scale(),
+                                         arg1->get_zero_point(),
+                                         dot->get_element_type());
+}
+
+// Returns the quantized op producing the output of quantize from the real output of arg
+static shared_ptr<Node> requantize(const shared_ptr<Node>& arg,
+                                   const shared_ptr<op::Quantize>& quantize)
+{
+    if (!arg->get_element_type().is_real())
+    {
+        return nullptr;
+    }
+    if (auto conv = dynamic_pointer_cast<op::QuantizedConvolution>(arg))
+    {
+        return make_shared<op::QuantizedConvolution>(conv->get_argument(0),
+                                                     conv->get_argument(1),
+                                                     conv->get_window_movement_strides(),
+                                                     conv->get_window_dilation_strides(),
+                                                     conv->get_padding_below(),
+                                                     conv->get_padding_above(),
+                                                     conv->get_data_dilation_strides(),
+                                                     conv->get_data_scale(),
+                                                     conv->get_data_zero_point(),
+                                                     conv->get_filter_scale(),
+                                                     quantize->get_element_type(),
+                                                     quantize->get_scale(),
+                                                     quantize->get_zero_point());
+    }
+    if (auto dot = dynamic_pointer_cast<op::QuantizedDot>(arg))
+    {
+        return make_shared<op::QuantizedDot>(dot->get_argument(0),
+                                             dot->get_argument(1),
+                                             dot->get_reduction_axes_count(),
+                                             dot->get_arg0_scale(),
+                                             dot->get_arg0_zero_point(),
+                                             dot->get_arg1_scale(),
+                                             dot->get_arg1_zero_point(),
+                                             quantize->get_element_type(),
+                                             quantize->get_scale(),
+                                             quantize->get_zero_point());
+    }
+    return nullptr;
+}
+
+static shared_ptr<Node> rewrite_quantize(const shared_ptr<op::Quantize>& quantize)
+{
+    shared_ptr<Node> arg = quantize->get_argument(0);
+    bool exclusive = arg->get_users().size() == 1;
+
+    int64_t lowest = quantize->get_element_type() == element::i8 ? -128 : 0;
+    if (dynamic_pointer_cast<op::Relu>(arg) && quantize->get_zero_point() == lowest)
+    {
+        arg = arg->get_argument(0);
+        exclusive = exclusive && arg->get_users().size() == 1;
+    }
+
+    if (auto dequantize = dynamic_pointer_cast<op::Dequantize>(arg))
+    {
+        shared_ptr<Node> quantized = dequantize->get_argument(0);
+        if (quantized->get_element_type() == quantize->get_element_type() &&
+            dequantize->get_scale() == quantize->get_scale() &&
+            dequantize->get_zero_point() == quantize->get_zero_point())
+        {
+            return quantized;
+        }
+    }
+    else if (exclusive)
+    {
+        if (auto requantized = requantize(arg, quantize))
+        {
+            return requantized;
+        }
+    }
+
+    if (arg != quantize->get_argument(0))
+    {
+        return make_shared<op::Quantize>(
+            arg, quantize->get_element_type(), quantize->get_scale(), quantize->get_zero_point());
+    }
+    return nullptr;
+}
+
+bool runtime::cpu::pass::CPUQuantization::run_on_function(shared_ptr<ngraph::Function> function)
+{
+    bool replaced = false;
+    auto ordered_ops = function->get_ordered_ops();
+    for (shared_ptr<Node> node : *ordered_ops)
+    {
+        // Skip nodes that an earlier rewrite took out of the graph
+        if (node->get_users().empty())
+        {
+            continue;
+        }
+
+        shared_ptr<Node> replacement;
+        if (auto convolution = dynamic_pointer_cast<op::Convolution>(node))
+        {
+            replacement = quantize_convolution(convolution);
+        }
+        else if (auto dot = dynamic_pointer_cast<op::Dot>(node))
+        {
+            replacement = quantize_dot(dot);
+        }
+        else if (auto quantize = dynamic_pointer_cast<op::Quantize>(node))
+        {
+            replacement = rewrite_quantize(quantize);
+        }
+        else if (commutes_with_dequantize(node))
+        {
+            if (auto dequantize = dynamic_pointer_cast<op::Dequantize>(node->get_argument(0)))
+            {
+                auto moved = node->copy_with_new_args({dequantize->get_argument(0)});
+                replacement = make_shared<op::Dequantize>(moved,
+                                                          dequantize->get_element_type(),
+                                                          dequantize->get_scale(),
+                                                          dequantize->get_zero_point());
+            }
+        }
+
+        if (replacement)
+        {
+            NGRAPH_DEBUG << "Replacing " << node->get_name() << " with "
+                         << replacement->get_name();
+            replace_node(node, replacement);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace pass
+            {
+                class CPUQuantization;
+            }
+        }
+    }
+}
+
+/// \brief Runs quantized regions of a graph on int8 kernels.
+///
+/// Frontends express a quantized model with f32 ops between Dequantize and Quantize. The pass
+/// rewrites, in topological order:
+///
+/// * Convolution and Dot whose arguments are all Dequantize into QuantizedConvolution and
+///   QuantizedDot, which read the quantized tensors directly. Convolution filters must be
+///   quantized symmetrically.
+/// * Reshape, Slice and unpadded MaxPool of a Dequantize into a Dequantize of the same op on
+///   the quantized tensor, so data movement stays in int8.
+/// * Quantize of a quantized op with a real output, its only user, into the quantized op with
+///   a quantized output, so the result is requantized without an f32 intermediate.
+/// * Quantize of a Dequantize with the same element type, scale and zero point into the
+///   quantized tensor itself.
+///
+/// A Relu in front of a Quantize whose zero point is the lowest value of its type is dropped,
+/// since saturation already clamps negative values to real zero. The pass runs before
+/// CPUFusion, which would otherwise fold the f32 convolutions into ops it cannot rewrite.
+///
+/// The CPU backend only runs the pass when NGRAPH_CPU_INT8 is set, because the int8 kernels
+/// round their accumulation differently and a requantized value may move by one step.
+class ngraph::runtime::cpu::pass::CPUQuantization : public ngraph::pass::FunctionPass
+{
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+};
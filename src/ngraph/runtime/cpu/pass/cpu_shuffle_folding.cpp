@@ -33,7 +33,8 @@ bool ngraph::runtime::cpu::pass::CPUShuffleFolding::run_on_function(
 {
     bool clobbered = false;
 
-    for (const auto& n : function->get_ordered_ops())
+    auto ordered_ops = function->get_ordered_ops();
+    for (const auto& n : *ordered_ops)
     {
         auto convert_layout = std::dynamic_pointer_cast<op::ConvertLayout>(n);
 
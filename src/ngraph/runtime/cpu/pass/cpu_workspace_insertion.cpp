@@ -76,7 +76,8 @@ bool runtime::cpu::pass::CPUWorkspaceInsertion::run_on_function(std::shared_ptr<
     auto matcher = create_maxpool_with_indices_matcher();
 
     bool replaced = false;
-    for (auto n : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto n : *ordered_ops)
     {
         if (n->is_output() || n->is_parameter())
         {
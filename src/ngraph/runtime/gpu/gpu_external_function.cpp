@@ -359,7 +359,8 @@ using namespace std;
     writer << "// Declare all constants\n";
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
-        for (shared_ptr<Node> node : current_function->get_ordered_ops())
+        auto ordered_ops = current_function->get_ordered_ops();
+        for (shared_ptr<Node> node : *ordered_ops)
         {
             const op::Constant* c = dynamic_cast<ngraph::op::Constant*>(node.get());
             if (c)
@@ -400,7 +401,7 @@ using namespace std;
     unordered_map<const Node*, string> node_function_map;
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
-        list<shared_ptr<Node>> tmp = current_function->get_ordered_ops();
+        list<shared_ptr<Node>> tmp = *current_function->get_ordered_ops();
         if (tmp.size() < 2)
         {
             // Since we are comparing ops there must be at least two ops to proceed.
@@ -442,6 +443,7 @@ using namespace std;
 
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
+        auto ordered_ops = current_function->get_ordered_ops();
         set<string> output_names;
         for (shared_ptr<Node> op : current_function->get_results())
         {
@@ -449,7 +451,7 @@ using namespace std;
             output_names.insert(tv->get_tensor().get_name());
         }
         set<descriptor::TensorView*> constants;
-        for (shared_ptr<Node> node : current_function->get_ordered_ops())
+        for (shared_ptr<Node> node : *ordered_ops)
         {
             if (dynamic_cast<ngraph::op::Constant*>(node.get()))
             {
@@ -464,7 +466,7 @@ using namespace std;
         writer << "{\n";
         writer.indent++;
 
-        for (shared_ptr<Node> node : current_function->get_ordered_ops())
+        for (shared_ptr<Node> node : *ordered_ops)
         {
             const op::Constant* c = dynamic_cast<op::Constant*>(node.get());
             if (c)
@@ -487,7 +489,7 @@ using namespace std;
 
         bool temporaries_used = false;
         size_t worst_case_tmp_size = 0;
-        for (shared_ptr<Node> node : current_function->get_ordered_ops())
+        for (shared_ptr<Node> node : *ordered_ops)
         {
             if (node->liveness_new_list.size() > 0)
             {
@@ -507,7 +509,7 @@ using namespace std;
                    << temp_pool_size << ");\n";
 
             // Add temporaries to the variable name map
-            for (shared_ptr<Node> node : current_function->get_ordered_ops())
+            for (shared_ptr<Node> node : *ordered_ops)
             {
                 for (descriptor::Tensor* tensor : node->liveness_new_list)
                 {
@@ -595,7 +597,7 @@ using namespace std;
             output_index++;
         }
 
-        for (shared_ptr<Node> node : current_function->get_ordered_ops())
+        for (shared_ptr<Node> node : *ordered_ops)
         {
             auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
             // with shared pointers, which is fine here but clang doesn't like it.)
@@ -16,12 +16,19 @@
 
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_view_layout.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/convert.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/select.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/pass/assign_layout.hpp"
+#include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -47,61 +54,108 @@ shared_ptr<runtime::TensorView> runtime::interpreter::INTBackend::create_tensor(
     return make_shared<runtime::HostTensorView>(type, shape, memory_pointer, "external");
 }
 
+// The reference kernels of elementwise ops read element i of every input before writing element
+// i of the output, so the output may overwrite an input of the same width. The pairs are kept
+// out of the op annotations, which belong to the caller's Function and may be shared with other
+// backends.
+static unordered_map<const Node*, vector<op::util::oi_pair>>
+    get_in_place_pairs(const shared_ptr<Function>& function)
+{
+    unordered_map<const Node*, vector<op::util::oi_pair>> in_place_pairs;
+    traverse_functions(function, [&in_place_pairs](shared_ptr<Function> f) {
+        auto ordered_ops = f->get_ordered_ops();
+        for (shared_ptr<Node> node : *ordered_ops)
+        {
+            bool elementwise =
+                (dynamic_pointer_cast<op::util::UnaryElementwiseArithmetic>(node) &&
+                 !dynamic_pointer_cast<op::Softmax>(node)) ||
+                dynamic_pointer_cast<op::util::BinaryElementwiseArithmetic>(node) ||
+                dynamic_pointer_cast<op::Convert>(node);
+            if (!elementwise)
+            {
+                continue;
+            }
+            for (size_t i = 0; i < node->get_input_size(); i++)
+            {
+                if (node->get_input_element_type(i).size() == node->get_element_type().size())
+                {
+                    in_place_pairs[node.get()].push_back({0, i});
+                }
+            }
+        }
+    });
+    return in_place_pairs;
+}
+
 bool runtime::interpreter::INTBackend::compile(shared_ptr<Function> function)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[function];
     if (!instance.m_is_compiled)
     {
-        instance.m_is_compiled = true;
         pass::Manager pass_manager;
+        pass_manager.register_pass<pass::ConstantFolding>();
         pass_manager.register_pass<pass::AssignLayout<DenseTensorViewLayout>>();
         pass_manager.register_pass<pass::Liveness>();
         pass_manager.run_passes(function);
+
+        // Collected once folding has settled the ops, so no pair refers to a replaced node
+        auto in_place_pairs = get_in_place_pairs(function);
+        pass::Manager layout_manager;
+        layout_manager.register_pass<pass::MemoryLayout>(
+            runtime::alignment,
+            false,
+            nullptr,
+            pass::MemoryLayout::Planner::INTERVAL,
+            [&in_place_pairs](const Node& node) {
+                auto it = in_place_pairs.find(&node);
+                return it == in_place_pairs.end() ? vector<op::util::oi_pair>{} : it->second;
+            });
+        layout_manager.run_passes(function);
+
+        build_plan(function, instance);
+        instance.m_is_compiled = true;
     }
 
     return true;
 }
 
-bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
-                                            const vector<shared_ptr<runtime::TensorView>>& outputs,
-                                            const vector<shared_ptr<runtime::TensorView>>& inputs)
+void runtime::interpreter::INTBackend::build_plan(const shared_ptr<Function>& function,
+                                                  FunctionInstance& instance)
 {
-    validate_call(function, outputs, inputs);
-
-    compile(function);
-    FunctionInstance& instance = m_function_map[function];
-
-    // convert inputs to HostTensorView
-    vector<shared_ptr<runtime::HostTensorView>> func_inputs;
-    for (auto tv : inputs)
-    {
-        func_inputs.push_back(static_pointer_cast<runtime::HostTensorView>(tv));
-    }
-    if (instance.m_nan_check_enabled)
+    vector<ExecutionStep> steps;
+    vector<TensorSlot> slots;
+    vector<size_t> input_slots;
+    vector<size_t> output_slots;
+    unordered_map<const descriptor::Tensor*, size_t> tensor_slots;
+    unordered_set<const descriptor::Tensor*> pooled_tensors;
+    auto ordered_ops = function->get_ordered_ops();
+    for (shared_ptr<Node> op : *ordered_ops)
     {
-        perform_nan_check(func_inputs);
+        pooled_tensors.insert(op->liveness_new_list.begin(), op->liveness_new_list.end());
     }
 
-    // convert outputs to HostTensorView
-    vector<shared_ptr<runtime::HostTensorView>> func_outputs;
-    for (auto tv : outputs)
-    {
-        func_outputs.push_back(static_pointer_cast<runtime::HostTensorView>(tv));
-    }
+    auto add_slot = [&](const Node& node, size_t i) {
+        const descriptor::Tensor* tensor = &node.get_output_tensor(i);
+        size_t slot = slots.size();
+        bool pooled = contains(pooled_tensors, tensor);
+        slots.push_back({node.get_output_element_type(i),
+                         node.get_output_shape(i),
+                         tensor->get_name(),
+                         pooled,
+                         pooled ? tensor->get_pool_offset() : 0});
+        tensor_slots.insert({tensor, slot});
+        return slot;
+    };
 
-    // map function params -> HostTensorView
-    unordered_map<descriptor::TensorView*, shared_ptr<runtime::HostTensorView>> tensor_map;
-    size_t input_count = 0;
+    // function params and outputs are bound to the caller's tensors
     for (auto param : function->get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::TensorView* tv = param->get_output_tensor_view(i).get();
-            tensor_map.insert({tv, func_inputs[input_count++]});
+            input_slots.push_back(add_slot(*param, i));
         }
     }
-
-    // map function outputs -> HostTensorView
     for (size_t output_count = 0; output_count < function->get_output_size(); ++output_count)
     {
         auto output = function->get_output_op(output_count);
@@ -109,46 +163,26 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         {
             throw ngraph_error("One of function's outputs isn't op::Result");
         }
-        descriptor::TensorView* tv = output->get_output_tensor_view(0).get();
-        tensor_map.insert({tv, func_outputs[output_count]});
+        output_slots.push_back(add_slot(*output, 0));
     }
 
-    // for each ordered op in the graph
-    for (shared_ptr<Node> op : function->get_ordered_ops())
+    for (shared_ptr<Node> op : *ordered_ops)
     {
-        if (op->description() == "Parameter")
+        if (op->is_parameter())
         {
             continue;
         }
 
-        // get op inputs from map
-        vector<shared_ptr<runtime::HostTensorView>> op_inputs;
+        ExecutionStep step;
+        step.node = op.get();
         for (const descriptor::Input& input : op->get_inputs())
         {
-            descriptor::TensorView* tv = input.get_output().get_tensor_view().get();
-            op_inputs.push_back(tensor_map.at(tv));
+            step.input_slots.push_back(tensor_slots.at(&input.get_tensor()));
         }
-
-        // get op outputs from map or create
-        vector<shared_ptr<runtime::HostTensorView>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
-            descriptor::TensorView* tv = op->get_output_tensor_view(i).get();
-            shared_ptr<runtime::HostTensorView> htv;
-            if (!contains_key(tensor_map, tv))
-            {
-                // the output tensor is not in the tensor map so create a new tensor
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->get_output_tensor(i).get_name();
-                htv = make_shared<runtime::HostTensorView>(type, shape, name);
-                tensor_map.insert({tv, htv});
-            }
-            else
-            {
-                htv = tensor_map.at(tv);
-            }
-            op_outputs.push_back(htv);
+            auto it = tensor_slots.find(&op->get_output_tensor(i));
+            step.output_slots.push_back(it == tensor_slots.end() ? add_slot(*op, i) : it->second);
         }
 
         // get op type
@@ -161,7 +195,7 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
             // Select has bool for first input and the type we are interested in for the second
             type = op->get_inputs().at(1).get_tensor().get_element_type();
         }
-        else if (dynamic_pointer_cast<op::Convert>(op))
+        else if (dynamic_pointer_cast<op::Convert>(op) || dynamic_pointer_cast<op::Quantize>(op))
         {
             type = op->get_inputs().at(0).get_tensor().get_element_type();
         }
@@ -169,87 +203,252 @@ bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
         {
             type = op->get_outputs().at(0).get_element_type();
         }
+        step.kernel = generate_kernel(type, *op);
+
+        steps.push_back(move(step));
+    }
+
+    instance.m_steps = move(steps);
+    instance.m_slots = move(slots);
+    instance.m_input_slots = move(input_slots);
+    instance.m_output_slots = move(output_slots);
+    instance.m_temporary_pool_size = function->get_temporary_pool_size();
+}
+
+unique_ptr<runtime::interpreter::INTBackend::TemporaryPool>
+    runtime::interpreter::INTBackend::acquire_pool(FunctionInstance& instance)
+{
+    {
+        lock_guard<mutex> pool_lock(instance.m_pool_mutex);
+        if (!instance.m_free_pools.empty())
+        {
+            unique_ptr<TemporaryPool> pool = move(instance.m_free_pools.back());
+            instance.m_free_pools.pop_back();
+            return pool;
+        }
+    }
+
+    unique_ptr<TemporaryPool> pool(new TemporaryPool());
+    pool->m_buffer.initialize(instance.m_temporary_pool_size, runtime::alignment);
+    pool->m_tensors.resize(instance.m_slots.size());
+    for (size_t slot = 0; slot < instance.m_slots.size(); ++slot)
+    {
+        const TensorSlot& desc = instance.m_slots[slot];
+        if (desc.pooled)
+        {
+            pool->m_tensors[slot] = make_shared<runtime::HostTensorView>(
+                desc.type, desc.shape, pool->m_buffer.get_ptr(desc.pool_offset), desc.name);
+        }
+        else
+        {
+            pool->m_tensors[slot] =
+                make_shared<runtime::HostTensorView>(desc.type, desc.shape, desc.name);
+        }
+    }
+    return pool;
+}
+
+void runtime::interpreter::INTBackend::release_pool(FunctionInstance& instance,
+                                                    unique_ptr<TemporaryPool> pool)
+{
+    // drop the caller's tensors before the pool is reused
+    for (size_t slot : instance.m_input_slots)
+    {
+        pool->m_tensors[slot].reset();
+    }
+    for (size_t slot : instance.m_output_slots)
+    {
+        pool->m_tensors[slot].reset();
+    }
+    lock_guard<mutex> pool_lock(instance.m_pool_mutex);
+    instance.m_free_pools.push_back(move(pool));
+}
+
+bool runtime::interpreter::INTBackend::call(shared_ptr<Function> function,
+                                            const vector<shared_ptr<runtime::TensorView>>& outputs,
+                                            const vector<shared_ptr<runtime::TensorView>>& inputs)
+{
+    validate_call(function, outputs, inputs);
+
+    compile(function);
+    unique_lock<mutex> lock(m_function_map_mutex);
+    FunctionInstance& instance = m_function_map[function];
+    lock.unlock();
+
+    unique_lock<mutex> timer_lock;
+    if (instance.m_performance_counters_enabled)
+    {
+        timer_lock = unique_lock<mutex>(instance.m_timer_mutex);
+    }
+
+    unique_ptr<TemporaryPool> pool = acquire_pool(instance);
+
+    // bind the caller's tensors to the param and output slots
+    TensorViewPtrs func_inputs;
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        func_inputs.push_back(static_pointer_cast<runtime::HostTensorView>(inputs[i]));
+        pool->m_tensors[instance.m_input_slots[i]] = func_inputs.back();
+    }
+    if (instance.m_nan_check_enabled)
+    {
+        perform_nan_check(func_inputs);
+    }
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+        pool->m_tensors[instance.m_output_slots[i]] =
+            static_pointer_cast<runtime::HostTensorView>(outputs[i]);
+    }
+
+    run_plan(instance, *pool);
+
+    release_pool(instance, move(pool));
+
+    return true;
+}
+
+void runtime::interpreter::INTBackend::run_plan(FunctionInstance& instance, TemporaryPool& pool)
+{
+    TensorViewPtrs& op_inputs = pool.m_op_inputs;
+    TensorViewPtrs& op_outputs = pool.m_op_outputs;
+    for (const ExecutionStep& step : instance.m_steps)
+    {
+        op_inputs.clear();
+        for (size_t slot : step.input_slots)
+        {
+            op_inputs.push_back(pool.m_tensors[slot]);
+        }
+
+        op_outputs.clear();
+        for (size_t slot : step.output_slots)
+        {
+            op_outputs.push_back(pool.m_tensors[slot]);
+        }
 
         if (instance.m_performance_counters_enabled)
         {
-            instance.m_timer_map[op.get()].start();
+            instance.m_timer_map[step.node].start();
         }
-        generate_calls(type, *op, op_outputs, op_inputs);
+        step.kernel(op_outputs, op_inputs);
         if (instance.m_performance_counters_enabled)
         {
-            instance.m_timer_map[op.get()].stop();
+            instance.m_timer_map[step.node].stop();
         }
         if (instance.m_nan_check_enabled)
         {
-            perform_nan_check(op_outputs, op.get());
+            perform_nan_check(op_outputs, step.node);
         }
+    }
+}
 
-        // delete any obsolete tensors
-        for (const descriptor::Tensor* t : op->liveness_free_list)
-        {
-            for (auto it = tensor_map.begin(); it != tensor_map.end(); ++it)
-            {
-                if (it->second->get_tensor().get_name() == t->get_name())
-                {
-                    tensor_map.erase(it);
-                    break;
-                }
-            }
-        }
+runtime::interpreter::INTBackend::ScalarEvaluator::ScalarEvaluator(
+    INTBackend& backend, const shared_ptr<Function>& function)
+{
+    backend.compile(function);
+    {
+        lock_guard<mutex> lock(backend.m_function_map_mutex);
+        m_instance = &backend.m_function_map[function];
+    }
+    if (m_instance->m_performance_counters_enabled)
+    {
+        m_timer_lock = unique_lock<mutex>(m_instance->m_timer_mutex);
     }
 
-    return true;
+    const op::ParameterVector& params = function->get_parameters();
+    m_x = make_shared<runtime::HostTensorView>(
+        params.at(0)->get_element_type(), params.at(0)->get_shape(), "scalar_x");
+    m_y = make_shared<runtime::HostTensorView>(
+        params.at(1)->get_element_type(), params.at(1)->get_shape(), "scalar_y");
+    m_r = make_shared<runtime::HostTensorView>(
+        function->get_output_element_type(0), function->get_output_shape(0), "scalar_r");
+
+    m_pool = acquire_pool(*m_instance);
+    m_pool->m_tensors[m_instance->m_input_slots.at(0)] = m_x;
+    m_pool->m_tensors[m_instance->m_input_slots.at(1)] = m_y;
+    m_pool->m_tensors[m_instance->m_output_slots.at(0)] = m_r;
+}
+
+runtime::interpreter::INTBackend::ScalarEvaluator::~ScalarEvaluator()
+{
+    release_pool(*m_instance, move(m_pool));
+}
+
+string runtime::interpreter::INTBackend::get_scalar_op(const shared_ptr<Function>& function)
+{
+    const op::ParameterVector& params = function->get_parameters();
+    if (params.size() != 2 || function->get_output_size() != 1)
+    {
+        return "";
+    }
+    shared_ptr<Node> op = function->get_output_op(0)->get_argument(0);
+    if (op->get_input_size() != 2 || op->get_output_size() != 1)
+    {
+        return "";
+    }
+
+    string op_name = op->description();
+    shared_ptr<Node> arg0 = op->get_argument(0);
+    shared_ptr<Node> arg1 = op->get_argument(1);
+    if (arg0 == params[0] && arg1 == params[1])
+    {
+        return op_name;
+    }
+    // the commutative reductions may also take their parameters swapped
+    bool commutative = (op_name == "Add" || op_name == "Multiply" || op_name == "Maximum" ||
+                        op_name == "Minimum" || op_name == "And" || op_name == "Or");
+    if (commutative && arg0 == params[1] && arg1 == params[0])
+    {
+        return op_name;
+    }
+    return "";
 }
 
-void runtime::interpreter::INTBackend::generate_calls(
-    const element::Type& type,
-    Node& op,
-    const vector<shared_ptr<HostTensorView>>& outputs,
-    const vector<shared_ptr<HostTensorView>>& inputs)
+runtime::interpreter::INTBackend::OpKernel
+    runtime::interpreter::INTBackend::generate_kernel(const element::Type& type, Node& op)
 {
     if (type == element::boolean)
     {
-        op_engine<char>(op, outputs, inputs);
+        return make_kernel<char>(op);
     }
     else if (type == element::f32)
     {
-        op_engine<float>(op, outputs, inputs);
+        return make_kernel<float>(op);
     }
     else if (type == element::f64)
     {
-        op_engine<double>(op, outputs, inputs);
+        return make_kernel<double>(op);
     }
     else if (type == element::i8)
     {
-        op_engine<int8_t>(op, outputs, inputs);
+        return make_kernel<int8_t>(op);
     }
     else if (type == element::i16)
     {
-        op_engine<int16_t>(op, outputs, inputs);
+        return make_kernel<int16_t>(op);
     }
     else if (type == element::i32)
     {
-        op_engine<int32_t>(op, outputs, inputs);
+        return make_kernel<int32_t>(op);
     }
     else if (type == element::i64)
     {
-        op_engine<int64_t>(op, outputs, inputs);
+        return make_kernel<int64_t>(op);
     }
     else if (type == element::u8)
     {
-        op_engine<uint8_t>(op, outputs, inputs);
+        return make_kernel<uint8_t>(op);
     }
     else if (type == element::u16)
     {
-        op_engine<uint16_t>(op, outputs, inputs);
+        return make_kernel<uint16_t>(op);
     }
     else if (type == element::u32)
     {
-        op_engine<uint32_t>(op, outputs, inputs);
+        return make_kernel<uint32_t>(op);
     }
     else if (type == element::u64)
     {
-        op_engine<uint64_t>(op, outputs, inputs);
+        return make_kernel<uint64_t>(op);
     }
     else
     {
@@ -261,6 +460,7 @@ void runtime::interpreter::INTBackend::generate_calls(
 
 void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func, bool enable)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     instance.m_nan_check_enabled = enable;
 }
@@ -268,6 +468,7 @@ void runtime::interpreter::INTBackend::set_nan_check(shared_ptr<Function> func,
 void runtime::interpreter::INTBackend::enable_performance_data(shared_ptr<Function> func,
                                                                bool enable)
 {
+    lock_guard<mutex> lock(m_function_map_mutex);
     FunctionInstance& instance = m_function_map[func];
     instance.m_performance_counters_enabled = enable;
 }
@@ -276,6 +477,7 @@ vector<runtime::PerformanceCounter>
     runtime::interpreter::INTBackend::get_performance_data(shared_ptr<Function> func) const
 {
     vector<runtime::PerformanceCounter> rc;
+    lock_guard<mutex> lock(m_function_map_mutex);
     const FunctionInstance& instance = m_function_map.at(func);
     for (const pair<const Node*, stopwatch> p : instance.m_timer_map)
     {
@@ -16,11 +16,14 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor_view.hpp"
 #include "ngraph/runtime/tensor_view.hpp"
@@ -31,6 +34,7 @@
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max.hpp"
@@ -39,6 +43,7 @@
 #include "ngraph/op/one_hot.hpp"
 #include "ngraph/op/pad.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/replace_slice.hpp"
@@ -68,6 +73,7 @@
 #include "ngraph/runtime/reference/copy.hpp"
 #include "ngraph/runtime/reference/cos.hpp"
 #include "ngraph/runtime/reference/cosh.hpp"
+#include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
@@ -92,6 +98,7 @@
 #include "ngraph/runtime/reference/pad.hpp"
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
 #include "ngraph/runtime/reference/reduce.hpp"
 #include "ngraph/runtime/reference/reduce_window.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
@@ -149,6 +156,46 @@ public:
         get_performance_data(std::shared_ptr<Function> func) const override;
 
 private:
+    using TensorViewPtrs = std::vector<std::shared_ptr<HostTensorView>>;
+
+    /// @brief An op's reference kernel with the element type resolved and the op's attributes
+    ///        bound, called with the op's output and input tensors
+    using OpKernel = std::function<void(const TensorViewPtrs& out, const TensorViewPtrs& args)>;
+
+    /// @brief One op of a compiled function. Tensors are referred to by slot index.
+    struct ExecutionStep
+    {
+        Node* node;
+        OpKernel kernel;
+        std::vector<size_t> input_slots;
+        std::vector<size_t> output_slots;
+    };
+
+    /// @brief Shape, type and name used to create the tensor of an intermediate slot
+    struct TensorSlot
+    {
+        element::Type type;
+        Shape shape;
+        std::string name;
+        /// @brief Whether the tensor lives in the temporary pool at pool_offset. Tensors that
+        ///        MemoryLayout does not place, like constants, get their own buffer.
+        bool pooled;
+        size_t pool_offset;
+    };
+
+    /// @brief The intermediate tensors of one call, carved out of a single aligned buffer
+    ///        that is laid out by pass::MemoryLayout. Pools are reused across calls.
+    class TemporaryPool
+    {
+    public:
+        AlignedBuffer m_buffer;
+        /// @brief Tensor of every slot, the param and result slots are bound per call
+        TensorViewPtrs m_tensors;
+        // Argument lists handed to the kernels, kept to avoid reallocating them
+        TensorViewPtrs m_op_inputs;
+        TensorViewPtrs m_op_outputs;
+    };
+
     class FunctionInstance
     {
     public:
@@ -156,236 +203,377 @@ private:
         bool m_nan_check_enabled = false;
         bool m_performance_counters_enabled = false;
         std::unordered_map<const Node*, stopwatch> m_timer_map;
+        // Serializes calls while performance counters are collected
+        std::mutex m_timer_mutex;
+        std::vector<ExecutionStep> m_steps;
+        std::vector<TensorSlot> m_slots;
+        std::vector<size_t> m_input_slots;
+        std::vector<size_t> m_output_slots;
+        size_t m_temporary_pool_size = 0;
+        // Pools not in use by a call, more are created while calls overlap
+        std::vector<std::unique_ptr<TemporaryPool>> m_free_pools;
+        std::mutex m_pool_mutex;
     };
     std::map<std::shared_ptr<Function>, FunctionInstance> m_function_map;
+    mutable std::mutex m_function_map_mutex;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensorView>>&,
                                   const Node* op = nullptr);
 
-    void generate_calls(const element::Type& type,
-                        Node& op,
-                        const std::vector<std::shared_ptr<HostTensorView>>& outputs,
-                        const std::vector<std::shared_ptr<HostTensorView>>& inputs);
+    void build_plan(const std::shared_ptr<Function>& function, FunctionInstance& instance);
+    static std::unique_ptr<TemporaryPool> acquire_pool(FunctionInstance& instance);
+    static void release_pool(FunctionInstance& instance, std::unique_ptr<TemporaryPool> pool);
+
+    /// @brief Runs the steps of a compiled function on a pool whose param and result slots
+    ///        are already bound
+    static void run_plan(FunctionInstance& instance, TemporaryPool& pool);
+
+    /// @brief Evaluates a function of two scalars, such as the reduction function of a Reduce,
+    ///        element after element. The function is compiled once and its parameters and
+    ///        result stay bound to the same pool while the evaluator is alive.
+    class ScalarEvaluator
+    {
+    public:
+        ScalarEvaluator(INTBackend& backend, const std::shared_ptr<Function>& function);
+        ~ScalarEvaluator();
+
+        template <typename R, typename T>
+        R evaluate(T x, T y)
+        {
+            *(m_x->get_data_ptr<T>()) = x;
+            *(m_y->get_data_ptr<T>()) = y;
+            run_plan(*m_instance, *m_pool);
+            return *(m_r->get_data_ptr<R>());
+        }
+
+    private:
+        FunctionInstance* m_instance;
+        std::unique_ptr<TemporaryPool> m_pool;
+        std::unique_lock<std::mutex> m_timer_lock;
+        std::shared_ptr<HostTensorView> m_x;
+        std::shared_ptr<HostTensorView> m_y;
+        std::shared_ptr<HostTensorView> m_r;
+    };
+
+    /// @brief Returns the op of a function that applies one binary op to its two parameters,
+    ///        in order, or an empty string for any other function
+    static std::string get_scalar_op(const std::shared_ptr<Function>& function);
 
     template <typename T>
-    void op_engine(Node& node,
-                   const std::vector<std::shared_ptr<HostTensorView>>& out,
-                   const std::vector<std::shared_ptr<HostTensorView>>& args)
+    static std::function<T(T, T)> native_reduction(const std::string& op)
+    {
+        if (op == "Add")
+        {
+            return [](T x, T y) -> T { return x + y; };
+        }
+        else if (op == "Multiply")
+        {
+            return [](T x, T y) -> T { return x * y; };
+        }
+        else if (op == "Maximum")
+        {
+            return [](T x, T y) -> T { return x > y ? x : y; };
+        }
+        else if (op == "Minimum")
+        {
+            return [](T x, T y) -> T { return x < y ? x : y; };
+        }
+        else if (op == "And")
+        {
+            return [](T x, T y) -> T { return x && y; };
+        }
+        else if (op == "Or")
+        {
+            return [](T x, T y) -> T { return x || y; };
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+    static std::function<char(T, T)> native_selection(const std::string& op)
+    {
+        if (op == "Greater")
+        {
+            return [](T x, T y) -> char { return x > y; };
+        }
+        else if (op == "GreaterEq")
+        {
+            return [](T x, T y) -> char { return x >= y; };
+        }
+        return nullptr;
+    }
+
+    OpKernel generate_kernel(const element::Type& type, Node& op);
+
+    template <typename TI, typename TO>
+    static OpKernel convert_kernel(size_t count)
+    {
+        return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+            reference::convert<TI>(args[0]->get_data_ptr<TI>(), out[0]->get_data_ptr<TO>(), count);
+        };
+    }
+
+    template <typename TI, typename TO>
+    static OpKernel quantize_kernel(size_t count, double scale, int64_t zero_point)
+    {
+        return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+            reference::quantize<TI>(
+                args[0]->get_data_ptr<TI>(), out[0]->get_data_ptr<TO>(), count, scale, zero_point);
+        };
+    }
+
+    template <typename TI, typename TO>
+    static OpKernel dequantize_kernel(size_t count, double scale, int64_t zero_point)
+    {
+        return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+            reference::dequantize<TI>(
+                args[0]->get_data_ptr<TI>(), out[0]->get_data_ptr<TO>(), count, scale, zero_point);
+        };
+    }
+
+    template <typename T>
+    OpKernel make_kernel(Node& node)
     {
         std::string node_op = node.description();
+        size_t count = node.get_output_size() > 0 ? shape_size(node.get_output_shape(0)) : 0;
         if (node_op == "Abs")
         {
-            reference::abs<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::abs<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Acos")
         {
-            reference::acos<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::acos<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Add")
         {
-            reference::add<T>(args[0]->get_data_ptr<T>(),
-                              args[1]->get_data_ptr<T>(),
-                              out[0]->get_data_ptr<T>(),
-                              out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::add<T>(args[0]->get_data_ptr<T>(),
+                                  args[1]->get_data_ptr<T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  count);
+            };
         }
 #ifdef NGRAPH_DISTRIBUTED
         else if (node_op == "AllReduce")
         {
-            reference::allreduce<T>(args[0]->get_data_ptr<T>(),
-                                    out[0]->get_data_ptr<T>(),
-                                    args[0]->get_element_type(),
-                                    static_cast<int>(args[0]->get_element_count()));
+            element::Type type = node.get_input_element_type(0);
+            return [count, type](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::allreduce<T>(args[0]->get_data_ptr<T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        type,
+                                        static_cast<int>(count));
+            };
         }
 #endif
         else if (node_op == "And")
         {
-            reference::logical_and(args[0]->get_data_ptr<char>(),
-                                   args[1]->get_data_ptr<char>(),
-                                   out[0]->get_data_ptr<char>(),
-                                   out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::logical_and(args[0]->get_data_ptr<char>(),
+                                       args[1]->get_data_ptr<char>(),
+                                       out[0]->get_data_ptr<char>(),
+                                       count);
+            };
         }
         else if (node_op == "Asin")
         {
-            reference::asin<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::asin<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Atan")
         {
-            reference::atan<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::atan<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "AvgPool")
         {
             op::AvgPool* avg_pool = dynamic_cast<op::AvgPool*>(&node);
-
-            reference::avg_pool<T>(args[0]->get_data_ptr<T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   args[0]->get_shape(),
-                                   out[0]->get_shape(),
-                                   avg_pool->get_window_shape(),
-                                   avg_pool->get_window_movement_strides(),
-                                   avg_pool->get_padding_below(),
-                                   avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
+            Shape arg_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = avg_pool->get_window_shape();
+            Strides window_movement_strides = avg_pool->get_window_movement_strides();
+            Shape padding_below = avg_pool->get_padding_below();
+            Shape padding_above = avg_pool->get_padding_above();
+            bool include_padding = avg_pool->get_include_padding_in_avg_computation();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::avg_pool<T>(args[0]->get_data_ptr<T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg_shape,
+                                       out_shape,
+                                       window_shape,
+                                       window_movement_strides,
+                                       padding_below,
+                                       padding_above,
+                                       include_padding);
+            };
         }
         else if (node_op == "GetOutputElement")
         {
             const op::GetOutputElement* get_output_element =
                 static_cast<const op::GetOutputElement*>(&node);
             size_t n = get_output_element->get_n();
-            size_t num_bytes = out[0]->get_element_count() * out[0]->get_element_type().size();
-            std::memcpy(out[0]->get_data_ptr(), args[n]->get_data_ptr(), num_bytes);
+            size_t num_bytes = count * node.get_output_element_type(0).size();
+            return [n, num_bytes](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                std::memcpy(out[0]->get_data_ptr(), args[n]->get_data_ptr(), num_bytes);
+            };
         }
         else if (node_op == "BatchNorm")
         {
             ngraph::op::BatchNorm* bn = dynamic_cast<ngraph::op::BatchNorm*>(&node);
+            double eps = bn->get_eps_value();
+            Shape arg2_shape = node.get_input_shape(2);
             if (bn->get_output_size() == 3)
             {
-                reference::batch_norm_three_outputs<T>(
-                    bn->get_eps_value(),
-                    reinterpret_cast<T*>(args[0]->get_data_ptr()),
-                    reinterpret_cast<T*>(args[1]->get_data_ptr()),
-                    reinterpret_cast<T*>(args[2]->get_data_ptr()),
-                    reinterpret_cast<T*>(out[0]->get_data_ptr()),
-                    reinterpret_cast<T*>(out[1]->get_data_ptr()),
-                    reinterpret_cast<T*>(out[2]->get_data_ptr()),
-                    args[2]->get_shape());
+                return [eps, arg2_shape](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                    reference::batch_norm_three_outputs<T>(
+                        eps,
+                        reinterpret_cast<T*>(args[0]->get_data_ptr()),
+                        reinterpret_cast<T*>(args[1]->get_data_ptr()),
+                        reinterpret_cast<T*>(args[2]->get_data_ptr()),
+                        reinterpret_cast<T*>(out[0]->get_data_ptr()),
+                        reinterpret_cast<T*>(out[1]->get_data_ptr()),
+                        reinterpret_cast<T*>(out[2]->get_data_ptr()),
+                        arg2_shape);
+                };
             }
             else
             {
-                reference::batch_norm_one_output<T>(bn->get_eps_value(),
-                                                    reinterpret_cast<T*>(args[0]->get_data_ptr()),
-                                                    reinterpret_cast<T*>(args[1]->get_data_ptr()),
-                                                    reinterpret_cast<T*>(args[2]->get_data_ptr()),
-                                                    reinterpret_cast<T*>(args[3]->get_data_ptr()),
-                                                    reinterpret_cast<T*>(args[4]->get_data_ptr()),
-                                                    reinterpret_cast<T*>(out[0]->get_data_ptr()),
-                                                    args[2]->get_shape());
+                return [eps, arg2_shape](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                    reference::batch_norm_one_output<T>(
+                        eps,
+                        reinterpret_cast<T*>(args[0]->get_data_ptr()),
+                        reinterpret_cast<T*>(args[1]->get_data_ptr()),
+                        reinterpret_cast<T*>(args[2]->get_data_ptr()),
+                        reinterpret_cast<T*>(args[3]->get_data_ptr()),
+                        reinterpret_cast<T*>(args[4]->get_data_ptr()),
+                        reinterpret_cast<T*>(out[0]->get_data_ptr()),
+                        arg2_shape);
+                };
             }
         }
         else if (node_op == "AvgPoolBackprop")
         {
             op::AvgPoolBackprop* apb = dynamic_cast<op::AvgPoolBackprop*>(&node);
-            reference::avg_pool_backprop<T>(args[0]->get_data_ptr<T>(),
-                                            out[0]->get_data_ptr<T>(),
-                                            args[0]->get_shape(),
-                                            out[0]->get_shape(),
-                                            apb->get_window_shape(),
-                                            apb->get_window_movement_strides(),
-                                            apb->get_padding_below(),
-                                            apb->get_padding_above(),
-                                            apb->get_include_padding_in_avg_computation());
+            Shape delta_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = apb->get_window_shape();
+            Strides window_movement_strides = apb->get_window_movement_strides();
+            Shape padding_below = apb->get_padding_below();
+            Shape padding_above = apb->get_padding_above();
+            bool include_padding = apb->get_include_padding_in_avg_computation();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::avg_pool_backprop<T>(args[0]->get_data_ptr<T>(),
+                                                out[0]->get_data_ptr<T>(),
+                                                delta_shape,
+                                                out_shape,
+                                                window_shape,
+                                                window_movement_strides,
+                                                padding_below,
+                                                padding_above,
+                                                include_padding);
+            };
         }
         else if (node_op == "Broadcast")
         {
             op::Broadcast* broadcast = dynamic_cast<op::Broadcast*>(&node);
-            Shape in_shape = args[0]->get_shape();
-            Shape out_shape = out[0]->get_shape();
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
             AxisSet broadcast_axes = broadcast->get_broadcast_axes();
-            reference::broadcast<T>(args[0]->get_data_ptr<T>(),
-                                    out[0]->get_data_ptr<T>(),
-                                    in_shape,
-                                    out_shape,
-                                    broadcast_axes);
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::broadcast<T>(args[0]->get_data_ptr<T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        in_shape,
+                                        out_shape,
+                                        broadcast_axes);
+            };
         }
         else if (node_op == "Ceiling")
         {
-            reference::ceiling<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::ceiling<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Concat")
         {
             const op::Concat* concat = static_cast<const op::Concat*>(&node);
-            std::vector<const T*> in_args;
             std::vector<Shape> in_shapes;
-            for (std::shared_ptr<HostTensorView> arg : args)
+            for (size_t i = 0; i < node.get_input_size(); i++)
             {
-                in_args.push_back(arg->get_data_ptr<T>());
-                in_shapes.push_back(arg->get_shape());
+                in_shapes.push_back(node.get_input_shape(i));
             }
-            reference::concat<T>(in_args,
-                                 out[0]->get_data_ptr<T>(),
-                                 in_shapes,
-                                 out[0]->get_shape(),
-                                 concat->get_concatenation_axis());
+            Shape out_shape = node.get_output_shape(0);
+            size_t axis = concat->get_concatenation_axis();
+            return [in_shapes, out_shape, axis](const TensorViewPtrs& out,
+                                                const TensorViewPtrs& args) {
+                std::vector<const T*> in_args;
+                for (const std::shared_ptr<HostTensorView>& arg : args)
+                {
+                    in_args.push_back(arg->get_data_ptr<T>());
+                }
+                reference::concat<T>(
+                    in_args, out[0]->get_data_ptr<T>(), in_shapes, out_shape, axis);
+            };
         }
         else if (node_op == "Constant")
         {
             const op::Constant* c = static_cast<const op::Constant*>(&node);
-            reference::constant<T>(
-                c->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            std::shared_ptr<const void> data = c->get_data();
+            return [data, count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::constant<T>(
+                    static_cast<const T*>(data.get()), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Convert")
         {
-            // const op::Convert* c = static_cast<const op::Convert*>(&node);
             element::Type type = node.get_element_type();
             if (type == element::boolean)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<char>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, char>(count);
             }
             else if (type == element::f32)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<float>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, float>(count);
             }
             else if (type == element::f64)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<double>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, double>(count);
             }
             else if (type == element::i8)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<int8_t>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, int8_t>(count);
             }
             else if (type == element::i16)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<int16_t>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, int16_t>(count);
             }
             else if (type == element::i32)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<int32_t>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, int32_t>(count);
             }
             else if (type == element::i64)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<int64_t>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, int64_t>(count);
             }
             else if (type == element::u8)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<uint8_t>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, uint8_t>(count);
             }
             else if (type == element::u16)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<uint16_t>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, uint16_t>(count);
             }
             else if (type == element::u32)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<uint32_t>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, uint32_t>(count);
             }
             else if (type == element::u64)
             {
-                reference::convert<T>(args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<uint64_t>(),
-                                      out[0]->get_element_count());
+                return convert_kernel<T, uint64_t>(count);
             }
             else
             {
@@ -397,414 +585,578 @@ private:
         else if (node_op == "Convolution")
         {
             auto c = static_cast<const op::Convolution*>(&node);
-            reference::convolution<T>(args[0]->get_data_ptr<T>(),
-                                      args[1]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<T>(),
-                                      args[0]->get_shape(),
-                                      args[1]->get_shape(),
-                                      out[0]->get_shape(),
-                                      c->get_window_movement_strides(),
-                                      c->get_window_dilation_strides(),
-                                      c->get_padding_below(),
-                                      c->get_padding_above(),
-                                      c->get_data_dilation_strides(),
-                                      0,
-                                      1,
-                                      1,
-                                      0,
-                                      0,
-                                      1,
-                                      false);
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            Strides window_movement_strides = c->get_window_movement_strides();
+            Strides window_dilation_strides = c->get_window_dilation_strides();
+            CoordinateDiff padding_below = c->get_padding_below();
+            CoordinateDiff padding_above = c->get_padding_above();
+            Strides data_dilation_strides = c->get_data_dilation_strides();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::convolution<T>(args[0]->get_data_ptr<T>(),
+                                          args[1]->get_data_ptr<T>(),
+                                          out[0]->get_data_ptr<T>(),
+                                          arg0_shape,
+                                          arg1_shape,
+                                          out_shape,
+                                          window_movement_strides,
+                                          window_dilation_strides,
+                                          padding_below,
+                                          padding_above,
+                                          data_dilation_strides,
+                                          0,
+                                          1,
+                                          1,
+                                          0,
+                                          0,
+                                          1,
+                                          false);
+            };
         }
         else if (node_op == "ConvolutionBackpropFilters")
         {
             auto c = static_cast<const op::ConvolutionBackpropFilters*>(&node);
-            reference::convolution<T>(args[0]->get_data_ptr<T>(),
-                                      args[1]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<T>(),
-                                      args[0]->get_shape(),
-                                      args[1]->get_shape(),
-                                      out[0]->get_shape(),
-                                      c->get_window_movement_strides_backward(),
-                                      c->get_window_dilation_strides_backward(),
-                                      c->get_padding_below_backward(),
-                                      c->get_padding_above_backward(),
-                                      c->get_data_dilation_strides_backward(),
-                                      1,
-                                      0,
-                                      0,
-                                      1,
-                                      1,
-                                      0,
-                                      false);
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            Strides window_movement_strides = c->get_window_movement_strides_backward();
+            Strides window_dilation_strides = c->get_window_dilation_strides_backward();
+            CoordinateDiff padding_below = c->get_padding_below_backward();
+            CoordinateDiff padding_above = c->get_padding_above_backward();
+            Strides data_dilation_strides = c->get_data_dilation_strides_backward();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::convolution<T>(args[0]->get_data_ptr<T>(),
+                                          args[1]->get_data_ptr<T>(),
+                                          out[0]->get_data_ptr<T>(),
+                                          arg0_shape,
+                                          arg1_shape,
+                                          out_shape,
+                                          window_movement_strides,
+                                          window_dilation_strides,
+                                          padding_below,
+                                          padding_above,
+                                          data_dilation_strides,
+                                          1,
+                                          0,
+                                          0,
+                                          1,
+                                          1,
+                                          0,
+                                          false);
+            };
         }
         else if (node_op == "ConvolutionBackpropData")
         {
             // Note that args[1] and args[0] are switched here from the usual order.
             auto c = static_cast<const op::ConvolutionBackpropData*>(&node);
-            reference::convolution<T>(args[1]->get_data_ptr<T>(),
-                                      args[0]->get_data_ptr<T>(),
-                                      out[0]->get_data_ptr<T>(),
-                                      args[1]->get_shape(),
-                                      args[0]->get_shape(),
-                                      out[0]->get_shape(),
-                                      c->get_window_movement_strides_backward(),
-                                      c->get_window_dilation_strides_backward(),
-                                      c->get_padding_below_backward(),
-                                      c->get_padding_above_backward(),
-                                      c->get_data_dilation_strides_backward(),
-                                      0,
-                                      1,
-                                      0,
-                                      1,
-                                      0,
-                                      1,
-                                      true);
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            Strides window_movement_strides = c->get_window_movement_strides_backward();
+            Strides window_dilation_strides = c->get_window_dilation_strides_backward();
+            CoordinateDiff padding_below = c->get_padding_below_backward();
+            CoordinateDiff padding_above = c->get_padding_above_backward();
+            Strides data_dilation_strides = c->get_data_dilation_strides_backward();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::convolution<T>(args[1]->get_data_ptr<T>(),
+                                          args[0]->get_data_ptr<T>(),
+                                          out[0]->get_data_ptr<T>(),
+                                          arg1_shape,
+                                          arg0_shape,
+                                          out_shape,
+                                          window_movement_strides,
+                                          window_dilation_strides,
+                                          padding_below,
+                                          padding_above,
+                                          data_dilation_strides,
+                                          0,
+                                          1,
+                                          0,
+                                          1,
+                                          0,
+                                          1,
+                                          true);
+            };
         }
         else if (node_op == "Cos")
         {
-            reference::cos<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::cos<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Cosh")
         {
-            reference::cosh<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::cosh<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
+        }
+        else if (node_op == "Dequantize")
+        {
+            // T is the real output type
+            auto dequantize = static_cast<const op::Dequantize*>(&node);
+            double scale = dequantize->get_scale();
+            int64_t zero_point = dequantize->get_zero_point();
+            if (node.get_input_element_type(0) == element::i8)
+            {
+                return dequantize_kernel<int8_t, T>(count, scale, zero_point);
+            }
+            return dequantize_kernel<uint8_t, T>(count, scale, zero_point);
         }
         else if (node_op == "Divide")
         {
-            reference::divide<T>(args[0]->get_data_ptr<T>(),
-                                 args[1]->get_data_ptr<T>(),
-                                 out[0]->get_data_ptr<T>(),
-                                 out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::divide<T>(args[0]->get_data_ptr<T>(),
+                                     args[1]->get_data_ptr<T>(),
+                                     out[0]->get_data_ptr<T>(),
+                                     count);
+            };
         }
         else if (node_op == "Dot")
         {
             op::Dot* dot = dynamic_cast<op::Dot*>(&node);
-
-            reference::dot(args[0]->get_data_ptr<T>(),
-                           args[1]->get_data_ptr<T>(),
-                           out[0]->get_data_ptr<T>(),
-                           args[0]->get_shape(),
-                           args[1]->get_shape(),
-                           out[0]->get_shape(),
-                           dot->get_reduction_axes_count());
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            size_t reduction_axes_count = dot->get_reduction_axes_count();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::dot(args[0]->get_data_ptr<T>(),
+                               args[1]->get_data_ptr<T>(),
+                               out[0]->get_data_ptr<T>(),
+                               arg0_shape,
+                               arg1_shape,
+                               out_shape,
+                               reduction_axes_count);
+            };
         }
 
         else if (node_op == "Equal")
         {
-            reference::equal<T>(args[0]->get_data_ptr<T>(),
-                                args[1]->get_data_ptr<T>(),
-                                out[0]->get_data_ptr<char>(),
-                                out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::equal<T>(args[0]->get_data_ptr<T>(),
+                                    args[1]->get_data_ptr<T>(),
+                                    out[0]->get_data_ptr<char>(),
+                                    count);
+            };
         }
         else if (node_op == "Exp")
         {
-            reference::exp<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::exp<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Floor")
         {
-            reference::floor<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::floor<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "FunctionCall")
         {
             std::shared_ptr<Function> function = node.get_functions()[0];
-
-            std::vector<std::shared_ptr<runtime::TensorView>> outputs;
-            for (auto tv : out)
-            {
-                outputs.push_back(std::static_pointer_cast<runtime::TensorView>(tv));
-            }
-
-            std::vector<std::shared_ptr<runtime::TensorView>> inputs;
-            for (auto tv : args)
-            {
-                inputs.push_back(std::static_pointer_cast<runtime::TensorView>(tv));
-            }
-
-            call(function, outputs, inputs);
+            return [this, function](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                std::vector<std::shared_ptr<runtime::TensorView>> outputs(out.begin(), out.end());
+                std::vector<std::shared_ptr<runtime::TensorView>> inputs(args.begin(), args.end());
+                call(function, outputs, inputs);
+            };
         }
         else if (node_op == "Greater")
         {
-            reference::greater<T>(args[0]->get_data_ptr<T>(),
-                                  args[1]->get_data_ptr<T>(),
-                                  out[0]->get_data_ptr<char>(),
-                                  out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::greater<T>(args[0]->get_data_ptr<T>(),
+                                      args[1]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<char>(),
+                                      count);
+            };
         }
         else if (node_op == "GreaterEq")
         {
-            reference::greater_eq<T>(args[0]->get_data_ptr<T>(),
-                                     args[1]->get_data_ptr<T>(),
-                                     out[0]->get_data_ptr<char>(),
-                                     out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::greater_eq<T>(args[0]->get_data_ptr<T>(),
+                                         args[1]->get_data_ptr<T>(),
+                                         out[0]->get_data_ptr<char>(),
+                                         count);
+            };
         }
         else if (node_op == "Less")
         {
-            reference::less<T>(args[0]->get_data_ptr<T>(),
-                               args[1]->get_data_ptr<T>(),
-                               out[0]->get_data_ptr<char>(),
-                               out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::less<T>(args[0]->get_data_ptr<T>(),
+                                   args[1]->get_data_ptr<T>(),
+                                   out[0]->get_data_ptr<char>(),
+                                   count);
+            };
         }
         else if (node_op == "LessEq")
         {
-            reference::less_eq<T>(args[0]->get_data_ptr<T>(),
-                                  args[1]->get_data_ptr<T>(),
-                                  out[0]->get_data_ptr<char>(),
-                                  out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::less_eq<T>(args[0]->get_data_ptr<T>(),
+                                      args[1]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<char>(),
+                                      count);
+            };
         }
         else if (node_op == "Log")
         {
-            reference::log<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::log<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Max")
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
-            reference::max<T>(args[0]->get_data_ptr<T>(),
-                              out[0]->get_data_ptr<T>(),
-                              args[0]->get_shape(),
-                              out[0]->get_shape(),
-                              max->get_reduction_axes());
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = max->get_reduction_axes();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::max<T>(args[0]->get_data_ptr<T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  in_shape,
+                                  out_shape,
+                                  reduction_axes);
+            };
         }
         else if (node_op == "Maximum")
         {
-            reference::maximum<T>(args[0]->get_data_ptr<T>(),
-                                  args[1]->get_data_ptr<T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::maximum<T>(args[0]->get_data_ptr<T>(),
+                                      args[1]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      count);
+            };
         }
         else if (node_op == "MaxPool")
         {
             op::MaxPool* max_pool = dynamic_cast<op::MaxPool*>(&node);
-
-            reference::max_pool<T>(args[0]->get_data_ptr<T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   args[0]->get_shape(),
-                                   out[0]->get_shape(),
-                                   max_pool->get_window_shape(),
-                                   max_pool->get_window_movement_strides(),
-                                   max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
+            Shape arg_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = max_pool->get_window_shape();
+            Strides window_movement_strides = max_pool->get_window_movement_strides();
+            Shape padding_below = max_pool->get_padding_below();
+            Shape padding_above = max_pool->get_padding_above();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::max_pool<T>(args[0]->get_data_ptr<T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       arg_shape,
+                                       out_shape,
+                                       window_shape,
+                                       window_movement_strides,
+                                       padding_below,
+                                       padding_above);
+            };
         }
         else if (node_op == "MaxPoolBackprop")
         {
             op::MaxPoolBackprop* max_pool_backprop = dynamic_cast<op::MaxPoolBackprop*>(&node);
-
-            reference::max_pool_backprop<T>(args[0]->get_data_ptr<T>(),
-                                            args[1]->get_data_ptr<T>(),
-                                            out[0]->get_data_ptr<T>(),
-                                            args[1]->get_shape(),
-                                            out[0]->get_shape(),
-                                            max_pool_backprop->get_window_shape(),
-                                            max_pool_backprop->get_window_movement_strides(),
-                                            max_pool_backprop->get_padding_below(),
-                                            max_pool_backprop->get_padding_above());
+            Shape delta_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = max_pool_backprop->get_window_shape();
+            Strides window_movement_strides = max_pool_backprop->get_window_movement_strides();
+            Shape padding_below = max_pool_backprop->get_padding_below();
+            Shape padding_above = max_pool_backprop->get_padding_above();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::max_pool_backprop<T>(args[0]->get_data_ptr<T>(),
+                                                args[1]->get_data_ptr<T>(),
+                                                out[0]->get_data_ptr<T>(),
+                                                delta_shape,
+                                                out_shape,
+                                                window_shape,
+                                                window_movement_strides,
+                                                padding_below,
+                                                padding_above);
+            };
         }
         else if (node_op == "Min")
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
-            reference::min<T>(args[0]->get_data_ptr<T>(),
-                              out[0]->get_data_ptr<T>(),
-                              args[0]->get_shape(),
-                              out[0]->get_shape(),
-                              min->get_reduction_axes());
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = min->get_reduction_axes();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::min<T>(args[0]->get_data_ptr<T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  in_shape,
+                                  out_shape,
+                                  reduction_axes);
+            };
         }
         else if (node_op == "Minimum")
         {
-            reference::minimum<T>(args[0]->get_data_ptr<T>(),
-                                  args[1]->get_data_ptr<T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::minimum<T>(args[0]->get_data_ptr<T>(),
+                                      args[1]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      count);
+            };
         }
         else if (node_op == "Multiply")
         {
-            reference::multiply<T>(args[0]->get_data_ptr<T>(),
-                                   args[1]->get_data_ptr<T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::multiply<T>(args[0]->get_data_ptr<T>(),
+                                       args[1]->get_data_ptr<T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       count);
+            };
         }
         else if (node_op == "Negative")
         {
-            reference::negate<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::negate<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Not")
         {
-            reference::logical_not(args[0]->get_data_ptr<char>(),
-                                   out[0]->get_data_ptr<char>(),
-                                   out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::logical_not(
+                    args[0]->get_data_ptr<char>(), out[0]->get_data_ptr<char>(), count);
+            };
         }
         else if (node_op == "NotEqual")
         {
-            reference::not_equal<T>(args[0]->get_data_ptr<T>(),
-                                    args[1]->get_data_ptr<T>(),
-                                    out[0]->get_data_ptr<char>(),
-                                    out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::not_equal<T>(args[0]->get_data_ptr<T>(),
+                                        args[1]->get_data_ptr<T>(),
+                                        out[0]->get_data_ptr<char>(),
+                                        count);
+            };
         }
         else if (node_op == "OneHot")
         {
             auto oh = static_cast<const op::OneHot*>(&node);
-            reference::one_hot<T>(args[0]->get_data_ptr<T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  args[0]->get_shape(),
-                                  out[0]->get_shape(),
-                                  oh->get_one_hot_axis());
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            size_t one_hot_axis = oh->get_one_hot_axis();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::one_hot<T>(args[0]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      in_shape,
+                                      out_shape,
+                                      one_hot_axis);
+            };
         }
         else if (node_op == "Or")
         {
-            reference::logical_or(args[0]->get_data_ptr<char>(),
-                                  args[1]->get_data_ptr<char>(),
-                                  out[0]->get_data_ptr<char>(),
-                                  out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::logical_or(args[0]->get_data_ptr<char>(),
+                                      args[1]->get_data_ptr<char>(),
+                                      out[0]->get_data_ptr<char>(),
+                                      count);
+            };
         }
         else if (node_op == "Parameter")
         {
+            return [](const TensorViewPtrs& out, const TensorViewPtrs& args) {};
         }
         else if (node_op == "Pad")
         {
             op::Pad* pad = dynamic_cast<op::Pad*>(&node);
-
-            reference::pad(args[0]->get_data_ptr<T>(),
-                           args[1]->get_data_ptr<T>(),
-                           out[0]->get_data_ptr<T>(),
-                           node.get_inputs().at(0).get_shape(),
-                           node.get_output_shape(0),
-                           pad->get_padding_below(),
-                           pad->get_padding_above(),
-                           pad->get_padding_interior());
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            Shape padding_below = pad->get_padding_below();
+            Shape padding_above = pad->get_padding_above();
+            Shape padding_interior = pad->get_padding_interior();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::pad(args[0]->get_data_ptr<T>(),
+                               args[1]->get_data_ptr<T>(),
+                               out[0]->get_data_ptr<T>(),
+                               in_shape,
+                               out_shape,
+                               padding_below,
+                               padding_above,
+                               padding_interior);
+            };
         }
         else if (node_op == "Power")
         {
-            reference::power<T>(args[0]->get_data_ptr<T>(),
-                                args[1]->get_data_ptr<T>(),
-                                out[0]->get_data_ptr<T>(),
-                                out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::power<T>(args[0]->get_data_ptr<T>(),
+                                    args[1]->get_data_ptr<T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    count);
+            };
         }
         else if (node_op == "Product")
         {
             const op::Product* product = static_cast<const op::Product*>(&node);
-            reference::product<T>(args[0]->get_data_ptr<T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  args[0]->get_shape(),
-                                  out[0]->get_shape(),
-                                  product->get_reduction_axes());
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = product->get_reduction_axes();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::product<T>(args[0]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      in_shape,
+                                      out_shape,
+                                      reduction_axes);
+            };
+        }
+        else if (node_op == "Quantize")
+        {
+            // T is the real input type
+            auto quantize = static_cast<const op::Quantize*>(&node);
+            double scale = quantize->get_scale();
+            int64_t zero_point = quantize->get_zero_point();
+            if (node.get_element_type() == element::i8)
+            {
+                return quantize_kernel<T, int8_t>(count, scale, zero_point);
+            }
+            return quantize_kernel<T, uint8_t>(count, scale, zero_point);
         }
         else if (node_op == "Reduce")
         {
             op::Reduce* reduce = dynamic_cast<op::Reduce*>(&node);
             std::shared_ptr<Function> reduction_function = reduce->get_functions()[0];
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = reduce->get_reduction_axes();
 
-            std::function<T(T, T)> f = [this, &node, reduction_function](T x, T y) -> T {
-                auto tx = std::make_shared<HostTensorView>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, "reduce_temp_x");
-                auto ty = std::make_shared<HostTensorView>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, "reduce_temp_y");
-                auto tr = std::make_shared<HostTensorView>(
-                    node.get_output_element_type(0), Shape{}, "reduce_temp_r");
-                *(tx->get_data_ptr<T>()) = x;
-                *(ty->get_data_ptr<T>()) = y;
-                call(reduction_function, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<T>());
-            };
-
-            reference::reduce(args[0]->get_data_ptr<T>(),
-                              args[1]->get_data_ptr<T>(),
-                              out[0]->get_data_ptr<T>(),
-                              node.get_inputs().at(0).get_shape(),
-                              node.get_output_shape(0),
-                              reduce->get_reduction_axes(),
-                              f);
+            std::function<T(T, T)> f = native_reduction<T>(get_scalar_op(reduction_function));
+            if (f)
+            {
+                return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                    reference::reduce(args[0]->get_data_ptr<T>(),
+                                      args[1]->get_data_ptr<T>(),
+                                      out[0]->get_data_ptr<T>(),
+                                      in_shape,
+                                      out_shape,
+                                      reduction_axes,
+                                      f);
+                };
+            }
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                ScalarEvaluator evaluator(*this, reduction_function);
+                reference::reduce(args[0]->get_data_ptr<T>(),
+                                  args[1]->get_data_ptr<T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  in_shape,
+                                  out_shape,
+                                  reduction_axes,
+                                  std::function<T(T, T)>([&evaluator](T x, T y) -> T {
+                                      return evaluator.evaluate<T>(x, y);
+                                  }));
+            };
         }
         else if (node_op == "ReduceWindow")
         {
             op::ReduceWindow* reduce_window = dynamic_cast<op::ReduceWindow*>(&node);
             std::shared_ptr<Function> reduction_function = reduce_window->get_functions()[0];
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = reduce_window->get_window_shape();
+            Strides window_movement_strides = reduce_window->get_window_movement_strides();
 
-            std::function<T(T, T)> f = [this, &node, reduction_function](T x, T y) -> T {
-                auto tx = std::make_shared<HostTensorView>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, "reduce_window_temp_x");
-                auto ty = std::make_shared<HostTensorView>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, "reduce_window_temp_y");
-                auto tr = std::make_shared<HostTensorView>(
-                    node.get_output_element_type(0), Shape{}, "reduce_window_temp_r");
-                *(tx->get_data_ptr<T>()) = x;
-                *(ty->get_data_ptr<T>()) = y;
-                call(reduction_function, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<T>());
+            std::function<T(T, T)> f = native_reduction<T>(get_scalar_op(reduction_function));
+            if (f)
+            {
+                return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                    reference::reduce_window(args[0]->get_data_ptr<T>(),
+                                             args[1]->get_data_ptr<T>(),
+                                             out[0]->get_data_ptr<T>(),
+                                             in_shape,
+                                             out_shape,
+                                             f,
+                                             window_shape,
+                                             window_movement_strides);
+                };
+            }
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                ScalarEvaluator evaluator(*this, reduction_function);
+                reference::reduce_window(args[0]->get_data_ptr<T>(),
+                                         args[1]->get_data_ptr<T>(),
+                                         out[0]->get_data_ptr<T>(),
+                                         in_shape,
+                                         out_shape,
+                                         std::function<T(T, T)>([&evaluator](T x, T y) -> T {
+                                             return evaluator.evaluate<T>(x, y);
+                                         }),
+                                         window_shape,
+                                         window_movement_strides);
             };
-
-            reference::reduce_window(args[0]->get_data_ptr<T>(),
-                                     args[1]->get_data_ptr<T>(),
-                                     out[0]->get_data_ptr<T>(),
-                                     node.get_inputs().at(0).get_shape(),
-                                     node.get_output_shape(0),
-                                     f,
-                                     reduce_window->get_window_shape(),
-                                     reduce_window->get_window_movement_strides());
         }
         else if (node_op == "Relu")
         {
-            reference::relu<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::relu<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "ReluBackprop")
         {
-            reference::relu_backprop<T>(args[0]->get_data_ptr<T>(),
-                                        args[1]->get_data_ptr<T>(),
-                                        out[0]->get_data_ptr<T>(),
-                                        out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::relu_backprop<T>(args[0]->get_data_ptr<T>(),
+                                            args[1]->get_data_ptr<T>(),
+                                            out[0]->get_data_ptr<T>(),
+                                            count);
+            };
         }
         else if (node_op == "ReplaceSlice")
         {
             const op::ReplaceSlice* slice = static_cast<const op::ReplaceSlice*>(&node);
-            reference::replace_slice<T>(args[0]->get_data_ptr<T>(),
-                                        args[1]->get_data_ptr<T>(),
-                                        out[0]->get_data_ptr<T>(),
-                                        args[1]->get_shape(),
-                                        slice->get_lower_bounds(),
-                                        slice->get_upper_bounds(),
-                                        slice->get_strides(),
-                                        out[0]->get_shape());
+            Shape arg1_shape = node.get_input_shape(1);
+            Coordinate lower_bounds = slice->get_lower_bounds();
+            Coordinate upper_bounds = slice->get_upper_bounds();
+            Strides strides = slice->get_strides();
+            Shape out_shape = node.get_output_shape(0);
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::replace_slice<T>(args[0]->get_data_ptr<T>(),
+                                            args[1]->get_data_ptr<T>(),
+                                            out[0]->get_data_ptr<T>(),
+                                            arg1_shape,
+                                            lower_bounds,
+                                            upper_bounds,
+                                            strides,
+                                            out_shape);
+            };
         }
         else if (node_op == "Reshape")
         {
             op::Reshape* reshape = dynamic_cast<op::Reshape*>(&node);
-            reference::reshape(args[0]->get_data_ptr<T>(),
-                               out[0]->get_data_ptr<T>(),
-                               args[0]->get_shape(),
-                               reshape->get_input_order(),
-                               out[0]->get_shape());
+            Shape in_shape = node.get_input_shape(0);
+            AxisVector input_order = reshape->get_input_order();
+            Shape out_shape = node.get_output_shape(0);
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::reshape(args[0]->get_data_ptr<T>(),
+                                   out[0]->get_data_ptr<T>(),
+                                   in_shape,
+                                   input_order,
+                                   out_shape);
+            };
         }
         else if (node_op == "Result")
         {
-            op::Result* res = dynamic_cast<op::Result*>(&node);
-            reference::result(args[0]->get_data_ptr<T>(),
-                              out[0]->get_data_ptr<T>(),
-                              shape_size(res->get_shape()));
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::result(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Reverse")
         {
             op::Reverse* reverse = dynamic_cast<op::Reverse*>(&node);
-            reference::reverse(args[0]->get_data_ptr<T>(),
-                               out[0]->get_data_ptr<T>(),
-                               args[0]->get_shape(),
-                               out[0]->get_shape(),
-                               reverse->get_reversed_axes());
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reversed_axes = reverse->get_reversed_axes();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::reverse(args[0]->get_data_ptr<T>(),
+                                   out[0]->get_data_ptr<T>(),
+                                   in_shape,
+                                   out_shape,
+                                   reversed_axes);
+            };
         }
         else if (node_op == "ReverseSequence")
         {
             op::ReverseSequence* reverse = dynamic_cast<op::ReverseSequence*>(&node);
 
-            if (args[1]->get_element_type() == element::i32)
+            if (node.get_input_element_type(1) == element::i32)
             {
-                reference::reverse_sequence<T, int>(args[0]->get_data_ptr<T>(),
-                                                    out[0]->get_data_ptr<T>(),
-                                                    args[0]->get_shape(),
-                                                    reverse->get_batch_axis(),
-                                                    reverse->get_sequence_axis(),
-                                                    args[1]->get_data_ptr<int>());
+                Shape in_shape = node.get_input_shape(0);
+                size_t batch_axis = reverse->get_batch_axis();
+                size_t sequence_axis = reverse->get_sequence_axis();
+                return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                    reference::reverse_sequence<T, int>(args[0]->get_data_ptr<T>(),
+                                                        out[0]->get_data_ptr<T>(),
+                                                        in_shape,
+                                                        batch_axis,
+                                                        sequence_axis,
+                                                        args[1]->get_data_ptr<int>());
+                };
             }
             else
             {
@@ -813,124 +1165,153 @@ private:
         }
         else if (node_op == "Select")
         {
-            reference::select<T>(args[0]->get_data_ptr<char>(),
-                                 args[1]->get_data_ptr<T>(),
-                                 args[2]->get_data_ptr<T>(),
-                                 out[0]->get_data_ptr<T>(),
-                                 out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::select<T>(args[0]->get_data_ptr<char>(),
+                                     args[1]->get_data_ptr<T>(),
+                                     args[2]->get_data_ptr<T>(),
+                                     out[0]->get_data_ptr<T>(),
+                                     count);
+            };
         }
         else if (node_op == "SelectAndScatter")
         {
             ngraph::op::SelectAndScatter* select_and_scatter =
                 dynamic_cast<ngraph::op::SelectAndScatter*>(&node);
-
             std::shared_ptr<ngraph::Function> selection_function =
                 select_and_scatter->get_functions()[0];
-            std::function<bool(T, T)> f_selection = [this, &node, selection_function](T x,
-                                                                                      T y) -> bool {
-                auto tx = std::make_shared<runtime::HostTensorView>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, "selection_temp_x");
-                auto ty = std::make_shared<runtime::HostTensorView>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, "selection_temp_y");
-                auto tr = std::make_shared<runtime::HostTensorView>(
-                    element::boolean, Shape{}, "selection_temp_r");
-                *(tx->get_data_ptr<T>()) = x;
-                *(ty->get_data_ptr<T>()) = y;
-                call(selection_function, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<char>());
-            };
-
             std::shared_ptr<ngraph::Function> scatter_function =
                 select_and_scatter->get_functions()[1];
-            std::function<T(T, T)> f_scatter = [this, &node, scatter_function](T x, T y) -> T {
-                auto tx = std::make_shared<runtime::HostTensorView>(
-                    node.get_inputs().at(0).get_element_type(), Shape{}, "scatter_temp_x");
-                auto ty = std::make_shared<runtime::HostTensorView>(
-                    node.get_inputs().at(1).get_element_type(), Shape{}, "scatter_temp_y");
-                auto tr = std::make_shared<runtime::HostTensorView>(
-                    node.get_output_element_type(0), Shape{}, "scatter_temp_r");
-                *(tx->get_data_ptr<T>()) = x;
-                *(ty->get_data_ptr<T>()) = y;
-                call(scatter_function, {tr}, {tx, ty});
-                return *(tr->get_data_ptr<T>());
-            };
-
-            reference::select_and_scatter<T>(args[0]->get_data_ptr<T>(),
-                                             args[1]->get_data_ptr<T>(),
-                                             args[2]->get_data_ptr<T>(),
-                                             out[0]->get_data_ptr<T>(),
-                                             args[0]->get_shape(),
-                                             args[1]->get_shape(),
-                                             out[0]->get_shape(),
-                                             f_selection,
-                                             f_scatter,
-                                             select_and_scatter->get_window_shape(),
-                                             select_and_scatter->get_window_movement_strides());
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            Shape window_shape = select_and_scatter->get_window_shape();
+            Strides window_movement_strides = select_and_scatter->get_window_movement_strides();
+
+            std::function<char(T, T)> native_f_selection =
+                native_selection<T>(get_scalar_op(selection_function));
+            std::function<T(T, T)> native_f_scatter =
+                native_reduction<T>(get_scalar_op(scatter_function));
+
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                std::unique_ptr<ScalarEvaluator> selection_evaluator;
+                std::function<char(T, T)> f_selection = native_f_selection;
+                if (!f_selection)
+                {
+                    selection_evaluator.reset(new ScalarEvaluator(*this, selection_function));
+                    ScalarEvaluator* evaluator = selection_evaluator.get();
+                    f_selection = [evaluator](T x, T y) -> char {
+                        return evaluator->evaluate<char>(x, y);
+                    };
+                }
+
+                std::unique_ptr<ScalarEvaluator> scatter_evaluator;
+                std::function<T(T, T)> f_scatter = native_f_scatter;
+                if (!f_scatter)
+                {
+                    scatter_evaluator.reset(new ScalarEvaluator(*this, scatter_function));
+                    ScalarEvaluator* evaluator = scatter_evaluator.get();
+                    f_scatter = [evaluator](T x, T y) -> T { return evaluator->evaluate<T>(x, y); };
+                }
+
+                reference::select_and_scatter<T>(args[0]->get_data_ptr<T>(),
+                                                 args[1]->get_data_ptr<T>(),
+                                                 args[2]->get_data_ptr<T>(),
+                                                 out[0]->get_data_ptr<T>(),
+                                                 arg0_shape,
+                                                 arg1_shape,
+                                                 out_shape,
+                                                 f_selection,
+                                                 f_scatter,
+                                                 window_shape,
+                                                 window_movement_strides);
+            };
         }
         else if (node_op == "Sign")
         {
-            reference::sign<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::sign<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Sin")
         {
-            reference::sin<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::sin<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Sinh")
         {
-            reference::sinh<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::sinh<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Slice")
         {
             const op::Slice* slice = static_cast<const op::Slice*>(&node);
-            reference::slice<T>(args[0]->get_data_ptr<T>(),
-                                out[0]->get_data_ptr<T>(),
-                                args[0]->get_shape(),
-                                slice->get_lower_bounds(),
-                                slice->get_upper_bounds(),
-                                slice->get_strides(),
-                                out[0]->get_shape());
+            Shape in_shape = node.get_input_shape(0);
+            Coordinate lower_bounds = slice->get_lower_bounds();
+            Coordinate upper_bounds = slice->get_upper_bounds();
+            Strides strides = slice->get_strides();
+            Shape out_shape = node.get_output_shape(0);
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::slice<T>(args[0]->get_data_ptr<T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    in_shape,
+                                    lower_bounds,
+                                    upper_bounds,
+                                    strides,
+                                    out_shape);
+            };
         }
         else if (node_op == "Softmax")
         {
             const op::Softmax* softmax = static_cast<const op::Softmax*>(&node);
-            reference::softmax<T>(args[0]->get_data_ptr<T>(),
-                                  out[0]->get_data_ptr<T>(),
-                                  out[0]->get_shape(),
-                                  softmax->get_axes());
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet axes = softmax->get_axes();
+            return [out_shape, axes](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::softmax<T>(
+                    args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out_shape, axes);
+            };
         }
         else if (node_op == "Sqrt")
         {
-            reference::sqrt<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::sqrt<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Subtract")
         {
-            reference::subtract<T>(args[0]->get_data_ptr<T>(),
-                                   args[1]->get_data_ptr<T>(),
-                                   out[0]->get_data_ptr<T>(),
-                                   out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::subtract<T>(args[0]->get_data_ptr<T>(),
+                                       args[1]->get_data_ptr<T>(),
+                                       out[0]->get_data_ptr<T>(),
+                                       count);
+            };
         }
         else if (node_op == "Sum")
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
-            reference::sum<T>(args[0]->get_data_ptr<T>(),
-                              out[0]->get_data_ptr<T>(),
-                              args[0]->get_shape(),
-                              out[0]->get_shape(),
-                              sum->get_reduction_axes());
+            Shape in_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = sum->get_reduction_axes();
+            return [=](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::sum<T>(args[0]->get_data_ptr<T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  in_shape,
+                                  out_shape,
+                                  reduction_axes);
+            };
         }
         else if (node_op == "Tan")
         {
-            reference::tan<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::tan<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else if (node_op == "Tanh")
         {
-            reference::tanh<T>(
-                args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), out[0]->get_element_count());
+            return [count](const TensorViewPtrs& out, const TensorViewPtrs& args) {
+                reference::tanh<T>(args[0]->get_data_ptr<T>(), out[0]->get_data_ptr<T>(), count);
+            };
         }
         else
         {
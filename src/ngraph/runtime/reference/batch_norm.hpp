@@ -19,8 +19,7 @@
 #include <cmath>
 #include <iostream>
 
-#include "ngraph/axis_vector.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -40,54 +39,54 @@ namespace ngraph
                                           const Shape& arg2_shape)
             {
                 auto eps_casted = static_cast<T>(eps);
+                auto batches = arg2_shape[0];
                 auto channels = arg2_shape[1];
-
-                // We use these objects to iterate over the indices in a channel.
-                // The start and end points for the channel axis are modified in the loop.
-                Coordinate start_corner;
-                Coordinate end_corner;
-                for (size_t i = 0; i < arg2_shape.size(); i++)
-                {
-                    start_corner.push_back(0);
-                    end_corner.push_back(arg2_shape[i]);
-                }
+                // Elements of one channel within one batch entry are contiguous.
+                size_t channel_size = shape_size(arg2_shape) / (batches * channels);
+                size_t batch_stride = channels * channel_size;
 
                 for (size_t c = 0; c < channels; c++)
                 {
                     T channel_sum = 0;
 
-                    start_corner[1] = c;
-                    end_corner[1] = c + 1;
-
                     // Compute the mean
-                    CoordinateTransform arg2_transform(arg2_shape, start_corner, end_corner);
-                    for (Coordinate arg2_coord : arg2_transform)
+                    for (size_t n = 0; n < batches; n++)
                     {
-                        channel_sum += arg2[arg2_transform.index(arg2_coord)];
+                        const T* in = arg2 + n * batch_stride + c * channel_size;
+                        for (size_t i = 0; i < channel_size; i++)
+                        {
+                            channel_sum += in[i];
+                        }
                     }
                     T channel_mean = channel_sum / (shape_size(arg2_shape) / channels);
                     out1[c] = channel_mean;
 
                     // Compute the variance
                     T channel_diff_square_sum = 0;
-                    for (Coordinate arg2_coord : arg2_transform)
+                    for (size_t n = 0; n < batches; n++)
                     {
-                        auto mean_diff = arg2[arg2_transform.index(arg2_coord)] - channel_mean;
-                        channel_diff_square_sum += mean_diff * mean_diff;
+                        const T* in = arg2 + n * batch_stride + c * channel_size;
+                        for (size_t i = 0; i < channel_size; i++)
+                        {
+                            auto mean_diff = in[i] - channel_mean;
+                            channel_diff_square_sum += mean_diff * mean_diff;
+                        }
                     }
                     T channel_var = channel_diff_square_sum / (shape_size(arg2_shape) / channels);
                     out2[c] = channel_var;
 
                     // Compute the normalized output
-                    for (Coordinate arg2_coord : arg2_transform)
+                    auto channel_gamma = arg0[c];
+                    auto channel_beta = arg1[c];
+                    for (size_t n = 0; n < batches; n++)
                     {
-                        auto channel_gamma = arg0[c];
-                        auto channel_beta = arg1[c];
-
-                        auto input_index = arg2_transform.index(arg2_coord);
-                        auto normalized = (arg2[input_index] - channel_mean) /
-                                          (std::sqrt(channel_var + eps_casted));
-                        out0[input_index] = normalized * channel_gamma + channel_beta;
+                        size_t offset = n * batch_stride + c * channel_size;
+                        for (size_t i = 0; i < channel_size; i++)
+                        {
+                            auto normalized = (arg2[offset + i] - channel_mean) /
+                                              (std::sqrt(channel_var + eps_casted));
+                            out0[offset + i] = normalized * channel_gamma + channel_beta;
+                        }
                     }
                 }
             }
@@ -103,20 +102,27 @@ namespace ngraph
                                        const Shape& arg2_shape)
             {
                 auto eps_casted = static_cast<T>(eps);
-                CoordinateTransform arg2_transform(arg2_shape);
+                auto batches = arg2_shape[0];
+                auto channels = arg2_shape[1];
+                size_t channel_size = shape_size(arg2_shape) / (batches * channels);
 
-                for (Coordinate arg2_coord : arg2_transform)
+                size_t input_index = 0;
+                for (size_t n = 0; n < batches; n++)
                 {
-                    auto channel_num = arg2_coord[1];
-                    auto channel_gamma = arg0[channel_num];
-                    auto channel_beta = arg1[channel_num];
-                    auto channel_mean = arg3[channel_num];
-                    auto channel_var = arg4[channel_num];
+                    for (size_t channel_num = 0; channel_num < channels; channel_num++)
+                    {
+                        auto channel_gamma = arg0[channel_num];
+                        auto channel_beta = arg1[channel_num];
+                        auto channel_mean = arg3[channel_num];
+                        auto channel_var = arg4[channel_num];
 
-                    auto input_index = arg2_transform.index(arg2_coord);
-                    auto normalized =
-                        (arg2[input_index] - channel_mean) / (std::sqrt(channel_var + eps_casted));
-                    out0[input_index] = normalized * channel_gamma + channel_beta;
+                        for (size_t i = 0; i < channel_size; i++, input_index++)
+                        {
+                            auto normalized = (arg2[input_index] - channel_mean) /
+                                              (std::sqrt(channel_var + eps_casted));
+                            out0[input_index] = normalized * channel_gamma + channel_beta;
+                        }
+                    }
                 }
             }
         }
@@ -18,7 +18,8 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/copy.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -35,41 +36,16 @@ namespace ngraph
             {
                 // We will copy the inputs to the output one at a time. As we go, we will move out along the
                 // concatenation axis, starting at 0.
+                ElementStrides out_strides = dense_strides(out_shape);
                 size_t concatenation_pos = 0;
 
                 for (size_t i = 0; i < args.size(); i++)
                 {
-                    // CoordinateTransform gets confused when the last input has a zero-size dim, so we will
-                    // just skip for zero-element tensors.
-                    if (shape_size(in_shapes[i]) == 0)
-                    {
-                        continue;
-                    }
-
-                    // The start coordinate for the copy is (0,...,0) except at the concatenation axis.
-                    Coordinate out_start_coord(out_shape.size(), 0);
-                    out_start_coord[concatenation_axis] = concatenation_pos;
-
-                    // The end coordinate for the copy is the same as the output shape except at the
-                    // concatenation axis.
-                    Coordinate out_end_coord = out_shape;
-                    out_end_coord[concatenation_axis] =
-                        concatenation_pos + in_shapes[i][concatenation_axis];
-
-                    CoordinateTransform input_transform(in_shapes[i]);
-                    CoordinateTransform output_chunk_transform(
-                        out_shape, out_start_coord, out_end_coord);
-
-                    CoordinateTransform::Iterator output_chunk_it = output_chunk_transform.begin();
-
-                    for (const Coordinate& input_coord : input_transform)
-                    {
-                        size_t input_index = input_transform.index(input_coord);
-                        size_t output_chunk_index = output_chunk_transform.index(*output_chunk_it);
-                        ++output_chunk_it;
-
-                        out[output_chunk_index] = args[i][input_index];
-                    }
+                    std::ptrdiff_t out_offset = concatenation_pos * out_strides[concatenation_axis];
+                    StridedWalk<2> walk(in_shapes[i],
+                                        {{out_strides, dense_strides(in_shapes[i])}},
+                                        {{out_offset, 0}});
+                    strided_copy(args[i], out, walk);
 
                     concatenation_pos += in_shapes[i][concatenation_axis];
                 }
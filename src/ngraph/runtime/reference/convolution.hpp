@@ -17,10 +17,12 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
+#include <vector>
 
-#include "ngraph/axis_vector.hpp"
-#include "ngraph/coordinate_transform.hpp"
-#include "ngraph/util.hpp"
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/reference/gemm.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -28,10 +30,64 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Lowers one input channel of one image to im2col rows. Row f (in row-major
+            ///        order of the filter's spatial coordinates) holds, for every output spatial
+            ///        position, the data element under filter tap f, or padding_value where the
+            ///        tap falls into padding or a data dilation gap.
+            ///
+            /// taps[i][f_i * out_spatial_shape[i] + o_i] is the element offset along spatial axis
+            /// i read by filter position f_i at output position o_i, or -1 for a gap.
             template <typename T>
-            void convolution(const T* arg0,
-                             const T* arg1,
-                             T* out,
+            void convolution_im2col(const T* image,
+                                    const Shape& filter_spatial_shape,
+                                    const Shape& out_spatial_shape,
+                                    const std::vector<std::vector<std::ptrdiff_t>>& taps,
+                                    T* col,
+                                    T padding_value = T(0))
+            {
+                size_t n_spatial_dimensions = out_spatial_shape.size();
+                if (n_spatial_dimensions == 0)
+                {
+                    col[0] = image[0];
+                    return;
+                }
+
+                size_t inner_axis = n_spatial_dimensions - 1;
+                size_t inner_size = out_spatial_shape[inner_axis];
+                Shape outer_shape(out_spatial_shape.begin(), out_spatial_shape.end() - 1);
+
+                for_each_coordinate(filter_spatial_shape, [&](const Coordinate& filter_coord) {
+                    const std::ptrdiff_t* inner_taps =
+                        taps[inner_axis].data() + filter_coord[inner_axis] * inner_size;
+
+                    for_each_coordinate(outer_shape, [&](const Coordinate& out_coord) {
+                        std::ptrdiff_t offset = 0;
+                        bool in_bounds = true;
+                        for (size_t i = 0; i < inner_axis; i++)
+                        {
+                            std::ptrdiff_t tap =
+                                taps[i][filter_coord[i] * out_spatial_shape[i] + out_coord[i]];
+                            in_bounds = in_bounds && tap >= 0;
+                            offset += tap;
+                        }
+
+                        for (size_t j = 0; j < inner_size; j++)
+                        {
+                            col[j] = in_bounds && inner_taps[j] >= 0 ? image[offset + inner_taps[j]]
+                                                                     : padding_value;
+                        }
+                        col += inner_size;
+                    });
+                });
+            }
+
+            /// \brief Batched convolution. The data and filters may be of narrower types than the
+            ///        output, as for 8-bit integer data with a 32-bit result, and padding reads
+            ///        padding_value, which is the zero point of quantized data.
+            template <typename TA, typename TB = TA, typename TC = TA>
+            void convolution(const TA* arg0,
+                             const TB* arg1,
+                             TC* out,
                              const Shape& arg0_shape,
                              const Shape& arg1_shape,
                              const Shape& out_shape,
@@ -46,7 +102,8 @@ namespace ngraph
                              size_t output_channel_axis_filters,
                              size_t batch_axis_result,
                              size_t output_channel_axis_result,
-                             bool rotate_filter)
+                             bool rotate_filter,
+                             TA padding_value = TA(0))
             {
                 // Comments throughout assume without loss of generality that:
                 //
@@ -55,150 +112,128 @@ namespace ngraph
                 // * output channel axes for filters is 0
                 // * output channel axis for output data is 1
                 // * rotate_filter is false
-
-                // At the outermost level we will walk over every output coordinate O.
-                CoordinateTransform output_transform(out_shape);
-
-                for (Coordinate out_coord : output_transform)
+                //
+                // The batch and channel axes are always the two leading axes, so the spatial axes
+                // of every tensor are dense. For each image N the output (chan_out,i_1,...,i_n)
+                // is then the product of the filters, viewed as a
+                //
+                //   chan_out x (chans_in_count * filter_dims_1 * ... * filter_dims_n)
+                //
+                // matrix, with the im2col lowering of image N, whose column (i_1,...,i_n) holds
+                // the padded and dilated input window that output position reads.
+
+                size_t n_spatial_dimensions = arg0_shape.size() - 2;
+                ElementStrides data_strides = dense_strides(arg0_shape);
+                ElementStrides filter_strides = dense_strides(arg1_shape);
+                ElementStrides out_strides = dense_strides(out_shape);
+
+                size_t batch_size = arg0_shape[batch_axis_data];
+                size_t n_input_channels = arg0_shape[input_channel_axis_data];
+                size_t n_output_channels = arg1_shape[output_channel_axis_filters];
+
+                Shape data_spatial_shape(arg0_shape.begin() + 2, arg0_shape.end());
+                Shape filter_spatial_shape(arg1_shape.begin() + 2, arg1_shape.end());
+                Shape out_spatial_shape(out_shape.begin() + 2, out_shape.end());
+                size_t filter_spatial_size = shape_size(filter_spatial_shape);
+                size_t out_spatial_size = shape_size(out_spatial_shape);
+                size_t patch_size = n_input_channels * filter_spatial_size;
+
+                // Gather the filters into a dense chan_out x patch_size matrix. Rotating every
+                // spatial axis of a dense block reverses its row-major order.
+                std::vector<TB> filter_matrix(n_output_channels * patch_size);
+                TB* filter_row = filter_matrix.data();
+                for (size_t output_channel = 0; output_channel < n_output_channels;
+                     output_channel++)
                 {
-                    // Our output coordinate O will have the form:
-                    //
-                    //   (N,chan_out,i_1,...,i_n)
-
-                    size_t batch_index = out_coord[batch_axis_result];
-                    size_t output_channel = out_coord[output_channel_axis_result];
-
-                    // For the input data we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (N,0,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (N+1,chans_in_count,s_1*i_1 + l_1*filter_dims_1,...,s_n*i_n + l_n*filter_dims_n)
-                    //
-                    // with strides:
-                    //
-                    //   (1,l_1,...,l_n).
-                    //
-                    // Note that we are iterating within the *padded* and *dilated* data batch, so further
-                    // down we must check the current coordinate is in the padding or dilation gap.
-
-                    size_t n_spatial_dimensions = arg0_shape.size() - 2;
-                    size_t n_input_channels = arg0_shape[input_channel_axis_data];
-
-                    Coordinate input_batch_transform_start(2 + n_spatial_dimensions);
-                    Coordinate input_batch_transform_end(2 + n_spatial_dimensions);
-                    Strides input_batch_transform_movement_strides(2 + n_spatial_dimensions, 1);
-                    CoordinateDiff input_batch_transform_padding_below(2 + n_spatial_dimensions, 0);
-                    CoordinateDiff input_batch_transform_padding_above(2 + n_spatial_dimensions, 0);
-                    Strides input_batch_transform_dilation_strides(2 + n_spatial_dimensions, 1);
-
-                    input_batch_transform_start[batch_axis_data] = batch_index;
-                    input_batch_transform_end[batch_axis_data] = batch_index + 1;
-                    input_batch_transform_start[input_channel_axis_data] = 0;
-                    input_batch_transform_end[input_channel_axis_data] = n_input_channels;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
+                    for (size_t input_channel = 0; input_channel < n_input_channels;
+                         input_channel++)
                     {
-                        size_t window_dilation_stride = window_dilation_strides[i - 2];
-                        size_t window_movement_stride = window_movement_strides[i - 2];
-                        std::ptrdiff_t below_pad = padding_below[i - 2];
-                        std::ptrdiff_t above_pad = padding_above[i - 2];
-                        size_t data_dilation_stride = data_dilation_strides[i - 2];
-
-                        input_batch_transform_start[i] = window_movement_stride * out_coord[i];
-                        input_batch_transform_end[i] =
-                            input_batch_transform_start[i] +
-                            (arg1_shape[i] - 1) * window_dilation_stride + 1;
-                        input_batch_transform_movement_strides[i] = window_dilation_stride;
-                        input_batch_transform_padding_below[i] = below_pad;
-                        input_batch_transform_padding_above[i] = above_pad;
-                        input_batch_transform_dilation_strides[i] = data_dilation_stride;
-                    }
-
-                    AxisVector input_batch_transform_axis_order(2 + n_spatial_dimensions);
-                    for (size_t i = 0; i < input_batch_transform_axis_order.size(); i++)
-                    {
-                        input_batch_transform_axis_order[i] = i;
-                    }
-
-                    CoordinateTransform input_batch_transform(
-                        arg0_shape,
-                        input_batch_transform_start,
-                        input_batch_transform_end,
-                        input_batch_transform_movement_strides,
-                        input_batch_transform_axis_order,
-                        input_batch_transform_padding_below,
-                        input_batch_transform_padding_above,
-                        input_batch_transform_dilation_strides);
-
-                    // Simultaneously with iterating I, for the filters we need to iterate the coordinate:
-                    //
-                    //   F
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (chan_out,0,0,...,0) -> (chan_out+1,chans_in_count,filter_dims_1,...,filter_dims_n)
-                    //
-                    // with unit stride.
-
-                    Shape filter_transform_start(2 + n_spatial_dimensions);
-                    Shape filter_transform_end(2 + n_spatial_dimensions);
-
-                    filter_transform_start[output_channel_axis_filters] = output_channel;
-                    filter_transform_end[output_channel_axis_filters] = output_channel + 1;
-                    filter_transform_start[input_channel_axis_filters] = 0;
-                    filter_transform_end[input_channel_axis_filters] = n_input_channels;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
-                    {
-                        filter_transform_start[i] = 0;
-                        filter_transform_end[i] = arg1_shape[i];
+                        const TB* filter =
+                            arg1 + output_channel * filter_strides[output_channel_axis_filters] +
+                            input_channel * filter_strides[input_channel_axis_filters];
+                        for (size_t f = 0; f < filter_spatial_size; f++)
+                        {
+                            filter_row[f] =
+                                filter[rotate_filter ? filter_spatial_size - 1 - f : f];
+                        }
+                        filter_row += filter_spatial_size;
                     }
+                }
 
-                    CoordinateTransform filter_transform(
-                        arg1_shape, filter_transform_start, filter_transform_end);
-
-                    // As we go, we sum up:
-                    //
-                    //   output[O] += arg0[I] * arg1[F].
-
-                    T result = 0;
-
-                    CoordinateTransform::Iterator input_it = input_batch_transform.begin();
-                    CoordinateTransform::Iterator filter_it = filter_transform.begin();
+                // A 1x1 filter with unit strides and no padding or dilation reads the data
+                // directly, so the image is already its own im2col lowering.
+                bool pointwise = true;
+                for (size_t i = 0; i < n_spatial_dimensions; i++)
+                {
+                    pointwise = pointwise && filter_spatial_shape[i] == 1 &&
+                                window_movement_strides[i] == 1 && padding_below[i] == 0 &&
+                                padding_above[i] == 0 && data_dilation_strides[i] == 1;
+                }
 
-                    while (input_it != input_batch_transform.end() &&
-                           filter_it != filter_transform.end())
+                std::vector<std::vector<std::ptrdiff_t>> taps(n_spatial_dimensions);
+                std::vector<TA> col;
+                size_t channel_col_size = filter_spatial_size * out_spatial_size;
+                if (!pointwise)
+                {
+                    // Along each spatial axis, output position o and filter position f read
+                    // position p = o * s + f * l - pad_below of the padded, dilated data, which
+                    // is data element p / data_dilation if that divides evenly and is in range.
+                    for (size_t i = 0; i < n_spatial_dimensions; i++)
                     {
-                        const Coordinate& input_batch_coord = *input_it;
-                        Coordinate filter_coord = *filter_it;
-
-                        if (rotate_filter)
+                        std::ptrdiff_t data_size = data_spatial_shape[i];
+                        std::ptrdiff_t dilation = data_dilation_strides[i];
+                        taps[i].resize(filter_spatial_shape[i] * out_spatial_shape[i]);
+                        for (size_t f = 0; f < filter_spatial_shape[i]; f++)
                         {
-                            Shape target_shape = filter_transform.get_target_shape();
-
-                            // Note that we only reverse the spatial dimensions here (loop
-                            // starts at 2)
-                            for (size_t i = 2; i < filter_coord.size(); i++)
+                            for (size_t o = 0; o < out_spatial_shape[i]; o++)
                             {
-                                filter_coord[i] = target_shape[i] - filter_coord[i] - 1;
+                                std::ptrdiff_t p =
+                                    static_cast<std::ptrdiff_t>(o * window_movement_strides[i] +
+                                                                f * window_dilation_strides[i]) -
+                                    padding_below[i];
+                                std::ptrdiff_t tap = -1;
+                                if (p >= 0 && p % dilation == 0 && p / dilation < data_size)
+                                {
+                                    tap = p / dilation * data_strides[2 + i];
+                                }
+                                taps[i][f * out_spatial_shape[i] + o] = tap;
                             }
                         }
+                    }
+                    col.resize(n_input_channels * channel_col_size);
+                }
 
-                        T v = input_batch_transform.has_source_coordinate(input_batch_coord)
-                                  ? arg0[input_batch_transform.index(input_batch_coord)]
-                                  : 0;
-
-                        result += v * arg1[filter_transform.index(filter_coord)];
-
-                        ++input_it;
-                        ++filter_it;
+                for (size_t batch_index = 0; batch_index < batch_size; batch_index++)
+                {
+                    const TA* batch = arg0 + batch_index * data_strides[batch_axis_data];
+                    const TA* lowered = batch;
+                    size_t lowered_row_stride = data_strides[input_channel_axis_data];
+                    if (!pointwise)
+                    {
+                        for (size_t input_channel = 0; input_channel < n_input_channels;
+                             input_channel++)
+                        {
+                            convolution_im2col(
+                                batch + input_channel * data_strides[input_channel_axis_data],
+                                filter_spatial_shape,
+                                out_spatial_shape,
+                                taps,
+                                col.data() + input_channel * channel_col_size,
+                                padding_value);
+                        }
+                        lowered = col.data();
+                        lowered_row_stride = out_spatial_size;
                     }
 
-                    out[output_transform.index(out_coord)] = result;
+                    gemm(filter_matrix.data(),
+                         patch_size,
+                         lowered,
+                         lowered_row_stride,
+                         out + batch_index * out_strides[batch_axis_result],
+                         out_strides[output_channel_axis_result],
+                         n_output_channels,
+                         out_spatial_size,
+                         patch_size);
                 }
             }
         }
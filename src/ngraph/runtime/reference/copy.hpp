@@ -17,6 +17,9 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
+
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -32,6 +35,30 @@ namespace ngraph
                     out[i] = arg[i];
                 }
             }
+
+            /// \brief Copies along a walk whose operand 0 addresses out and operand 1 addresses
+            ///        arg. Runs that are contiguous on both sides are copied with memcpy.
+            template <typename T>
+            void strided_copy(const T* arg, T* out, StridedWalk<2>& walk)
+            {
+                walk.for_each_run([arg, out](const StridedWalk<2>::Offsets& offsets,
+                                             size_t count,
+                                             const StridedWalk<2>::Offsets& strides) {
+                    T* dst = out + offsets[0];
+                    const T* src = arg + offsets[1];
+                    if (strides[0] == 1 && strides[1] == 1)
+                    {
+                        std::memcpy(dst, src, count * sizeof(T));
+                    }
+                    else
+                    {
+                        for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(count); i++)
+                        {
+                            dst[i * strides[0]] = src[i * strides[1]];
+                        }
+                    }
+                });
+            }
         }
     }
 }
@@ -0,0 +1,268 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ngraph/runtime/reference/parallel_for.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            // Register tile computed by the micro-kernel; NR elements of a float row fill one
+            // 256-bit vector, so the accumulator loops below vectorize without intrinsics.
+            constexpr size_t gemm_mr = 4;
+            constexpr size_t gemm_nr = 8;
+
+            // Cache blocks: a packed kc x nc panel of B is reused by every mc x kc block of A.
+            constexpr size_t gemm_mc = 128;
+            constexpr size_t gemm_kc = 256;
+            constexpr size_t gemm_nc = 512;
+
+            // Below this many multiply-adds per thread, splitting the product does not pay off.
+            constexpr size_t gemm_min_work_per_thread = size_t(1) << 18;
+
+            /// \brief Element type that the operands of a gemm with inputs TA and TB and result
+            ///        TC are packed to. 8-bit integer operands are widened to 16 bits only, which
+            ///        keeps the packed panels small; their products are summed in TC.
+            template <typename TA, typename TB, typename TC>
+            struct gemm_packed_type
+            {
+                using type = typename std::conditional<std::is_integral<TA>::value &&
+                                                           std::is_integral<TB>::value &&
+                                                           sizeof(TA) == 1 && sizeof(TB) == 1,
+                                                       int16_t,
+                                                       TC>::type;
+            };
+
+            /// \brief Packs rows [0, mc) and columns [0, kc) of A into strips of gemm_mr rows,
+            ///        each stored column by column. The last strip is zero-padded.
+            template <typename T, typename P>
+            void gemm_pack_a(const T* a, size_t lda, size_t mc, size_t kc, P* packed)
+            {
+                for (size_t i = 0; i < mc; i += gemm_mr)
+                {
+                    size_t rows = std::min(gemm_mr, mc - i);
+                    for (size_t p = 0; p < kc; p++)
+                    {
+                        for (size_t ii = 0; ii < gemm_mr; ii++)
+                        {
+                            *packed++ = ii < rows ? static_cast<P>(a[(i + ii) * lda + p]) : P(0);
+                        }
+                    }
+                }
+            }
+
+            /// \brief Packs rows [0, kc) and columns [0, nc) of B into strips of gemm_nr
+            ///        columns, each stored row by row. The last strip is zero-padded.
+            template <typename T, typename P>
+            void gemm_pack_b(const T* b, size_t ldb, size_t kc, size_t nc, P* packed)
+            {
+                for (size_t j = 0; j < nc; j += gemm_nr)
+                {
+                    size_t cols = std::min(gemm_nr, nc - j);
+                    for (size_t p = 0; p < kc; p++)
+                    {
+                        const T* b_row = b + p * ldb + j;
+                        for (size_t jj = 0; jj < gemm_nr; jj++)
+                        {
+                            *packed++ = jj < cols ? static_cast<P>(b_row[jj]) : P(0);
+                        }
+                    }
+                }
+            }
+
+            /// \brief Multiplies a packed A strip by a packed B strip and stores (accumulate ==
+            ///        false) or adds the rows x cols corner of the result to C.
+            template <typename P, typename TC>
+            void gemm_micro_kernel(const P* packed_a,
+                                   const P* packed_b,
+                                   size_t kc,
+                                   TC* c,
+                                   size_t ldc,
+                                   size_t rows,
+                                   size_t cols,
+                                   bool accumulate)
+            {
+                TC acc[gemm_mr][gemm_nr] = {};
+                for (size_t p = 0; p < kc; p++)
+                {
+                    for (size_t ii = 0; ii < gemm_mr; ii++)
+                    {
+                        TC a = packed_a[ii];
+                        for (size_t jj = 0; jj < gemm_nr; jj++)
+                        {
+                            acc[ii][jj] += a * static_cast<TC>(packed_b[jj]);
+                        }
+                    }
+                    packed_a += gemm_mr;
+                    packed_b += gemm_nr;
+                }
+
+                for (size_t ii = 0; ii < rows; ii++)
+                {
+                    TC* c_row = c + ii * ldc;
+                    for (size_t jj = 0; jj < cols; jj++)
+                    {
+                        c_row[jj] = accumulate ? c_row[jj] + acc[ii][jj] : acc[ii][jj];
+                    }
+                }
+            }
+
+            /// \brief Single-threaded blocked C = A * B over an m x n tile of C, where A is
+            ///        m x k with row stride lda, B is k x n with row stride ldb and C has row
+            ///        stride ldc.
+            template <typename TA, typename TB, typename TC>
+            void gemm_tile(const TA* a,
+                           size_t lda,
+                           const TB* b,
+                           size_t ldb,
+                           TC* c,
+                           size_t ldc,
+                           size_t m,
+                           size_t n,
+                           size_t k)
+            {
+                using P = typename gemm_packed_type<TA, TB, TC>::type;
+                auto round_up = [](size_t x, size_t to) { return (x + to - 1) / to * to; };
+                std::vector<P> packed_a(round_up(std::min(gemm_mc, m), gemm_mr) *
+                                        std::min(gemm_kc, k));
+                std::vector<P> packed_b(round_up(std::min(gemm_nc, n), gemm_nr) *
+                                        std::min(gemm_kc, k));
+
+                for (size_t jc = 0; jc < n; jc += gemm_nc)
+                {
+                    size_t nc = std::min(gemm_nc, n - jc);
+                    for (size_t pc = 0; pc < k; pc += gemm_kc)
+                    {
+                        size_t kc = std::min(gemm_kc, k - pc);
+                        gemm_pack_b(b + pc * ldb + jc, ldb, kc, nc, packed_b.data());
+
+                        for (size_t ic = 0; ic < m; ic += gemm_mc)
+                        {
+                            size_t mc = std::min(gemm_mc, m - ic);
+                            gemm_pack_a(a + ic * lda + pc, lda, mc, kc, packed_a.data());
+
+                            for (size_t jr = 0; jr < nc; jr += gemm_nr)
+                            {
+                                for (size_t ir = 0; ir < mc; ir += gemm_mr)
+                                {
+                                    gemm_micro_kernel(packed_a.data() + ir * kc,
+                                                      packed_b.data() + jr * kc,
+                                                      kc,
+                                                      c + (ic + ir) * ldc + jc + jr,
+                                                      ldc,
+                                                      std::min(gemm_mr, mc - ir),
+                                                      std::min(gemm_nr, nc - jr),
+                                                      pc != 0);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// \brief Row-major C = A * B for an m x k matrix A and a k x n matrix B, with rows
+            ///        lda, ldb and ldc elements apart.
+            ///
+            /// C is split into a grid of rectangular tiles, one per parallel_for thread, which are
+            /// computed independently with cache-blocked packing and a register-blocked
+            /// micro-kernel. Within a cache block the products are summed in order of k. The
+            /// operands may be of narrower types than C, as for 8-bit integer matrices with a
+            /// 32-bit result.
+            template <typename TA, typename TB, typename TC>
+            void gemm(const TA* a,
+                      size_t lda,
+                      const TB* b,
+                      size_t ldb,
+                      TC* c,
+                      size_t ldc,
+                      size_t m,
+                      size_t n,
+                      size_t k)
+            {
+                if (m == 0 || n == 0)
+                {
+                    return;
+                }
+                if (k == 0)
+                {
+                    for (size_t i = 0; i < m; i++)
+                    {
+                        std::fill(c + i * ldc, c + i * ldc + n, TC(0));
+                    }
+                    return;
+                }
+
+                size_t thread_count = std::max(1u, std::thread::hardware_concurrency());
+                size_t work_threads = std::max<size_t>(1, m * n * k / gemm_min_work_per_thread);
+                thread_count = std::min(thread_count, work_threads);
+
+                // Prefer splitting rows, which keeps every thread's B panel whole; fall back to
+                // columns when there are not enough row strips to go around.
+                size_t row_tiles = std::min(thread_count, (m + gemm_mr - 1) / gemm_mr);
+                size_t col_tiles =
+                    std::min(thread_count / row_tiles, (n + gemm_nr - 1) / gemm_nr);
+                if (row_tiles * col_tiles <= 1)
+                {
+                    gemm_tile(a, lda, b, ldb, c, ldc, m, n, k);
+                    return;
+                }
+
+                auto tile_bounds = [](size_t extent, size_t tiles, size_t tile, size_t align) {
+                    size_t blocks = (extent + align - 1) / align;
+                    size_t begin = std::min(extent, blocks * tile / tiles * align);
+                    size_t end = std::min(extent, blocks * (tile + 1) / tiles * align);
+                    return std::make_pair(begin, end);
+                };
+
+                parallel_for(row_tiles * col_tiles, 1, [&](size_t begin, size_t end) {
+                    for (size_t t = begin; t < end; t++)
+                    {
+                        auto rows = tile_bounds(m, row_tiles, t / col_tiles, gemm_mr);
+                        auto cols = tile_bounds(n, col_tiles, t % col_tiles, gemm_nr);
+                        gemm_tile(a + rows.first * lda,
+                                  lda,
+                                  b + cols.first,
+                                  ldb,
+                                  c + rows.first * ldc + cols.first,
+                                  ldc,
+                                  rows.second - rows.first,
+                                  cols.second - cols.first,
+                                  k);
+                    }
+                });
+            }
+
+            /// \brief Row-major C = A * B for dense m x k, k x n and m x n matrices.
+            template <typename TA, typename TB, typename TC>
+            void gemm(const TA* a, const TB* b, TC* c, size_t m, size_t n, size_t k)
+            {
+                gemm(a, k, b, n, c, n, m, n, k);
+            }
+        }
+    }
+}
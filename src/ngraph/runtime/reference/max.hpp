@@ -16,10 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -38,26 +39,15 @@ namespace ngraph
                                ? -std::numeric_limits<T>::infinity()
                                : std::numeric_limits<T>::min();
 
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), minval);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = project(input_coord, reduction_axes);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T max = out[output_transform.index(output_coord)];
-                    if (x > max)
+                for_each_reduction(in_shape, reduction_axes, [&](size_t out_i, size_t in_i) {
+                    T x = arg[in_i];
+                    if (x > out[out_i])
                     {
-                        out[output_transform.index(output_coord)] = x;
+                        out[out_i] = x;
                     }
-                }
+                });
             }
         }
     }
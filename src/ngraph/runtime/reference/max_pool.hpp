@@ -16,10 +16,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
-#include <numeric>
+#include <limits>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -38,86 +40,46 @@ namespace ngraph
                                    const Shape& padding_below,
                                    const Shape& padding_above)
             {
-                CoordinateTransform out_transform(out_shape);
-
-                for (const Coordinate& out_coord : out_transform)
-                {
-                    out[out_transform.index(out_coord)] = 0;
-                }
-
-                CoordinateTransform delta_transform(delta_shape);
-
-                for (const Coordinate& delta_coord : delta_transform)
+                std::fill(out, out + shape_size(out_shape), T(0));
+
+                // Every (batch, channel) pair is an independent image. Each delta element is
+                // routed to the first position of the maximum within its clipped window.
+                Shape delta_image_shape(delta_shape.begin() + 2, delta_shape.end());
+                Shape out_image_shape(out_shape.begin() + 2, out_shape.end());
+                size_t n_images = delta_shape[0] * delta_shape[1];
+                size_t delta_image_size = shape_size(delta_image_shape);
+                size_t out_image_size = shape_size(out_image_shape);
+
+                WindowWalk window(
+                    out_image_shape, window_shape, window_movement_strides, padding_below);
+                for (size_t image = 0; image < n_images; image++)
                 {
-                    size_t img_index = delta_coord[0];
-                    size_t channel = delta_coord[1];
-
-                    size_t n_image_dimensions = out_shape.size() - 2;
-                    Coordinate source_window_transform_start(2 + n_image_dimensions);
-                    Coordinate source_window_transform_end(2 + n_image_dimensions);
-                    Strides source_window_transform_source_strides(2 + n_image_dimensions, 1);
-                    AxisVector source_window_transform_source_axis_order(2 + n_image_dimensions);
-                    CoordinateDiff source_window_transform_padding_below(2 + n_image_dimensions);
-                    CoordinateDiff source_window_transform_padding_above(2 + n_image_dimensions);
-
-                    source_window_transform_start[0] = img_index;
-                    source_window_transform_end[0] = img_index + 1;
-                    source_window_transform_start[1] = channel;
-                    source_window_transform_end[1] = channel + 1;
-                    source_window_transform_padding_below[0] = 0;
-                    source_window_transform_padding_below[1] = 0;
-                    source_window_transform_padding_above[0] = 0;
-                    source_window_transform_padding_above[1] = 0;
-
-                    for (size_t i = 2; i < n_image_dimensions + 2; i++)
-                    {
-                        size_t window_shape_this_dim = window_shape[i - 2];
-                        size_t movement_stride = window_movement_strides[i - 2];
-
-                        source_window_transform_start[i] = movement_stride * delta_coord[i];
-                        source_window_transform_end[i] =
-                            source_window_transform_start[i] + window_shape_this_dim;
-                        source_window_transform_padding_below[i] = padding_below[i - 2];
-                        source_window_transform_padding_above[i] = padding_above[i - 2];
-                    }
-                    std::iota(begin(source_window_transform_source_axis_order),
-                              end(source_window_transform_source_axis_order),
-                              0);
-
-                    CoordinateTransform source_window_transform(
-                        out_shape,
-                        source_window_transform_start,
-                        source_window_transform_end,
-                        source_window_transform_source_strides,
-                        source_window_transform_source_axis_order,
-                        source_window_transform_padding_below,
-                        source_window_transform_padding_above);
-
-                    Coordinate argmax_coord;
-                    bool argmax_coord_valid = false;
-                    T max_val = 0; // just initializing to keep compiler happy, this 0 is ignored
-
-                    for (const Coordinate& source_window_coord : source_window_transform)
-                    {
-                        if (source_window_transform.has_source_coordinate(source_window_coord))
-                        {
-                            T candidate =
-                                arg_forward[source_window_transform.index(source_window_coord)];
-
-                            if (!argmax_coord_valid || candidate > max_val)
+                    const T* arg_forward_image = arg_forward + image * out_image_size;
+                    const T* delta_image = delta + image * delta_image_size;
+                    T* out_image = out + image * out_image_size;
+                    size_t delta_index = 0;
+                    for_each_coordinate(delta_image_shape, [&](const Coordinate& delta_coord) {
+                        std::ptrdiff_t argmax_index = 0;
+                        bool argmax_valid = false;
+                        T max_val = 0; // initialized to keep the compiler happy, ignored
+
+                        window.move_to(delta_coord);
+                        window.for_each([&](std::ptrdiff_t index) {
+                            T candidate = arg_forward_image[index];
+                            if (!argmax_valid || candidate > max_val)
                             {
                                 max_val = candidate;
-                                argmax_coord = source_window_coord;
-                                argmax_coord_valid = true;
+                                argmax_index = index;
+                                argmax_valid = true;
                             }
-                        }
-                    }
+                        });
 
-                    if (argmax_coord_valid)
-                    {
-                        out[source_window_transform.index(argmax_coord)] +=
-                            delta[delta_transform.index(delta_coord)];
-                    }
+                        if (argmax_valid)
+                        {
+                            out_image[argmax_index] += delta_image[delta_index];
+                        }
+                        delta_index++;
+                    });
                 }
             }
 
@@ -131,92 +93,36 @@ namespace ngraph
                           const Shape& padding_below,
                           const Shape& padding_above)
             {
-                // At the outermost level we will walk over every output coordinate O.
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& out_coord : output_transform)
+                // Every (batch, channel) pair is an independent image. For each output
+                // coordinate (i_1,...,i_n) of an image we walk the input window
+                //
+                //   (s_1*i_1,...,s_n*i_n) ->
+                //
+                //     (s_1*i_1 + window_shape_1,...,s_n*i_n + window_shape_n)
+                //
+                // of the *padded* image, clipped to the image itself, so padding never wins.
+                Shape arg_image_shape(arg_shape.begin() + 2, arg_shape.end());
+                Shape out_image_shape(out_shape.begin() + 2, out_shape.end());
+                size_t n_images = out_shape[0] * out_shape[1];
+                size_t arg_image_size = shape_size(arg_image_shape);
+
+                WindowWalk window(
+                    arg_image_shape, window_shape, window_movement_strides, padding_below);
+                size_t out_index = 0;
+                for (size_t image = 0; image < n_images; image++)
                 {
-                    // Our output coordinate O will have the form:
-                    //
-                    //   (N,chan,i_1,...,i_n)
-
-                    size_t batch_index = out_coord[0];
-                    size_t channel = out_coord[1];
-
-                    // For the input data we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (N,chan,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (N+1,chan+1,s_1*i_1 + window_shape_1,...,s_n*i_n + window_shape_n)
-                    //
-                    // with unit stride.
-                    //
-                    // We iterate this over the *padded* data, so below we will need to check for coordinates that fall in the padding area.
-
-                    size_t n_spatial_dimensions = arg_shape.size() - 2;
-
-                    Coordinate input_batch_transform_start(2 + n_spatial_dimensions);
-                    Coordinate input_batch_transform_end(2 + n_spatial_dimensions);
-                    Strides input_batch_transform_source_strides(2 + n_spatial_dimensions, 1);
-                    AxisVector input_batch_transform_source_axis_order(2 + n_spatial_dimensions);
-                    CoordinateDiff input_batch_transform_padding_below(2 + n_spatial_dimensions);
-                    CoordinateDiff input_batch_transform_padding_above(2 + n_spatial_dimensions);
-
-                    input_batch_transform_start[0] = batch_index;
-                    input_batch_transform_end[0] = batch_index + 1;
-                    input_batch_transform_start[1] = channel;
-                    input_batch_transform_end[1] = channel + 1;
-                    input_batch_transform_padding_below[0] = 0;
-                    input_batch_transform_padding_below[1] = 0;
-                    input_batch_transform_padding_above[0] = 0;
-                    input_batch_transform_padding_above[1] = 0;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
-                    {
-                        size_t window_shape_this_dim = window_shape[i - 2];
-                        size_t movement_stride = window_movement_strides[i - 2];
+                    const T* arg_image = arg + image * arg_image_size;
+                    for_each_coordinate(out_image_shape, [&](const Coordinate& out_coord) {
+                        T result = std::numeric_limits<T>::lowest();
 
-                        input_batch_transform_start[i] = movement_stride * out_coord[i];
-                        input_batch_transform_end[i] =
-                            input_batch_transform_start[i] + window_shape_this_dim;
-                        input_batch_transform_padding_below[i] = padding_below[i - 2];
-                        input_batch_transform_padding_above[i] = padding_above[i - 2];
-                    }
-
-                    for (size_t i = 0; i < arg_shape.size(); i++)
-                    {
-                        input_batch_transform_source_axis_order[i] = i;
-                    }
-
-                    CoordinateTransform input_batch_transform(
-                        arg_shape,
-                        input_batch_transform_start,
-                        input_batch_transform_end,
-                        input_batch_transform_source_strides,
-                        input_batch_transform_source_axis_order,
-                        input_batch_transform_padding_below,
-                        input_batch_transform_padding_above);
-
-                    // As we go, we compute the maximum value:
-                    //
-                    //   output[O] = max(output[O],arg[I])
-
-                    T result = std::numeric_limits<T>::lowest();
-
-                    for (const Coordinate& input_batch_coord : input_batch_transform)
-                    {
-                        if (input_batch_transform.has_source_coordinate(input_batch_coord))
-                        {
-                            T x = arg[input_batch_transform.index(input_batch_coord)];
+                        window.move_to(out_coord);
+                        window.for_each([&](std::ptrdiff_t arg_index) {
+                            T x = arg_image[arg_index];
                             result = x > result ? x : result;
-                        }
-                    }
+                        });
 
-                    out[output_transform.index(out_coord)] = result;
+                        out[out_index++] = result;
+                    });
                 }
             }
         }
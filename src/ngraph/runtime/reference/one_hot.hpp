@@ -16,9 +16,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -36,20 +37,18 @@ namespace ngraph
                          size_t one_hot_axis)
             {
                 // Step 1: Zero out the output.
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), T(0));
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                }
+                // Step 2: Write ones at needed positions, throwing exceptions when invalid
+                // conditions are encountered. The input is walked over the output axes other than
+                // the one-hot axis, and the one-hot position is added to the output offset.
+                ElementStrides out_strides = dense_strides(out_shape);
+                std::ptrdiff_t one_hot_stride = out_strides[one_hot_axis];
+                out_strides.erase(out_strides.begin() + one_hot_axis);
 
-                // Step 2: Write ones at needed positions, throwing exceptions when invalid conditions
-                // are encountered.
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    T val = arg[input_transform.index(input_coord)];
+                StridedWalk<2> walk(in_shape, {{out_strides, dense_strides(in_shape)}});
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    T val = arg[offsets[1]];
 
                     if (std::floor(val) < val || std::floor(val) > val)
                     {
@@ -63,10 +62,8 @@ namespace ngraph
                         throw(std::range_error("One-hot: value is out of category range"));
                     }
 
-                    Coordinate one_hot_coord = inject(input_coord, one_hot_axis, one_hot_pos);
-
-                    out[output_transform.index(one_hot_coord)] = 1;
-                }
+                    out[offsets[0] + one_hot_pos * one_hot_stride] = 1;
+                });
             }
         }
     }
@@ -16,10 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
-#include "ngraph/axis_vector.hpp"
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/copy.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -37,58 +38,21 @@ namespace ngraph
                      const Shape& padding_above,
                      const Shape& padding_interior)
             {
-                Coordinate input_start(arg0_shape.size(), 0); // start at (0,0,...,0)
-                Coordinate input_end =
-                    out_shape; // end at (d'0,d'1,...,d'n), the outer corner of the post-padding shape
+                // Fill the output with the padding value, then scatter the input into it. Input
+                // element i along an axis lands at padding_below + i * (padding_interior + 1).
+                std::fill(out, out + shape_size(out_shape), *arg1);
 
-                Strides input_strides(arg0_shape.size(), 1);
-
-                AxisVector input_axis_order(arg0_shape.size());
-                for (size_t i = 0; i < arg0_shape.size(); i++)
-                {
-                    input_axis_order[i] = i;
-                }
-
-                Strides input_dilation(arg0_shape.size());
+                ElementStrides out_strides = dense_strides(out_shape);
+                std::ptrdiff_t out_offset = 0;
                 for (size_t i = 0; i < arg0_shape.size(); i++)
                 {
-                    input_dilation[i] = padding_interior[i] + 1;
-                }
-
-                // Need to cast these to CoordinateDiff in order to make CoordinateTransform happy.
-                CoordinateDiff padding_below_signed;
-                CoordinateDiff padding_above_signed;
-
-                for (size_t i = 0; i < padding_below.size(); i++)
-                {
-                    padding_below_signed.push_back(padding_below[i]);
-                    padding_above_signed.push_back(padding_above[i]);
+                    out_offset += padding_below[i] * out_strides[i];
+                    out_strides[i] *= padding_interior[i] + 1;
                 }
 
-                CoordinateTransform input_transform(arg0_shape,
-                                                    input_start,
-                                                    input_end,
-                                                    input_strides,
-                                                    input_axis_order,
-                                                    padding_below_signed,
-                                                    padding_above_signed,
-                                                    input_dilation);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& in_coord : input_transform)
-                {
-                    const Coordinate& out_coord = *output_it;
-
-                    T v = input_transform.has_source_coordinate(in_coord)
-                              ? arg0[input_transform.index(in_coord)]
-                              : *arg1;
-
-                    out[output_transform.index(out_coord)] = v;
-
-                    ++output_it;
-                }
+                StridedWalk<2> walk(
+                    arg0_shape, {{out_strides, dense_strides(arg0_shape)}}, {{out_offset, 0}});
+                strided_copy(arg0, out, walk);
             }
         }
     }
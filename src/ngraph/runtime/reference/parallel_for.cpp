@@ -0,0 +1,119 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "ngraph/runtime/call_queue.hpp"
+#include "ngraph/runtime/reference/parallel_for.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static size_t get_thread_count()
+{
+    return max(1u, thread::hardware_concurrency());
+}
+
+// Workers shared by every parallel_for; the calling thread is the remaining one
+static runtime::CallQueue& get_workers()
+{
+    static runtime::CallQueue workers(get_thread_count() - 1);
+    return workers;
+}
+
+namespace
+{
+    // Chunks of one parallel_for. Workers may dequeue it after the call has returned, so it is
+    // shared with them and they only touch f while a chunk is left.
+    struct ParallelForJob
+    {
+        ParallelForJob(size_t chunk_count)
+            : next_chunk(0)
+            , pending_chunks(chunk_count)
+        {
+        }
+
+        atomic<size_t> next_chunk;
+        size_t pending_chunks;
+        exception_ptr error;
+        mutex job_mutex;
+        condition_variable done;
+    };
+}
+
+void runtime::reference::parallel_for(size_t count,
+                                      size_t min_chunk,
+                                      const function<void(size_t, size_t)>& f)
+{
+    size_t chunk_count = min(get_thread_count(), count / max<size_t>(1, min_chunk));
+    if (chunk_count <= 1)
+    {
+        f(size_t(0), count);
+        return;
+    }
+
+    auto job = make_shared<ParallelForJob>(chunk_count);
+    auto run_chunks = [job, chunk_count, count, &f]() {
+        size_t chunk;
+        while ((chunk = job->next_chunk++) < chunk_count)
+        {
+            exception_ptr error;
+            try
+            {
+                f(count * chunk / chunk_count, count * (chunk + 1) / chunk_count);
+            }
+            catch (...)
+            {
+                error = current_exception();
+            }
+            lock_guard<mutex> lock(job->job_mutex);
+            if (error && !job->error)
+            {
+                job->error = error;
+            }
+            if (--job->pending_chunks == 0)
+            {
+                job->done.notify_all();
+            }
+        }
+    };
+
+    try
+    {
+        for (size_t i = 0; i + 1 < chunk_count; i++)
+        {
+            get_workers().enqueue(run_chunks);
+        }
+    }
+    catch (...)
+    {
+        // Chunks that could not be handed to a worker are run below
+    }
+    run_chunks();
+
+    unique_lock<mutex> lock(job->job_mutex);
+    job->done.wait(lock, [&job]() { return job->pending_chunks == 0; });
+    if (job->error)
+    {
+        rethrow_exception(job->error);
+    }
+}
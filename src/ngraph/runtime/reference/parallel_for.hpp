@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Calls f(begin, end) on contiguous chunks of [0, count), one chunk per
+            ///        thread. Each thread gets at least min_chunk items, so small loops run inline
+            ///        on the calling thread. The chunks run on a pool of worker threads shared by
+            ///        all calls and on the calling thread, which also picks up chunks no worker
+            ///        has started, so nested calls cannot deadlock. The first exception thrown by
+            ///        f is rethrown once every chunk has finished.
+            void parallel_for(size_t count,
+                              size_t min_chunk,
+                              const std::function<void(size_t, size_t)>& f);
+        }
+    }
+}
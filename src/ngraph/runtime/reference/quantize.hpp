@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Quantizes a real value: x / scale is rounded to the nearest integer, ties
+            ///        to even, offset by the zero point and saturated to the range of TO. NaN
+            ///        has no integer value and maps to the zero point, like a real 0.
+            template <typename TO>
+            TO quantize_value(double x, double scale, int64_t zero_point)
+            {
+                double q = std::nearbyint(x / scale);
+                if (std::isnan(q))
+                {
+                    q = 0;
+                }
+                q += static_cast<double>(zero_point);
+                q = std::max(q, static_cast<double>(std::numeric_limits<TO>::lowest()));
+                q = std::min(q, static_cast<double>(std::numeric_limits<TO>::max()));
+                return static_cast<TO>(q);
+            }
+
+            template <typename TI, typename TO>
+            void quantize(const TI* arg, TO* out, size_t count, double scale, int64_t zero_point)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    out[i] = quantize_value<TO>(static_cast<double>(arg[i]), scale, zero_point);
+                }
+            }
+
+            /// \brief Stores the real values acc[i] * acc_scale of 32-bit accumulators. An
+            ///        integer TO gets them quantized with out_scale and out_zero_point, so a
+            ///        quantized op can produce its requantized output directly.
+            template <typename TO>
+            void requantize(const int32_t* acc,
+                            TO* out,
+                            size_t count,
+                            double acc_scale,
+                            double out_scale,
+                            int64_t out_zero_point)
+            {
+                if (std::is_floating_point<TO>::value)
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = static_cast<TO>(acc[i] * acc_scale);
+                    }
+                }
+                else
+                {
+                    // acc * acc_scale / out_scale, with the two scales folded into one
+                    double scale = out_scale / acc_scale;
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] =
+                            quantize_value<TO>(static_cast<double>(acc[i]), scale, out_zero_point);
+                    }
+                }
+            }
+        }
+    }
+}
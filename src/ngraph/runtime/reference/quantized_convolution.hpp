@@ -0,0 +1,117 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Forward convolution of 8-bit quantized data and filters, accumulated in 32
+            ///        bits. The real data is data_scale * (arg0 - data_zero_point) and the real
+            ///        filters are filter_scale * arg1, so filters must be quantized symmetrically.
+            ///        A real TO receives the real result, an integer TO the result quantized with
+            ///        out_scale and out_zero_point.
+            template <typename TA, typename TB, typename TO>
+            void quantized_convolution(const TA* arg0,
+                                       const TB* arg1,
+                                       TO* out,
+                                       const Shape& arg0_shape,
+                                       const Shape& arg1_shape,
+                                       const Shape& out_shape,
+                                       const Strides& window_movement_strides,
+                                       const Strides& window_dilation_strides,
+                                       const CoordinateDiff& padding_below,
+                                       const CoordinateDiff& padding_above,
+                                       const Strides& data_dilation_strides,
+                                       double data_scale,
+                                       int64_t data_zero_point,
+                                       double filter_scale,
+                                       double out_scale,
+                                       int64_t out_zero_point)
+            {
+                // Padding and dilation gaps read the zero point, i.e. real zero
+                std::vector<int32_t> acc(shape_size(out_shape));
+                convolution<TA, TB, int32_t>(arg0,
+                                             arg1,
+                                             acc.data(),
+                                             arg0_shape,
+                                             arg1_shape,
+                                             out_shape,
+                                             window_movement_strides,
+                                             window_dilation_strides,
+                                             padding_below,
+                                             padding_above,
+                                             data_dilation_strides,
+                                             0,
+                                             1,
+                                             1,
+                                             0,
+                                             0,
+                                             1,
+                                             false,
+                                             static_cast<TA>(data_zero_point));
+
+                // sum((a - za) * w) = sum(a * w) - za * sum(w) for every output channel
+                if (data_zero_point != 0)
+                {
+                    size_t batch_size = out_shape[0];
+                    size_t n_output_channels = out_shape[1];
+                    size_t out_spatial_size =
+                        shape_size(Shape(out_shape.begin() + 2, out_shape.end()));
+                    size_t patch_size = shape_size(arg1_shape) / n_output_channels;
+                    for (size_t output_channel = 0; output_channel < n_output_channels;
+                         output_channel++)
+                    {
+                        int32_t filter_sum = 0;
+                        for (size_t i = 0; i < patch_size; i++)
+                        {
+                            filter_sum += arg1[output_channel * patch_size + i];
+                        }
+                        int32_t correction = static_cast<int32_t>(data_zero_point) * filter_sum;
+                        for (size_t batch_index = 0; batch_index < batch_size; batch_index++)
+                        {
+                            int32_t* channel =
+                                acc.data() +
+                                (batch_index * n_output_channels + output_channel) *
+                                    out_spatial_size;
+                            for (size_t i = 0; i < out_spatial_size; i++)
+                            {
+                                channel[i] -= correction;
+                            }
+                        }
+                    }
+                }
+
+                requantize(acc.data(),
+                           out,
+                           acc.size(),
+                           data_scale * filter_scale,
+                           out_scale,
+                           out_zero_point);
+            }
+        }
+    }
+}
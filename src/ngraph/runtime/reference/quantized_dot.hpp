@@ -0,0 +1,100 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ngraph/runtime/reference/gemm.hpp"
+#include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Dot of 8-bit quantized arguments, accumulated in 32 bits. The real
+            ///        arguments are arg0_scale * (arg0 - arg0_zero_point) and arg1_scale *
+            ///        (arg1 - arg1_zero_point). The output is stored as by requantize.
+            template <typename TA, typename TB, typename TO>
+            void quantized_dot(const TA* arg0,
+                               const TB* arg1,
+                               TO* out,
+                               const Shape& arg0_shape,
+                               const Shape& arg1_shape,
+                               const Shape& out_shape,
+                               size_t reduction_axes_count,
+                               double arg0_scale,
+                               int64_t arg0_zero_point,
+                               double arg1_scale,
+                               int64_t arg1_zero_point,
+                               double out_scale,
+                               int64_t out_zero_point)
+            {
+                // As in dot, the arguments are an (m x k) and a (k x n) matrix
+                size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
+                size_t m = shape_size(
+                    Shape(arg0_shape.begin(), arg0_shape.begin() + arg0_projected_rank));
+                size_t k = shape_size(
+                    Shape(arg1_shape.begin(), arg1_shape.begin() + reduction_axes_count));
+                size_t n =
+                    shape_size(Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+
+                std::vector<int32_t> acc(m * n);
+                gemm(arg0, arg1, acc.data(), m, n, k);
+
+                // sum((a - za) * (b - zb)) = sum(a * b) - zb * sum(a) - za * sum(b) + k * za * zb
+                if (arg0_zero_point != 0 || arg1_zero_point != 0)
+                {
+                    int32_t za = static_cast<int32_t>(arg0_zero_point);
+                    int32_t zb = static_cast<int32_t>(arg1_zero_point);
+                    std::vector<int32_t> column_sums(n, 0);
+                    for (size_t p = 0; p < k; p++)
+                    {
+                        for (size_t j = 0; j < n; j++)
+                        {
+                            column_sums[j] += arg1[p * n + j];
+                        }
+                    }
+                    for (size_t i = 0; i < m; i++)
+                    {
+                        int32_t row_sum = 0;
+                        for (size_t p = 0; p < k; p++)
+                        {
+                            row_sum += arg0[i * k + p];
+                        }
+                        int32_t row_correction = zb * row_sum - static_cast<int32_t>(k) * za * zb;
+                        for (size_t j = 0; j < n; j++)
+                        {
+                            acc[i * n + j] -= row_correction + za * column_sums[j];
+                        }
+                    }
+                }
+
+                requantize(acc.data(),
+                           out,
+                           acc.size(),
+                           arg0_scale * arg1_scale,
+                           out_scale,
+                           out_zero_point);
+            }
+        }
+    }
+}
@@ -16,10 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -36,23 +37,11 @@ namespace ngraph
                         const AxisSet& reduction_axes,
                         std::function<T(T, T)> reduction_function)
             {
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), *arg1);
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = *arg1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = project(input_coord, reduction_axes);
-                    size_t input_index = input_transform.index(input_coord);
-                    size_t output_index = output_transform.index(output_coord);
-
-                    out[output_index] = reduction_function(out[output_index], arg0[input_index]);
-                }
+                for_each_reduction(in_shape, reduction_axes, [&](size_t out_i, size_t in_i) {
+                    out[out_i] = reduction_function(out[out_i], arg0[in_i]);
+                });
             }
         }
     }
@@ -19,7 +19,7 @@
 #include <cmath>
 #include <functional>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -37,57 +37,32 @@ namespace ngraph
                                const Shape& window_shape,
                                const Strides& window_movement_strides)
             {
-                // At the outermost level we will walk over every output coordinate O.
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& out_coord : output_transform)
-                {
-                    // Our output coordinate O will have the form:
-                    //
-                    //   (i_1,...,i_n)
-                    //
-                    // For the reductee we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (s_1*i_1 + window_shape_1,...,s_n*i_n + window_shape_n)
-                    //
-                    // with unit stride.
-
-                    Shape reductee_transform_start;
-                    Shape reductee_transform_end;
-
-                    for (size_t i = 0; i < arg_reductee_shape.size(); i++)
-                    {
-                        size_t window_shape_this_dim = window_shape[i];
-                        size_t movement_stride = window_movement_strides[i];
-
-                        reductee_transform_start.push_back(movement_stride * out_coord[i]);
-                        reductee_transform_end.push_back(reductee_transform_start[i] +
-                                                         window_shape_this_dim);
-                    }
-
-                    CoordinateTransform reductee_transform(
-                        arg_reductee_shape, reductee_transform_start, reductee_transform_end);
-
-                    // As we go, we compute the reduced value:
-                    //
-                    //   output[O] := reduction_function(output[O],arg[I])
-
+                // For every output coordinate
+                //
+                //   (i_1,...,i_n)
+                //
+                // we walk the reductee window
+                //
+                //   (s_1*i_1,s_2*i_2,...,s_n*i_n) ->
+                //
+                //     (s_1*i_1 + window_shape_1,...,s_n*i_n + window_shape_n)
+                //
+                // with unit stride, computing output[O] := reduction_function(output[O],arg[I]).
+                WindowWalk window(arg_reductee_shape,
+                                  window_shape,
+                                  window_movement_strides,
+                                  Shape(arg_reductee_shape.size(), 0));
+                size_t out_index = 0;
+                for_each_coordinate(out_shape, [&](const Coordinate& out_coord) {
                     T result = *arg_init;
 
-                    for (const Coordinate& reductee_coord : reductee_transform)
-                    {
-                        result = reduction_function(
-                            result, arg_reductee[reductee_transform.index(reductee_coord)]);
-                    }
+                    window.move_to(out_coord);
+                    window.for_each([&](std::ptrdiff_t reductee_index) {
+                        result = reduction_function(result, arg_reductee[reductee_index]);
+                    });
 
-                    out[output_transform.index(out_coord)] = result;
-                }
+                    out[out_index++] = result;
+                });
             }
         }
     }
@@ -17,8 +17,10 @@
 #pragma once
 
 #include <cmath>
+#include <cstring>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/copy.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -37,29 +39,23 @@ namespace ngraph
                                const Shape& out_shape)
             {
                 // Step 1: Copy the entire replacement context to the output.
-                CoordinateTransform copy_transform(out_shape);
-
-                for (Coordinate copy_coord : copy_transform)
+                if (out != arg0)
                 {
-                    out[copy_transform.index(copy_coord)] = arg0[copy_transform.index(copy_coord)];
+                    std::memcpy(out, arg0, shape_size(out_shape) * sizeof(T));
                 }
 
                 // Step 2: Overwrite the slice for replacement.
-                CoordinateTransform input_transform(arg1_shape);
-                CoordinateTransform output_transform(
-                    out_shape, lower_bounds, upper_bounds, strides);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                ElementStrides out_strides = dense_strides(out_shape);
+                std::ptrdiff_t out_offset = 0;
+                for (size_t i = 0; i < out_shape.size(); i++)
                 {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg1[input_transform.index(input_coord)];
-
-                    ++output_it;
+                    out_offset += lower_bounds[i] * out_strides[i];
+                    out_strides[i] *= strides[i];
                 }
+
+                StridedWalk<2> walk(
+                    arg1_shape, {{out_strides, dense_strides(arg1_shape)}}, {{out_offset, 0}});
+                strided_copy(arg1, out, walk);
             }
         }
     }
@@ -18,7 +18,8 @@
 
 #include <cmath>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/copy.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -34,23 +35,19 @@ namespace ngraph
                          const AxisSet& reversed_axes)
             {
                 // In fact arg_shape == out_shape, but we'll use both for stylistic consistency with other kernels.
-                CoordinateTransform arg_transform(arg_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                for (Coordinate out_coord : output_transform)
+                // The input is read backwards along the reversed axes, starting from their ends.
+                ElementStrides arg_strides = dense_strides(arg_shape);
+                std::ptrdiff_t arg_offset = 0;
+                for (size_t axis : reversed_axes)
                 {
-                    Coordinate arg_coord = out_coord;
-
-                    for (size_t i = 0; i < arg_coord.size(); i++)
-                    {
-                        if (reversed_axes.count(i) != 0)
-                        {
-                            arg_coord[i] = arg_shape[i] - arg_coord[i] - 1;
-                        }
-                    }
-
-                    out[output_transform.index(out_coord)] = arg[arg_transform.index(arg_coord)];
+                    arg_offset += (static_cast<std::ptrdiff_t>(arg_shape[axis]) - 1) *
+                                  arg_strides[axis];
+                    arg_strides[axis] = -arg_strides[axis];
                 }
+
+                StridedWalk<2> walk(
+                    out_shape, {{dense_strides(out_shape), arg_strides}}, {{0, arg_offset}});
+                strided_copy(arg, out, walk);
             }
         }
     }
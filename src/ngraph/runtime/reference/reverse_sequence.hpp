@@ -19,7 +19,7 @@
 #include <cmath>
 #include <numeric>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 #include "ngraph/util.hpp"
 
 namespace ngraph
@@ -36,9 +36,9 @@ namespace ngraph
                                   size_t sequence_axis,
                                   U* sequence_lengths)
             {
-                CoordinateTransform input_transform(arg_shape);
-                for (const Coordinate& in_coord : input_transform)
-                {
+                std::ptrdiff_t sequence_stride = dense_strides(arg_shape)[sequence_axis];
+                std::ptrdiff_t in_index = 0;
+                for_each_coordinate(arg_shape, [&](const Coordinate& in_coord) {
                     size_t batch_index = in_coord[batch_axis];
                     auto orig_seq_index = static_cast<size_t>(sequence_lengths[batch_index]);
 
@@ -58,11 +58,14 @@ namespace ngraph
                                                 ? orig_seq_index - in_coord[sequence_axis] - 1
                                                 : in_coord[sequence_axis];
 
-                    //make a copy of in_coord and update sequence_index
-                    Coordinate out_coord = in_coord;
-                    out_coord[sequence_axis] = sequence_index;
-                    out[input_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
-                }
+                    // The output coordinate only differs from the input one on the sequence axis.
+                    std::ptrdiff_t out_index =
+                        in_index + (static_cast<std::ptrdiff_t>(sequence_index) -
+                                    static_cast<std::ptrdiff_t>(in_coord[sequence_axis])) *
+                                       sequence_stride;
+                    out[out_index] = arg[in_index];
+                    in_index++;
+                });
             }
         }
     }
@@ -16,10 +16,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 
-#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -41,76 +42,38 @@ namespace ngraph
                                     const Strides& window_movement_strides)
             {
                 // First write every element of the output with the supplied initial value.
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& out_coord : output_transform)
-                {
-                    out[output_transform.index(out_coord)] = *arg_init;
-                }
-
-                // Slide the window over selectee/output.
-                Shape window_start_corner_transform_start(arg_selectee_shape.size(), 0);
-                Shape window_start_corner_transform_end(arg_selectee_shape.size());
-
-                for (size_t i = 0; i < arg_selectee_shape.size(); i++)
-                {
-                    window_start_corner_transform_end[i] =
-                        arg_selectee_shape[i] - window_shape[i] + 1;
-                }
-
-                CoordinateTransform window_start_corner_transform(
-                    arg_selectee_shape,
-                    window_start_corner_transform_start,
-                    window_start_corner_transform_end,
-                    window_movement_strides);
-
-                CoordinateTransform source_transform(arg_source_shape);
-                CoordinateTransform::Iterator source_it = source_transform.begin();
-
-                for (Coordinate window_start_coord : window_start_corner_transform)
-                {
-                    // We need a physical rather than virtual coordinate to start the window.
-                    window_start_coord =
-                        window_start_corner_transform.to_source_coordinate(window_start_coord);
-
-                    Shape window_transform_end(arg_selectee_shape.size());
-                    for (size_t i = 0; i < arg_selectee_shape.size(); i++)
-                    {
-                        window_transform_end[i] = window_start_coord[i] + window_shape[i];
-                    }
-
-                    CoordinateTransform window_transform(
-                        arg_selectee_shape, window_start_coord, window_transform_end);
-
+                std::fill(out, out + shape_size(out_shape), *arg_init);
+
+                // Slide the window over selectee/output; the source has one element per window
+                // position.
+                WindowWalk window(arg_selectee_shape,
+                                  window_shape,
+                                  window_movement_strides,
+                                  Shape(arg_selectee_shape.size(), 0));
+                size_t source_index = 0;
+                for_each_coordinate(arg_source_shape, [&](const Coordinate& source_coord) {
                     bool first_val = true;
-                    Coordinate winner_coord;
+                    std::ptrdiff_t winner_index = 0;
 
                     // This initial value is ignored; it's just here so the compiler knows
                     // for sure that winner_val is initialized.
                     T winner_val = 0;
 
-                    for (const Coordinate& challenger_coord : window_transform)
-                    {
-                        T challenger_val = arg_selectee[window_transform.index(challenger_coord)];
+                    window.move_to(source_coord);
+                    window.for_each([&](std::ptrdiff_t challenger_index) {
+                        T challenger_val = arg_selectee[challenger_index];
 
                         if (first_val || selection_function(challenger_val, winner_val))
                         {
-                            winner_coord = challenger_coord;
+                            winner_index = challenger_index;
                             winner_val = challenger_val;
                             first_val = false;
                         }
-                    }
-
-                    Coordinate source_coord = *source_it;
-
-                    T old_output_val = out[window_transform.index(winner_coord)];
-                    T source_val = arg_source[source_transform.index(source_coord)];
-                    T new_output_val = scatter_function(old_output_val, source_val);
-
-                    out[window_transform.index(winner_coord)] = new_output_val;
+                    });
 
-                    ++source_it;
-                }
+                    T source_val = arg_source[source_index++];
+                    out[winner_index] = scatter_function(out[winner_index], source_val);
+                });
             }
         }
     }
@@ -16,10 +16,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
-#include "ngraph/coordinate_transform.hpp"
+#include <vector>
+
 #include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/parallel_for.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/strided_walk.hpp"
 
 namespace ngraph
 {
@@ -27,34 +31,90 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Softmax over each row of a dense rows x row_size matrix, i.e. over the
+            ///        innermost axes of a tensor. Each row is reduced to its maximum and then
+            ///        exponentiated, summed and scaled while it is still in cache; rows are
+            ///        spread across threads.
             template <typename T>
-            void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+            void softmax_innermost(const T* arg, T* out, size_t rows, size_t row_size)
             {
-                auto temp_shape = project(shape, axes);
-                auto temp_elements = std::accumulate(
-                    temp_shape.begin(), temp_shape.end(), 1, std::multiplies<size_t>());
-                auto temp_ptr = new T[temp_elements];
+                if (row_size == 0)
+                {
+                    return;
+                }
 
-                max(arg, temp_ptr, shape, temp_shape, axes);
+                // Roughly 64K elements per thread before splitting the rows pays off.
+                size_t min_rows = std::max<size_t>(1, (size_t(1) << 16) / row_size);
+                parallel_for(rows, min_rows, [arg, out, row_size](size_t begin, size_t end) {
+                    for (size_t row = begin; row < end; row++)
+                    {
+                        const T* arg_row = arg + row * row_size;
+                        T* out_row = out + row * row_size;
 
-                CoordinateTransform transform(shape);
-                CoordinateTransform temp_transform(temp_shape);
-                for (const Coordinate& coord : transform)
+                        T row_max = arg_row[0];
+                        for (size_t i = 1; i < row_size; i++)
+                        {
+                            row_max = arg_row[i] > row_max ? arg_row[i] : row_max;
+                        }
+
+                        T row_sum = 0;
+                        for (size_t i = 0; i < row_size; i++)
+                        {
+                            out_row[i] = std::exp(arg_row[i] - row_max);
+                            row_sum += out_row[i];
+                        }
+
+                        T scale = T(1) / row_sum;
+                        for (size_t i = 0; i < row_size; i++)
+                        {
+                            out_row[i] *= scale;
+                        }
+                    }
+                });
+            }
+
+            /// \brief If the softmax axes are the trailing axes of shape, returns the size of
+            ///        a row they span, otherwise 0.
+            inline size_t softmax_innermost_row_size(const Shape& shape, const AxisSet& axes)
+            {
+                size_t row_size = 1;
+                for (size_t i = shape.size(); i-- > shape.size() - axes.size();)
                 {
-                    Coordinate temp_coord = project(coord, axes);
-                    out[transform.index(coord)] = std::exp(
-                        arg[transform.index(coord)] - temp_ptr[temp_transform.index(temp_coord)]);
+                    if (axes.count(i) == 0)
+                    {
+                        return 0;
+                    }
+                    row_size *= shape[i];
                 }
+                return row_size;
+            }
 
-                sum(out, temp_ptr, shape, temp_shape, axes);
-
-                for (const Coordinate& coord : transform)
+            template <typename T>
+            void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+            {
+                size_t row_size = softmax_innermost_row_size(shape, axes);
+                if (row_size != 0)
                 {
-                    Coordinate temp_coord = project(coord, axes);
-                    out[transform.index(coord)] /= temp_ptr[temp_transform.index(temp_coord)];
+                    softmax_innermost(arg, out, shape_size(shape) / row_size, row_size);
+                    return;
                 }
 
-                delete[] temp_ptr;
+                auto temp_shape = project(shape, axes);
+                std::vector<T> temp(shape_size(temp_shape));
+
+                max(arg, temp.data(), shape, temp_shape, axes);
+
+                StridedWalk<2> walk(shape,
+                                    {{dense_strides(shape), projected_strides(shape, axes)}});
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[0]] = std::exp(arg[offsets[0]] - temp[offsets[1]]);
+                });
+
+                sum(out, temp.data(), shape, temp_shape, axes);
+
+                walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+                    out[offsets[0]] /= temp[offsets[1]];
+                });
             }
         }
     }
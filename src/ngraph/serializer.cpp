@@ -14,8 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <functional>
+#include <map>
+#include <mutex>
 
 #include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
@@ -37,6 +42,7 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/cos.hpp"
 #include "ngraph/op/cosh.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/equal.hpp"
@@ -64,6 +70,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reduce.hpp"
 #include "ngraph/op/reduce_window.hpp"
 #include "ngraph/op/relu.hpp"
@@ -107,8 +114,42 @@ static std::shared_ptr<ngraph::Function>
 
 static json write(const ngraph::Function&, bool binary_constant_data);
 static json write(const ngraph::Node&, bool binary_constant_data);
+static json write_functions(shared_ptr<ngraph::Function> func, bool binary_constant_data);
 static string
     serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
+static shared_ptr<ngraph::Function> read_binary_model(shared_ptr<const char> data, size_t size);
+// An archive that lazily loaded constants read from
+struct LazyArchive
+{
+    string path;
+    ifstream stream;
+    std::mutex mutex;
+};
+
+using cpio_constant_callback_t =
+    shared_ptr<Node>(const cpio::FileInfo&, const element::Type&, const Shape&);
+static shared_ptr<ngraph::Function> read_cpio_model(cpio::Reader& reader,
+                                                    function<cpio_constant_callback_t>);
+static bool is_binary_model(istream& in);
+
+// A binary model is a header, then one section per constant, then the graph. Every constant
+// section starts on a page boundary so a mapped file can serve as the constant data as is.
+// The graph is the json function list, without constant values, encoded as CBOR and
+// accompanied by a table that locates each constant's section. CBOR is smaller and quicker to
+// parse than json text, but it is decoded into a full json document before read_function runs,
+// so a large graph still costs as much memory to load as it does from json.
+static const char binary_model_magic[8] = {'n', 'G', 'r', 'a', 'p', 'h', 'B', 'M'};
+static const uint32_t binary_model_version = 1;
+static const size_t binary_model_alignment = 4096;
+
+struct BinaryModelHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t alignment;
+    uint64_t graph_offset;
+    uint64_t graph_size;
+};
 
 static json write_element_type(const ngraph::element::Type& n)
 {
@@ -166,7 +207,7 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
             {
                 uint32_t size = static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
                                                       c->get_output_element_type(0).size());
-                writer.write(c->get_name(), c->get_data_ptr(), size);
+                writer.write(c->get_name(), c->get_data().get(), size);
             }
         });
     });
@@ -174,7 +215,7 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
     writer.close();
 }
 
-static string serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data)
+static json write_functions(shared_ptr<ngraph::Function> func, bool binary_constant_data)
 {
     json j;
     vector<json> functions;
@@ -185,6 +226,12 @@ static string serialize(shared_ptr<ngraph::Function> func, size_t indent, bool b
     {
         j.push_back(*it);
     }
+    return j;
+}
+
+static string serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data)
+{
+    json j = write_functions(func, binary_constant_data);
 
     string rc;
     if (indent == 0)
@@ -203,46 +250,243 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
-shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+void ngraph::serialize_binary(const string& path, shared_ptr<ngraph::Function> func)
 {
-    shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    ofstream out(path, ios_base::binary | ios_base::out);
+    serialize_binary(out, func);
+    if (!out)
     {
-        cpio::Reader reader(in);
-        vector<cpio::FileInfo> file_info = reader.get_file_info();
-        if (file_info.size() > 0)
+        throw ngraph_error("error writing binary model '" + path + "'");
+    }
+}
+
+void ngraph::serialize_binary(ostream& out, shared_ptr<ngraph::Function> func)
+{
+    // Lay out the constant sections first, so the graph can record where each one lives
+    map<string, shared_ptr<op::Constant>> constants;
+    traverse_functions(func, [&](shared_ptr<ngraph::Function> f) {
+        traverse_nodes(f.get(), [&](shared_ptr<Node> node) {
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                constants[c->get_name()] = c;
+            }
+        });
+    });
+
+    json constant_table = json::object();
+    size_t offset = round_up(sizeof(BinaryModelHeader), binary_model_alignment);
+    for (auto& entry : constants)
+    {
+        auto& c = entry.second;
+        size_t size = shape_size(c->get_shape()) * c->get_element_type().size();
+        constant_table[entry.first] = {offset, size};
+        offset = round_up(offset + size, binary_model_alignment);
+    }
+
+    json model;
+    model["functions"] = write_functions(func, true);
+    model["constants"] = constant_table;
+    vector<uint8_t> graph = json::to_cbor(model);
+
+    BinaryModelHeader header;
+    memcpy(header.magic, binary_model_magic, sizeof(header.magic));
+    header.version = binary_model_version;
+    header.alignment = binary_model_alignment;
+    header.graph_offset = offset;
+    header.graph_size = graph.size();
+
+    size_t position = 0;
+    auto pad_to = [&](size_t target) {
+        vector<char> padding(target - position, 0);
+        out.write(padding.data(), padding.size());
+        position = target;
+    };
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    position += sizeof(header);
+    for (auto& entry : constants)
+    {
+        auto& c = entry.second;
+        size_t size = shape_size(c->get_shape()) * c->get_element_type().size();
+        pad_to(constant_table[entry.first][0].get<size_t>());
+        out.write(static_cast<const char*>(c->get_data().get()), size);
+        position += size;
+    }
+    pad_to(header.graph_offset);
+    out.write(reinterpret_cast<const char*>(graph.data()), graph.size());
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize_binary(const string& path)
+{
+    size_t size;
+    shared_ptr<const char> data = file_util::map_file(path, size);
+    return read_binary_model(data, size);
+}
+
+static bool is_binary_model(istream& in)
+{
+    auto offset = in.tellg();
+    char magic[sizeof(binary_model_magic)] = {};
+    in.read(magic, sizeof(magic));
+    bool rc = in.gcount() == sizeof(magic) &&
+              memcmp(magic, binary_model_magic, sizeof(binary_model_magic)) == 0;
+    in.clear();
+    in.seekg(offset);
+    return rc;
+}
+
+// Reads the rest of a stream straight into page-aligned memory. The size of a seekable stream is
+// known up front; any other stream is read in chunks into a buffer that doubles as it fills.
+static shared_ptr<const char> read_binary_stream(istream& in, size_t& size)
+{
+    auto allocate = [](size_t capacity) {
+        char* buffer = static_cast<char*>(ngraph::aligned_alloc(
+            binary_model_alignment, round_up(max<size_t>(capacity, 1), binary_model_alignment)));
+        return shared_ptr<char>(buffer, [](char* p) { ngraph::aligned_free(p); });
+    };
+
+    size_t capacity = binary_model_alignment;
+    auto start = in.tellg();
+    if (start != istream::pos_type(-1) && in.seekg(0, ios_base::end))
+    {
+        capacity = static_cast<size_t>(in.tellg() - start);
+        in.seekg(start);
+    }
+    in.clear();
+
+    shared_ptr<char> buffer = allocate(capacity);
+    size = 0;
+    while (in)
+    {
+        if (size == capacity)
         {
-            // The first file is the model
-            uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
-            json js = json::parse(jstr);
-            unordered_map<string, shared_ptr<Function>> function_map;
-            for (json func : js)
-            {
-                shared_ptr<Function> f = read_function(
-                    func,
-                    function_map,
-                    [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                        shared_ptr<Node> const_node;
-                        for (const cpio::FileInfo& info : file_info)
-                        {
-                            if (info.get_name() == const_name)
-                            {
-                                void* const_data = malloc(info.get_size());
-                                reader.read(const_name, const_data, info.get_size());
-                                const_node = make_shared<op::Constant>(et, shape, const_data);
-                                free(const_data);
-                                break;
-                            }
-                        }
-                        return const_node;
-                    });
-                rc = f;
+            if (in.peek() == istream::traits_type::eof())
+            {
+                break;
             }
+            capacity *= 2;
+            shared_ptr<char> larger = allocate(capacity);
+            memcpy(larger.get(), buffer.get(), size);
+            buffer = larger;
         }
+        in.read(buffer.get() + size, capacity - size);
+        size += static_cast<size_t>(in.gcount());
+    }
+    return buffer;
+}
+
+static shared_ptr<ngraph::Function> read_binary_model(shared_ptr<const char> data, size_t size)
+{
+    BinaryModelHeader header;
+    if (size < sizeof(header))
+    {
+        throw ngraph_error("Binary model is truncated");
+    }
+    memcpy(&header, data.get(), sizeof(header));
+    if (memcmp(header.magic, binary_model_magic, sizeof(binary_model_magic)) != 0)
+    {
+        throw ngraph_error("Not a binary model");
+    }
+    if (header.version != binary_model_version)
+    {
+        throw ngraph_error("Unsupported binary model version " + to_string(header.version));
+    }
+    if (header.graph_offset > size || header.graph_size > size - header.graph_offset)
+    {
+        throw ngraph_error("Binary model is truncated");
+    }
+
+    const uint8_t* graph = reinterpret_cast<const uint8_t*>(data.get() + header.graph_offset);
+    json model = json::from_cbor(vector<uint8_t>(graph, graph + header.graph_size));
+    const json& constant_table = model.at("constants");
+
+    auto const_data_callback =
+        [&](const string& const_name, const element::Type& et, const Shape& shape) {
+            auto section = constant_table.at(const_name);
+            size_t offset = section.at(0).get<size_t>();
+            size_t const_size = section.at(1).get<size_t>();
+            if (const_size != shape_size(shape) * et.size() || offset > size ||
+                const_size > size - offset)
+            {
+                throw ngraph_error("Binary model section for constant '" + const_name +
+                                   "' does not match its type");
+            }
+            // The constant shares ownership of the whole mapping but points at its section
+            shared_ptr<const void> const_data(data, data.get() + offset);
+            return static_pointer_cast<Node>(make_shared<op::Constant>(et, shape, const_data));
+        };
+
+    shared_ptr<Function> rc;
+    unordered_map<string, shared_ptr<Function>> function_map;
+    for (const json& func : model.at("functions"))
+    {
+        rc = read_function(func, function_map, const_data_callback);
+    }
+    return rc;
+}
+
+// The first member of a cpio model is the json graph and the others hold constant data.
+// make_constant creates each constant from the member named after it.
+static shared_ptr<ngraph::Function>
+    read_cpio_model(cpio::Reader& reader, function<cpio_constant_callback_t> make_constant)
+{
+    shared_ptr<Function> rc;
+    const vector<cpio::FileInfo>& file_info = reader.get_file_info();
+    if (file_info.size() > 0)
+    {
+        // The first file is the model
+        uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
+        string jstr(size, '\0');
+        reader.read(file_info[0].get_name(), &jstr[0], size);
+        json js = json::parse(jstr);
+
+        unordered_map<string, const cpio::FileInfo*> members;
+        for (const cpio::FileInfo& info : file_info)
+        {
+            members.emplace(info.get_name(), &info);
+        }
+
+        unordered_map<string, shared_ptr<Function>> function_map;
+        for (json func : js)
+        {
+            rc = read_function(
+                func,
+                function_map,
+                [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                    shared_ptr<Node> const_node;
+                    auto it = members.find(const_name);
+                    if (it != members.end())
+                    {
+                        const_node = make_constant(*it->second, et, shape);
+                    }
+                    return const_node;
+                });
+        }
+    }
+    return rc;
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+{
+    shared_ptr<Function> rc;
+    if (is_binary_model(in))
+    {
+        // A stream cannot be mapped, so read it once into page-aligned memory that the
+        // constants then share
+        size_t size;
+        shared_ptr<const char> data = read_binary_stream(in, size);
+        rc = read_binary_model(data, size);
+    }
+    else if (cpio::is_cpio(in))
+    {
+        cpio::Reader reader(in);
+        rc = read_cpio_model(
+            reader, [&](const cpio::FileInfo& info, const element::Type& et, const Shape& shape) {
+                vector<char> const_data(info.get_size());
+                in.seekg(info.get_offset(), ios_base::beg);
+                in.read(const_data.data(), const_data.size());
+                return static_pointer_cast<Node>(
+                    make_shared<op::Constant>(et, shape, const_data.data()));
+            });
     }
     else
     {
@@ -261,7 +505,45 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     {
         // s is a file and not a json string
         ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (is_binary_model(in))
+        {
+            rc = deserialize_binary(s);
+        }
+        else if (cpio::is_cpio(in))
+        {
+            // Constants are read from the file when first used, so weights that are never
+            // used are never loaded. The loaders share one open handle, which also keeps the
+            // data readable if the file is removed or replaced after deserializing.
+            cpio::Reader reader(in);
+            auto archive = make_shared<LazyArchive>();
+            archive->path = s;
+            archive->stream.open(s, ios_base::binary | ios_base::in);
+            auto make_constant =
+                [&](const cpio::FileInfo& info, const element::Type& et, const Shape& shape) {
+                    op::Constant::DataLoader loader = [archive, info, et]() {
+                        shared_ptr<const void> data(
+                            ngraph::aligned_alloc(et.size(), info.get_size()),
+                            [](const void* p) { ngraph::aligned_free(const_cast<void*>(p)); });
+                        lock_guard<mutex> lock(archive->mutex);
+                        archive->stream.clear();
+                        archive->stream.seekg(info.get_offset(), ios_base::beg);
+                        archive->stream.read(static_cast<char*>(const_cast<void*>(data.get())),
+                                             info.get_size());
+                        if (!archive->stream)
+                        {
+                            throw ngraph_error("error reading constant '" + info.get_name() +
+                                               "' from '" + archive->path + "'");
+                        }
+                        return data;
+                    };
+                    return static_pointer_cast<Node>(make_shared<op::Constant>(et, shape, loader));
+                };
+            rc = read_cpio_model(reader, make_constant);
+        }
+        else
+        {
+            rc = deserialize(in);
+        }
     }
     else
     {
@@ -577,6 +859,13 @@ static shared_ptr<ngraph::Function>
             {
                 node = make_shared<op::Cosh>(args[0]);
             }
+            else if (node_op == "Dequantize")
+            {
+                auto type = read_element_type(node_js.at("type"));
+                auto scale = node_js.at("scale").get<double>();
+                auto zero_point = node_js.at("zero_point").get<int64_t>();
+                node = make_shared<op::Dequantize>(args[0], type, scale, zero_point);
+            }
             else if (node_op == "Divide")
             {
                 node = make_shared<op::Divide>(args[0], args[1]);
@@ -755,6 +1044,13 @@ static shared_ptr<ngraph::Function>
                 auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
                 node = make_shared<op::Product>(args[0], reduction_axes);
             }
+            else if (node_op == "Quantize")
+            {
+                auto type = read_element_type(node_js.at("type"));
+                auto scale = node_js.at("scale").get<double>();
+                auto zero_point = node_js.at("zero_point").get<int64_t>();
+                node = make_shared<op::Quantize>(args[0], type, scale, zero_point);
+            }
             else if (node_op == "Reduce")
             {
                 auto reduction_axes = node_js.at("reduction_axes").get<set<size_t>>();
@@ -1091,6 +1387,13 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Cosh")
     {
     }
+    else if (node_op == "Dequantize")
+    {
+        auto tmp = dynamic_cast<const op::Dequantize*>(&n);
+        node["type"] = write_element_type(tmp->get_element_type());
+        node["scale"] = tmp->get_scale();
+        node["zero_point"] = tmp->get_zero_point();
+    }
     else if (node_op == "Divide")
     {
     }
@@ -1203,6 +1506,13 @@ static json write(const Node& n, bool binary_constant_data)
     else if (node_op == "Power")
     {
     }
+    else if (node_op == "Quantize")
+    {
+        auto tmp = dynamic_cast<const op::Quantize*>(&n);
+        node["type"] = write_element_type(tmp->get_element_type());
+        node["scale"] = tmp->get_scale();
+        node["zero_point"] = tmp->get_zero_point();
+    }
     else if (node_op == "Reduce")
     {
         auto tmp = dynamic_cast<const op::Reduce*>(&n);
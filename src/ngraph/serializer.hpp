@@ -48,11 +48,36 @@ namespace ngraph
     //    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
+    // @brief Serialize a Function to a binary model file
+    // @param path The path to the output file
+    // @param func The Function to serialize
+    //
+    // Every constant is stored in its own page-aligned section, so a model can be loaded by
+    // mapping the file. The graph is stored as the json function list, without constant
+    // values, encoded as CBOR. Loading still decodes the graph into a json document before
+    // building the Function, so only the constants avoid the cost of json.
+    void serialize_binary(const std::string& path, std::shared_ptr<ngraph::Function> func);
+
+    // @brief Serialize a Function in the binary model format
+    // @param out The output stream to which the data is serialized.
+    // @param func The Function to serialize
+    void serialize_binary(std::ostream& out, std::shared_ptr<ngraph::Function> func);
+
+    // @brief Deserialize a binary model file by memory-mapping it
+    // @param path The path to a file written by serialize_binary
+    //
+    // Constants refer to the mapped pages instead of copies, so loading does not touch the
+    // constant data and processes loading the same file share its pages. The graph itself is
+    // read through a json document, as for the other formats.
+    std::shared_ptr<ngraph::Function> deserialize_binary(const std::string& path);
+
     // @brief Deserialize a Function
     // @param in An isteam to the input data
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     // @brief Deserialize a Function
-    // @param str The json formatted string to deseriailze.
+    // @param str The json formatted string to deseriailze, or the path of a json, cpio or
+    //    binary model file. Binary model files are memory-mapped. Constants of a cpio file are
+    //    read when first used, see op::Constant::release_data.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 }
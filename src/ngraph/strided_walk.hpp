@@ -0,0 +1,317 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/coordinate.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    /// \brief Per-axis distance, in elements, between neighbouring elements of a tensor. A zero
+    ///        stride revisits the same element (broadcast or reduced axes) and a negative
+    ///        stride walks an axis backwards.
+    using ElementStrides = std::vector<std::ptrdiff_t>;
+
+    /// \brief Row-major element strides of a dense tensor.
+    inline ElementStrides dense_strides(const Shape& shape)
+    {
+        ElementStrides strides(shape.size());
+        std::ptrdiff_t stride = 1;
+        for (size_t i = shape.size(); i-- > 0;)
+        {
+            strides[i] = stride;
+            stride *= shape[i];
+        }
+        return strides;
+    }
+
+    /// \brief Strides over a shape of the dense tensor that has the shape with the given axes
+    ///        removed, as read by broadcasts and written by reductions. The removed axes get a
+    ///        zero stride.
+    inline ElementStrides projected_strides(const Shape& shape, const AxisSet& axes)
+    {
+        ElementStrides strides(shape.size(), 0);
+        std::ptrdiff_t stride = 1;
+        for (size_t i = shape.size(); i-- > 0;)
+        {
+            if (axes.count(i) == 0)
+            {
+                strides[i] = stride;
+                stride *= shape[i];
+            }
+        }
+        return strides;
+    }
+
+    /// \brief Visits every coordinate of a shape in row-major order. The coordinate is updated
+    ///        in place, so the i-th call sees the coordinate of row-major index i.
+    template <typename F>
+    void for_each_coordinate(const Shape& shape, F&& f)
+    {
+        if (shape_size(shape) == 0)
+        {
+            return;
+        }
+        Coordinate coord(shape.size(), 0);
+        while (true)
+        {
+            f(static_cast<const Coordinate&>(coord));
+            size_t axis = shape.size();
+            while (true)
+            {
+                if (axis == 0)
+                {
+                    return;
+                }
+                axis--;
+                if (++coord[axis] < shape[axis])
+                {
+                    break;
+                }
+                coord[axis] = 0;
+            }
+        }
+    }
+
+    /// \brief Walks the index space of a shape in row-major order while keeping one linear
+    ///        element offset per operand, so no coordinates are formed or translated.
+    ///
+    /// Every operand is given by its element strides over the walked shape plus a base offset.
+    /// Axes of extent one are dropped and adjacent axes that are contiguous for all operands
+    /// are merged, so the innermost run is as long as possible: a kernel can handle it with
+    /// a memcpy or a tight loop over constant strides.
+    template <size_t N>
+    class StridedWalk
+    {
+    public:
+        using Offsets = std::array<std::ptrdiff_t, N>;
+
+        StridedWalk() = default;
+
+        StridedWalk(const Shape& shape,
+                    const std::array<ElementStrides, N>& strides,
+                    const Offsets& base_offsets = Offsets())
+        {
+            reset(shape, strides, base_offsets);
+        }
+
+        /// \brief Re-targets the walk. Storage is reused, so a walk that is reset for every
+        ///        window of a pooling kernel does not allocate after the first window.
+        void reset(const Shape& shape,
+                   const std::array<ElementStrides, N>& strides,
+                   const Offsets& base_offsets = Offsets())
+        {
+            m_base_offsets = base_offsets;
+            m_shape.clear();
+            for (size_t k = 0; k < N; k++)
+            {
+                m_strides[k].clear();
+            }
+            m_empty = false;
+
+            for (size_t axis = 0; axis < shape.size(); axis++)
+            {
+                if (shape[axis] == 0)
+                {
+                    m_empty = true;
+                }
+                if (shape[axis] <= 1)
+                {
+                    continue;
+                }
+
+                bool merge = !m_shape.empty();
+                for (size_t k = 0; k < N && merge; k++)
+                {
+                    merge = m_strides[k].back() ==
+                            strides[k][axis] * static_cast<std::ptrdiff_t>(shape[axis]);
+                }
+                if (merge)
+                {
+                    m_shape.back() *= shape[axis];
+                    for (size_t k = 0; k < N; k++)
+                    {
+                        m_strides[k].back() = strides[k][axis];
+                    }
+                }
+                else
+                {
+                    m_shape.push_back(shape[axis]);
+                    for (size_t k = 0; k < N; k++)
+                    {
+                        m_strides[k].push_back(strides[k][axis]);
+                    }
+                }
+            }
+            m_counter.resize(m_shape.size());
+        }
+
+        /// \brief Calls f(offsets, count, inner_strides) for each innermost run. The run
+        ///        covers the elements offsets[k] + i * inner_strides[k] for i < count.
+        template <typename F>
+        void for_each_run(F&& f)
+        {
+            if (m_empty)
+            {
+                return;
+            }
+            Offsets offsets = m_base_offsets;
+            Offsets inner_strides;
+            if (m_shape.empty())
+            {
+                inner_strides.fill(0);
+                f(static_cast<const Offsets&>(offsets), size_t(1), inner_strides);
+                return;
+            }
+
+            size_t inner = m_shape.size() - 1;
+            for (size_t k = 0; k < N; k++)
+            {
+                inner_strides[k] = m_strides[k][inner];
+            }
+            std::fill(m_counter.begin(), m_counter.end(), 0);
+            while (true)
+            {
+                f(static_cast<const Offsets&>(offsets), m_shape[inner], inner_strides);
+                size_t axis = inner;
+                while (true)
+                {
+                    if (axis == 0)
+                    {
+                        return;
+                    }
+                    axis--;
+                    for (size_t k = 0; k < N; k++)
+                    {
+                        offsets[k] += m_strides[k][axis];
+                    }
+                    if (++m_counter[axis] < m_shape[axis])
+                    {
+                        break;
+                    }
+                    m_counter[axis] = 0;
+                    for (size_t k = 0; k < N; k++)
+                    {
+                        offsets[k] -=
+                            m_strides[k][axis] * static_cast<std::ptrdiff_t>(m_shape[axis]);
+                    }
+                }
+            }
+        }
+
+        /// \brief Calls f(offsets) for each element, in row-major order of the walked shape.
+        template <typename F>
+        void for_each(F&& f)
+        {
+            for_each_run([&f](const Offsets& run_offsets, size_t count, const Offsets& strides) {
+                Offsets offsets = run_offsets;
+                for (size_t i = 0; i < count; i++)
+                {
+                    f(static_cast<const Offsets&>(offsets));
+                    for (size_t k = 0; k < N; k++)
+                    {
+                        offsets[k] += strides[k];
+                    }
+                }
+            });
+        }
+
+    private:
+        Shape m_shape;
+        std::array<ElementStrides, N> m_strides;
+        Offsets m_base_offsets;
+        std::vector<size_t> m_counter;
+        bool m_empty = true;
+    };
+
+    /// \brief Walks a tensor being reduced over the given axes and calls
+    ///        f(out_offset, in_offset) for each of its elements. The input is walked densely in
+    ///        row-major order while the offset into the reduced output stays put along the
+    ///        reduced axes, so each output element sees its inputs in order.
+    template <typename F>
+    void for_each_reduction(const Shape& in_shape, const AxisSet& reduction_axes, F&& f)
+    {
+        StridedWalk<2> walk(
+            in_shape, {{projected_strides(in_shape, reduction_axes), dense_strides(in_shape)}});
+        walk.for_each([&f](const StridedWalk<2>::Offsets& offsets) { f(offsets[0], offsets[1]); });
+    }
+
+    /// \brief Walks the windows of a pooling-style op over one image. The window of an output
+    ///        coordinate, given in padded coordinates, is clipped to the image and its elements
+    ///        are then visited in row-major order without allocating.
+    class WindowWalk
+    {
+    public:
+        WindowWalk(const Shape& image_shape,
+                   const Shape& window_shape,
+                   const Strides& window_movement_strides,
+                   const Shape& padding_below)
+            : m_image_shape(image_shape)
+            , m_image_strides{{dense_strides(image_shape)}}
+            , m_window_shape(window_shape)
+            , m_window_movement_strides(window_movement_strides)
+            , m_padding_below(padding_below)
+            , m_extent(image_shape.size())
+        {
+        }
+
+        /// \brief Positions the window for an output coordinate and returns the number of
+        ///        image elements it covers.
+        size_t move_to(const Coordinate& out_coord)
+        {
+            std::ptrdiff_t offset = 0;
+            size_t count = 1;
+            for (size_t i = 0; i < m_image_shape.size(); i++)
+            {
+                std::ptrdiff_t start =
+                    static_cast<std::ptrdiff_t>(out_coord[i] * m_window_movement_strides[i]) -
+                    static_cast<std::ptrdiff_t>(m_padding_below[i]);
+                std::ptrdiff_t end = start + static_cast<std::ptrdiff_t>(m_window_shape[i]);
+                start = std::max<std::ptrdiff_t>(start, 0);
+                end = std::min<std::ptrdiff_t>(end, m_image_shape[i]);
+                m_extent[i] = end > start ? end - start : 0;
+                offset += start * m_image_strides[0][i];
+                count *= m_extent[i];
+            }
+            m_walk.reset(m_extent, m_image_strides, {{offset}});
+            return count;
+        }
+
+        /// \brief Calls f(offset) for every image element covered by the current window.
+        template <typename F>
+        void for_each(F&& f)
+        {
+            m_walk.for_each([&f](const StridedWalk<1>::Offsets& offsets) { f(offsets[0]); });
+        }
+
+    private:
+        Shape m_image_shape;
+        std::array<ElementStrides, 1> m_image_strides;
+        Shape m_window_shape;
+        Strides m_window_movement_strides;
+        Shape m_padding_below;
+        Shape m_extent;
+        StridedWalk<1> m_walk;
+    };
+}
@@ -130,7 +130,8 @@ OPTIONS
         cout << "total nodes: " << f->get_ops().size() << endl;
         size_t total_constant_bytes = 0;
         unordered_map<string, size_t> op_list;
-        for (shared_ptr<Node> node : f->get_ordered_ops())
+        auto ordered_ops = f->get_ordered_ops();
+        for (shared_ptr<Node> node : *ordered_ops)
         {
             string name = node->get_name();
             string op_name = name.substr(0, name.find('_'));
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdlib>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -25,9 +26,18 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
+#include "util/all_close.hpp"
 #include "util/benchmark.hpp"
 #include "util/random.hpp"
 #include "util/test_tools.hpp"
@@ -194,3 +204,110 @@ TEST(benchmark, concat_32x1x200_axis1_6)
         }
     }
 }
+
+//
+// Benchmarks a quantized convolution feeding a quantized dot on the CPU backend, once as the
+// f32 graph and once rewritten to int8 kernels by setting NGRAPH_CPU_INT8.
+//
+TEST(benchmark, cpu_quantized_conv_dot)
+{
+    Shape data_shape{4, 8, 14, 14};
+    Shape filters_shape{16, 8, 3, 3};
+    Shape flat_shape{4, 16 * 12 * 12};
+    Shape weights_shape{16 * 12 * 12, 32};
+
+    vector<int8_t> filter_values(shape_size(filters_shape));
+    vector<int8_t> weight_values(shape_size(weights_shape));
+    for (size_t i = 0; i < filter_values.size(); i++)
+    {
+        filter_values[i] = static_cast<int8_t>(static_cast<int>((i * 37) % 201) - 100);
+    }
+    for (size_t i = 0; i < weight_values.size(); i++)
+    {
+        weight_values[i] = static_cast<int8_t>(static_cast<int>((i * 53) % 255) - 127);
+    }
+
+    vector<float> data(shape_size(data_shape));
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    rng.initialize(data);
+
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, data_shape);
+        auto filters = op::Constant::create(element::i8, filters_shape, filter_values);
+        auto weights = op::Constant::create(element::i8, weights_shape, weight_values);
+
+        auto A_q = make_shared<op::Quantize>(A, element::u8, 2.0 / 255, 128);
+        auto conv = make_shared<op::Convolution>(
+            make_shared<op::Dequantize>(A_q, element::f32, 2.0 / 255, 128),
+            make_shared<op::Dequantize>(filters, element::f32, 0.01, 0));
+        auto relu = make_shared<op::Relu>(conv);
+        auto conv_q = make_shared<op::Quantize>(relu, element::u8, 0.04, 0);
+        auto conv_dq = make_shared<op::Dequantize>(conv_q, element::f32, 0.04, 0);
+        auto flat = make_shared<op::Reshape>(conv_dq, AxisVector{0, 1, 2, 3}, flat_shape);
+        auto dot =
+            make_shared<op::Dot>(flat, make_shared<op::Dequantize>(weights, element::f32, 0.01, 0));
+        auto dot_q = make_shared<op::Quantize>(dot, element::i8, 1.0, 0);
+        return make_shared<Function>(make_shared<op::Dequantize>(dot_q, element::f32, 1.0, 0),
+                                     op::ParameterVector{A});
+    };
+
+    vector<std::string> variant_names{"f32", "int8"};
+    vector<bool> use_int8{false, true};
+    int n_runs = 200;
+    vector<std::function<void()>> test_callbacks;             // one for each variant
+    vector<std::shared_ptr<runtime::TensorView>> result_tvs; // one for each variant
+
+    auto backend = runtime::Backend::create("CPU");
+    for (size_t i = 0; i < variant_names.size(); i++)
+    {
+        auto f = make_function();
+
+        auto a = backend->create_tensor(element::f32, data_shape);
+        copy_data(a, data);
+        auto result_tv = backend->create_tensor(element::f32, Shape{4, 32});
+        result_tvs.push_back(result_tv);
+
+        // The backend compiles on the first call, which is when it reads NGRAPH_CPU_INT8
+        if (use_int8[i])
+        {
+            setenv("NGRAPH_CPU_INT8", "1", 1);
+        }
+        backend->call(f, {result_tv}, {a});
+        unsetenv("NGRAPH_CPU_INT8");
+
+        test_callbacks.push_back([backend, f, result_tv, a]() {
+            backend->call(f, {result_tv}, {a});
+        });
+    }
+
+    for (size_t i = 0; i < variant_names.size(); i++)
+    {
+        std::cout << variant_names[i] << ": " << n_runs << " tests in " << std::flush;
+
+        stopwatch sw;
+        std::function<void()> cb = test_callbacks[i];
+
+        sw.start();
+        for (int j = 0; j < n_runs; j++)
+        {
+            cb();
+        }
+        sw.stop();
+
+        std::cout << sw.get_milliseconds() << "ms (" << (sw.get_microseconds() / n_runs)
+                  << " us/test)" << std::endl;
+    }
+
+    std::cout << "Verifying " << variant_names[1] << " result against " << variant_names[0]
+              << "..." << std::flush;
+    // The f32 graph rounds its accumulations, so a requantized value may differ by a step
+    if (test::all_close<float>(result_tvs[1], result_tvs[0], 0.0f, 2.0f))
+    {
+        std::cout << " OK" << std::endl;
+    }
+    else
+    {
+        std::cout << " FAILED" << std::endl;
+        ADD_FAILURE();
+    }
+}
@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <future>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -210,6 +211,66 @@ NGRAPH_TEST(${BACKEND_NAME}, abc)
               (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector());
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, call_async)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A * B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    const size_t num_calls = 16;
+    vector<shared_ptr<runtime::TensorView>> results;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < num_calls; i++)
+    {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        copy_data(b, vector<float>(4, static_cast<float>(i)));
+        results.push_back(result);
+        futures.push_back(backend->call_async(f, {result}, {a, b}));
+    }
+
+    for (size_t i = 0; i < num_calls; i++)
+    {
+        EXPECT_TRUE(futures[i].get());
+        float x = static_cast<float>(i);
+        EXPECT_EQ(read_vector<float>(results[i]), (vector<float>{x, 2 * x, 3 * x, 4 * x}));
+    }
+
+    // Errors are reported through the future
+    auto bad = backend->create_tensor(element::f32, Shape{3});
+    auto a = backend->create_tensor(element::f32, shape);
+    auto error_future = backend->call_async(f, {bad}, {a, a});
+    EXPECT_ANY_THROW(error_future.get());
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, call_async_callback)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(A - B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{5, 6, 7, 8});
+    copy_data(b, vector<float>{1, 2, 3, 4});
+
+    promise<bool> done;
+    backend->call_async(f, {result}, {a, b}, [&done](bool rc, exception_ptr error) {
+        done.set_value(rc && error == nullptr);
+    });
+    EXPECT_TRUE(done.get_future().get());
+    EXPECT_EQ(read_vector<float>(result), (vector<float>{4, 4, 4, 4}));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, abc_int64)
 {
     Shape shape{2, 2};
@@ -239,6 +300,37 @@ NGRAPH_TEST(${BACKEND_NAME}, abc_int64)
     EXPECT_EQ((vector<int64_t>{50, 72, 98, 128}), read_vector<int64_t>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, elementwise_chain_in_place)
+{
+    // t is still read by the Add when the Abs runs, so only the Add may overwrite it
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto t = make_shared<op::Negative>(make_shared<op::Exp>(A));
+    auto u = make_shared<op::Abs>(t);
+    auto v = make_shared<op::Multiply>(make_shared<op::Add>(t, u), make_shared<op::Negative>(t));
+    auto f = make_shared<Function>(make_shared<op::Subtract>(v, u), op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{0, 1, 2, 3});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call(f, {result}, {a});
+    vector<float> expected;
+    for (float x : {0.0f, 1.0f, 2.0f, 3.0f})
+    {
+        expected.push_back(-expf(x));
+    }
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+
+    // Temporaries are rewritten on every call
+    copy_data(a, vector<float>{3, 2, 1, 0});
+    backend->call(f, {result}, {a});
+    reverse(expected.begin(), expected.end());
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
+
 // Multiple retrive values
 NGRAPH_TEST(${BACKEND_NAME}, multiple_result)
 {
@@ -1318,6 +1410,54 @@ NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_vector_int64)
     EXPECT_EQ((vector<int64_t>{190, 486, 782, 1078}), read_vector<int64_t>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, dot_matrix_blocked_int64)
+{
+    // Large enough to span several cache blocks along every axis, with ragged edges.
+    size_t m = 37;
+    size_t k = 300;
+    size_t n = 67;
+    Shape shape_a{m, k};
+    Shape shape_b{k, n};
+    auto A = make_shared<op::Parameter>(element::i64, shape_a);
+    auto B = make_shared<op::Parameter>(element::i64, shape_b);
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), op::ParameterVector{A, B});
+    Shape shape_r{m, n};
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<int64_t> a_data(m * k);
+    vector<int64_t> b_data(k * n);
+    for (size_t i = 0; i < a_data.size(); i++)
+    {
+        a_data[i] = static_cast<int64_t>(i % 7) - 3;
+    }
+    for (size_t i = 0; i < b_data.size(); i++)
+    {
+        b_data[i] = static_cast<int64_t>(i % 5) - 2;
+    }
+    vector<int64_t> expected(m * n, 0);
+    for (size_t i = 0; i < m; i++)
+    {
+        for (size_t j = 0; j < n; j++)
+        {
+            for (size_t l = 0; l < k; l++)
+            {
+                expected[i * n + j] += a_data[i * k + l] * b_data[l * n + j];
+            }
+        }
+    }
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::i64, shape_a);
+    copy_data(a, a_data);
+    auto b = backend->create_tensor(element::i64, shape_b);
+    copy_data(b, b_data);
+    auto result = backend->create_tensor(element::i64, shape_r);
+
+    backend->call(f, {result}, {a, b});
+    EXPECT_EQ(expected, read_vector<int64_t>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, greater)
 {
     Shape shape{2, 2, 2};
@@ -1611,6 +1751,32 @@ NGRAPH_TEST(${BACKEND_NAME}, constant_multi_use)
     EXPECT_EQ(read_vector<int>(r2), std::vector<int>{388});
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, constant_release_data)
+{
+    // A compiled function keeps the data of a lazily loaded constant it uses
+    size_t loads = 0;
+    auto A = make_shared<op::Constant>(element::f32, Shape{4}, [&loads]() {
+        loads++;
+        auto data = make_shared<vector<float>>(vector<float>{1, 2, 3, 4});
+        return shared_ptr<const void>(data, data->data());
+    });
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto f = make_shared<Function>(A + B, op::ParameterVector{B});
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto b = backend->create_tensor(element::f32, Shape{4});
+    copy_data(b, vector<float>{10, 20, 30, 40});
+    auto result = backend->create_tensor(element::f32, Shape{4});
+    backend->call(f, {result}, {b});
+    EXPECT_EQ((vector<float>{11, 22, 33, 44}), read_vector<float>(result));
+
+    EXPECT_TRUE(A->release_data());
+    copy_data(b, vector<float>{50, 60, 70, 80});
+    backend->call(f, {result}, {b});
+    EXPECT_EQ((vector<float>{51, 62, 73, 84}), read_vector<float>(result));
+    EXPECT_EQ(1, loads);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, constant_broadcast)
 {
     const string js =
@@ -2001,6 +2167,86 @@ NGRAPH_TEST(${BACKEND_NAME}, convert_float32_bool)
     EXPECT_EQ((vector<char>{1, 2, 3, 4}), read_vector<char>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, quantize_float32_uint8)
+{
+    Shape shape{2, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Quantize>(A, element::u8, 0.5, 10),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-10, -0.25, 0, 0.25, 0.75, 1, 100, 200});
+    auto result = backend->create_tensor(element::u8, shape);
+
+    // Rounds half to even and saturates to [0, 255]
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<uint8_t>{0, 10, 10, 10, 12, 12, 210, 255}), read_vector<uint8_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize_nan)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Quantize>(A, element::i8, 0.5, -3),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a,
+              vector<float>{numeric_limits<float>::quiet_NaN(),
+                            -numeric_limits<float>::quiet_NaN(),
+                            numeric_limits<float>::infinity(),
+                            -numeric_limits<float>::infinity()});
+    auto result = backend->create_tensor(element::i8, shape);
+
+    // NaN maps to the zero point and infinities saturate
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<int8_t>{-3, -3, 127, -128}), read_vector<int8_t>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, dequantize_int8_float32)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::i8, shape);
+    auto f = make_shared<Function>(make_shared<op::Dequantize>(A, element::f32, 0.25, -2),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::i8, shape);
+    copy_data(a, vector<int8_t>{-128, -2, 0, 127});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{-31.5, 0, 0.5, 32.25}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, quantize_dequantize_round_trip)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto quantize = make_shared<op::Quantize>(A, element::i8, 0.125, 3);
+    auto f = make_shared<Function>(make_shared<op::Dequantize>(quantize, element::f32, 0.125, 3),
+                                   op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{-16.375, -1.1, 0, 0.3, 7.0625, 20});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    // Values in range come back within half a step, the others are clamped
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{-16.375, -1.125, 0, 0.25, 7, 15.5}), read_vector<float>(result));
+}
+
 // Trivial case with no reduction axes.
 NGRAPH_TEST(${BACKEND_NAME}, reduce_trivial)
 {
@@ -2295,6 +2541,40 @@ NGRAPH_TEST(${BACKEND_NAME}, reduce_3d_to_vector)
               read_vector<float>(result));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, reduce_matrix_columns_composite)
+{
+    // First, the reduction function (f(x:float32[],y:float32[]) = x+y*y).
+    auto f_A = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f_B = make_shared<op::Parameter>(element::f32, Shape{});
+    auto f = make_shared<Function>(make_shared<op::Add>(f_A, make_shared<op::Multiply>(f_B, f_B)),
+                                   op::ParameterVector{f_A, f_B});
+
+    Shape shape_a{3, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    Shape shape_b{};
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    Shape shape_rt{2};
+    auto g = make_shared<Function>(make_shared<op::Reduce>(A, B, f, AxisSet{0}),
+                                   op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    auto b = backend->create_tensor(element::f32, shape_b);
+    copy_data(b, vector<float>{1});
+    auto result = backend->create_tensor(element::f32, shape_rt);
+
+    backend->call(g, {result}, {a, b});
+    EXPECT_EQ((vector<float>{1 + 1 + 9 + 25, 1 + 4 + 16 + 36}), read_vector<float>(result));
+
+    // The reduction function is evaluated again on the second call
+    copy_data(b, vector<float>{2});
+    backend->call(g, {result}, {a, b});
+    EXPECT_EQ((vector<float>{2 + 1 + 9 + 25, 2 + 4 + 16 + 36}), read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, reshape_t2v_012)
 {
     Shape shape_a{2, 2, 3};
@@ -7806,6 +8086,50 @@ NGRAPH_TEST(${BACKEND_NAME}, softmax_axis)
     EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, softmax_innermost_axes_large_negative)
+{
+    // Rows whose exponentials underflow unless the row maximum is subtracted first.
+    Shape shape{2, 2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f =
+        make_shared<Function>(make_shared<op::Softmax>(A, AxisSet{1, 2}), op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a,
+              vector<float>{-1000,
+                            -1001,
+                            -1002,
+                            -1003,
+                            -1004,
+                            -1005,
+                            -2005,
+                            -2004,
+                            -2003,
+                            -2002,
+                            -2001,
+                            -2000});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto d = expf(0) + expf(-1) + expf(-2) + expf(-3) + expf(-4) + expf(-5);
+
+    backend->call(f, {result}, {a});
+    vector<float> expected{expf(0) / d,
+                           expf(-1) / d,
+                           expf(-2) / d,
+                           expf(-3) / d,
+                           expf(-4) / d,
+                           expf(-5) / d,
+                           expf(-5) / d,
+                           expf(-4) / d,
+                           expf(-3) / d,
+                           expf(-2) / d,
+                           expf(-1) / d,
+                           expf(0) / d};
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, softmax_axis_2)
 {
     Shape shape{2, 3};
@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(constant_folding, reshape_broadcast_multiply)
+{
+    auto constant = op::Constant::create(element::f32, Shape{2, 3}, {1, 2, 3, 4, 5, 6});
+    auto reshape = make_shared<op::Reshape>(constant, AxisVector{1, 0}, Shape{3, 2});
+    auto broadcast = make_shared<op::Broadcast>(reshape, Shape{2, 3, 2}, AxisSet{0});
+    auto scale = op::Constant::create(element::f32, Shape{2, 3, 2}, {2});
+    auto weights = make_shared<op::Multiply>(broadcast, scale);
+
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 2});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, weights), op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 1);
+
+    auto add = f->get_results().at(0)->get_argument(0);
+    auto folded = dynamic_pointer_cast<op::Constant>(add->get_argument(1));
+    ASSERT_TRUE(folded);
+    vector<float> expected{2, 8, 4, 10, 6, 12, 2, 8, 4, 10, 6, 12};
+    ASSERT_EQ(expected, folded->get_vector<float>());
+}
+
+TEST(constant_folding, keep_large_broadcast)
+{
+    auto zero = op::Constant::create(element::f32, Shape{}, {0});
+    auto broadcast = make_shared<op::Broadcast>(zero, Shape{1024, 1024}, AxisSet{0, 1});
+    auto A = make_shared<op::Parameter>(element::f32, Shape{1024, 1024});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, broadcast), op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    // Folding would turn a scalar into a 4MB constant
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+
+    pass::Manager large_pass_manager;
+    large_pass_manager.register_pass<pass::ConstantFolding>(4 * 1024 * 1024);
+    large_pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 0);
+}
+
+TEST(constant_folding, convert)
+{
+    auto constant = op::Constant::create(element::i32, Shape{4}, {-1, 0, 1, 300});
+    auto f = make_shared<Function>(make_shared<op::Convert>(constant, element::f64),
+                                   op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    auto folded = dynamic_pointer_cast<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(folded);
+    ASSERT_EQ(element::f64, folded->get_element_type());
+    ASSERT_EQ((vector<double>{-1, 0, 1, 300}), folded->get_vector<double>());
+}
+
+TEST(constant_folding, quantize)
+{
+    auto constant = op::Constant::create(element::f32, Shape{4}, {-1.0, 0.2, 0.25, 100.0});
+    auto quantize = make_shared<op::Quantize>(constant, element::i8, 0.1, -2);
+    auto f = make_shared<Function>(make_shared<op::Dequantize>(quantize, element::f32, 0.1, -2),
+                                   op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    // The int8 constant stays behind the Dequantize, so weights are stored quantized
+    ASSERT_EQ(count_ops_of_type<op::Quantize>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Dequantize>(f), 1);
+    auto folded = dynamic_pointer_cast<op::Constant>(
+        f->get_results().at(0)->get_argument(0)->get_argument(0));
+    ASSERT_TRUE(folded);
+    ASSERT_EQ(element::i8, folded->get_element_type());
+    ASSERT_EQ((vector<int8_t>{-12, 0, 0, 127}), folded->get_vector<int8_t>());
+}
+
+TEST(constant_folding, keep_integer_division_by_zero)
+{
+    auto a = op::Constant::create(element::i32, Shape{2}, {1, 2});
+    auto b = op::Constant::create(element::i32, Shape{2}, {1, 0});
+    auto f = make_shared<Function>(make_shared<op::Divide>(a, b), op::ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Divide>(f), 1);
+}
+
+TEST(constant_folding, skip_parameters)
+{
+    auto constant = op::Constant::create(element::f32, Shape{2}, {1, 2});
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto negative = make_shared<op::Negative>(constant);
+    auto f = make_shared<Function>(make_shared<op::Subtract>(A, negative), op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Subtract>(f), 1);
+}
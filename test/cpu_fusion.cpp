@@ -53,13 +53,17 @@
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/cpu/op/lstm.hpp"
 #include "ngraph/runtime/cpu/op/matmul_bias.hpp"
+#include "ngraph/runtime/cpu/op/quantized_conv.hpp"
+#include "ngraph/runtime/cpu/op/quantized_dot.hpp"
 #include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid.hpp"
 #include "ngraph/runtime/cpu/op/sigmoid_mul.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_concat_inputs.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_post_layout_optimizations.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_quantization.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_rnn_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_workspace_insertion.hpp"
 #include "ngraph/serializer.hpp"
@@ -1428,6 +1432,95 @@ TEST(cpu_fusion, loop_kernel_copy_with_new_args)
     EXPECT_EQ(read_vector<int>(r2), read_vector<int>(copy_r2));
     EXPECT_EQ(read_vector<int>(r3), read_vector<int>(copy_r3));
 }
+
+TEST(cpu_fusion, loop_kernel_fusion_pass)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto t = (A + B) * C;
+    auto u = make_shared<op::Relu>(t);
+    auto v = make_shared<op::Tanh>(t) - A;
+    auto f = make_shared<Function>(NodeVector{u, v}, op::ParameterVector{A, B, C});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 0);
+    auto lk = std::dynamic_pointer_cast<runtime::cpu::op::LoopKernel>(
+        f->get_results().at(0)->get_argument(0)->get_argument(0));
+    ASSERT_TRUE(lk);
+    EXPECT_EQ(lk->get_node_list().size(), 5);
+    EXPECT_EQ(lk->get_kernel_outputs().size(), 2);
+    EXPECT_EQ(lk->get_input_size(), 3);
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_external_consumer)
+{
+    Shape shape{3, 4};
+    auto make_function = [shape]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto t = make_shared<op::Exp>(A - B);
+        // The Sum reads t from outside any region, so t must stay an output of the kernel
+        auto s = make_shared<op::Broadcast>(make_shared<op::Sum>(t, AxisSet{1}), shape, AxisSet{1});
+        auto r = make_shared<op::Negative>(t) + A;
+        return make_shared<Function>(NodeVector{s / r, r}, op::ParameterVector{A, B});
+    };
+
+    auto fused = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
+    pass_manager.run_passes(fused);
+    ASSERT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(fused), 1);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(fused), 1);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (size_t i = 0; i < 2; i++)
+    {
+        vector<float> tensor_val(shape_size(shape));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    auto cpu_results = execute(make_function(), args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_fusion, loop_kernel_fusion_no_cycle)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto x = make_shared<op::Negative>(A);
+    auto w = make_shared<op::Exp>(x);
+    // Fusing x and z into one kernel would make it depend on itself through the Sum
+    auto y = make_shared<op::Broadcast>(make_shared<op::Sum>(x, AxisSet{0}), shape, AxisSet{0});
+    auto z = x + y;
+    auto f = make_shared<Function>(NodeVector{w, z}, op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 1);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto r0 = backend->create_tensor(element::f32, shape);
+    auto r1 = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    backend->call(f, {r0, r1}, {a});
+    EXPECT_TRUE(test::all_close(
+        read_vector<float>(r1), vector<float>{-6, -9, -12, -9, -12, -15}));
+}
 static std::shared_ptr<ngraph::Function> make_forward_function()
 {
     Shape shape_a{10, 3, 28, 28};
@@ -2431,3 +2524,125 @@ TEST(cpu_fusion, fuse_rnn_across_2layer_1timestep)
         EXPECT_TRUE(test::all_close(cpu_results.at(1), int_results.at(1), 1.0e-4f, 1.0e-4f));
     }
 }
+
+TEST(cpu_fusion, quantized_conv_dot_ops)
+{
+    vector<int8_t> filter_values(2 * 1 * 3 * 3);
+    vector<int8_t> weight_values(18 * 4);
+    for (size_t i = 0; i < filter_values.size(); i++)
+    {
+        filter_values[i] = static_cast<int8_t>(static_cast<int>((i * 37) % 201) - 100);
+    }
+    for (size_t i = 0; i < weight_values.size(); i++)
+    {
+        weight_values[i] = static_cast<int8_t>(static_cast<int>((i * 53) % 255) - 127);
+    }
+
+    // The f32 graph the quantized ops stand for
+    auto make_real_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 1, 5, 5});
+        auto filters = op::Constant::create(element::i8, Shape{2, 1, 3, 3}, filter_values);
+        auto weights = op::Constant::create(element::i8, Shape{18, 4}, weight_values);
+        auto A_q = make_shared<op::Quantize>(A, element::u8, 2.0 / 255, 128);
+        auto conv = make_shared<op::Convolution>(
+            make_shared<op::Dequantize>(A_q, element::f32, 2.0 / 255, 128),
+            make_shared<op::Dequantize>(filters, element::f32, 0.01, 0));
+        auto conv_q = make_shared<op::Quantize>(conv, element::i8, 0.04, 0);
+        auto conv_dq = make_shared<op::Dequantize>(conv_q, element::f32, 0.04, 0);
+        auto flat = make_shared<op::Reshape>(conv_dq, AxisVector{0, 1, 2, 3}, Shape{1, 18});
+        auto dot =
+            make_shared<op::Dot>(flat, make_shared<op::Dequantize>(weights, element::f32, 0.01, 0));
+        return make_shared<Function>(dot, op::ParameterVector{A});
+    };
+
+    auto make_quantized_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 1, 5, 5});
+        auto filters = op::Constant::create(element::i8, Shape{2, 1, 3, 3}, filter_values);
+        auto weights = op::Constant::create(element::i8, Shape{18, 4}, weight_values);
+        auto A_q = make_shared<op::Quantize>(A, element::u8, 2.0 / 255, 128);
+        auto conv = make_shared<op::QuantizedConvolution>(A_q,
+                                                          filters,
+                                                          Strides{1, 1},
+                                                          Strides{1, 1},
+                                                          CoordinateDiff{0, 0},
+                                                          CoordinateDiff{0, 0},
+                                                          Strides{1, 1},
+                                                          2.0 / 255,
+                                                          128,
+                                                          0.01,
+                                                          element::i8,
+                                                          0.04,
+                                                          0);
+        auto flat = make_shared<op::Reshape>(conv, AxisVector{0, 1, 2, 3}, Shape{1, 18});
+        auto dot =
+            make_shared<op::QuantizedDot>(flat, weights, 1, 0.04, 0, 0.01, 0, element::f32);
+        return make_shared<Function>(dot, op::ParameterVector{A});
+    };
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> tensor_val(25);
+    rng.initialize(tensor_val);
+    vector<vector<float>> args{tensor_val};
+    auto int_results = execute(make_real_function(), args, "INTERPRETER");
+    auto cpu_results = execute(make_quantized_function(), args, "CPU");
+    // The f32 reference rounds its accumulation, so a requantized value may differ by a step
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 0.0f, 0.1f));
+}
+
+TEST(cpu_fusion, quantized_conv_dot)
+{
+    auto make_function = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 1, 5, 5});
+        vector<int8_t> filter_values(2 * 1 * 3 * 3);
+        vector<int8_t> weight_values(18 * 4);
+        for (size_t i = 0; i < filter_values.size(); i++)
+        {
+            filter_values[i] = static_cast<int8_t>(static_cast<int>((i * 37) % 201) - 100);
+        }
+        for (size_t i = 0; i < weight_values.size(); i++)
+        {
+            weight_values[i] = static_cast<int8_t>(static_cast<int>((i * 53) % 255) - 127);
+        }
+        auto filters = op::Constant::create(element::i8, Shape{2, 1, 3, 3}, filter_values);
+        auto weights = op::Constant::create(element::i8, Shape{18, 4}, weight_values);
+
+        auto A_q = make_shared<op::Quantize>(A, element::u8, 2.0 / 255, 128);
+        auto data = make_shared<op::Dequantize>(A_q, element::f32, 2.0 / 255, 128);
+        auto conv = make_shared<op::Convolution>(
+            data, make_shared<op::Dequantize>(filters, element::f32, 0.01, 0));
+        auto relu = make_shared<op::Relu>(conv);
+        auto conv_q = make_shared<op::Quantize>(relu, element::u8, 0.04, 0);
+        auto conv_dq = make_shared<op::Dequantize>(conv_q, element::f32, 0.04, 0);
+        auto flat = make_shared<op::Reshape>(conv_dq, AxisVector{0, 1, 2, 3}, Shape{1, 18});
+        auto dot =
+            make_shared<op::Dot>(flat, make_shared<op::Dequantize>(weights, element::f32, 0.01, 0));
+        auto dot_q = make_shared<op::Quantize>(dot, element::i8, 0.1, 0);
+        return make_shared<Function>(make_shared<op::Dequantize>(dot_q, element::f32, 0.1, 0),
+                                     op::ParameterVector{A});
+    };
+
+    auto quantized = make_function();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUQuantization>();
+    pass_manager.run_passes(quantized);
+    ASSERT_EQ(count_ops_of_type<op::QuantizedConvolution>(quantized), 1);
+    ASSERT_EQ(count_ops_of_type<op::QuantizedDot>(quantized), 1);
+    ASSERT_EQ(count_ops_of_type<op::Convolution>(quantized), 0);
+    ASSERT_EQ(count_ops_of_type<op::Dot>(quantized), 0);
+    ASSERT_EQ(count_ops_of_type<op::Relu>(quantized), 0);
+    // Only the input is quantized and only the result dequantized
+    ASSERT_EQ(count_ops_of_type<op::Quantize>(quantized), 1);
+    ASSERT_EQ(count_ops_of_type<op::Dequantize>(quantized), 1);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> tensor_val(25);
+    rng.initialize(tensor_val);
+    vector<vector<float>> args{tensor_val};
+    auto int_results = execute(make_function(), args, "INTERPRETER");
+    // The CPU backend only rewrites quantized regions when asked to
+    setenv("NGRAPH_CPU_INT8", "1", 1);
+    auto cpu_results = execute(make_function(), args, "CPU");
+    unsetenv("NGRAPH_CPU_INT8");
+    // The f32 reference rounds its accumulation, so a requantized value may differ by a step
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 0.0f, 0.2f));
+}
@@ -19,6 +19,7 @@
 #include <iostream>
 #include <list>
 #include <memory>
+#include <thread>
 
 #include "gtest/gtest.h"
 #include "ngraph/autodiff/adjoints.hpp"
@@ -31,6 +32,9 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/op/rnn.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -63,6 +67,324 @@ TEST(cpu_test, unhandled_op)
     ASSERT_THROW(backend->compile(f), ngraph_error);
 }
 
+TEST(cpu_test, concurrent_calls)
+{
+    Shape shape{16, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * C + A, op::ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(f);
+
+    const size_t num_threads = 8;
+    const size_t num_iterations = 50;
+    vector<size_t> failures(num_threads, 0);
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto c = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+
+            for (size_t i = 0; i < num_iterations; i++)
+            {
+                float x = static_cast<float>(t * num_iterations + i);
+                copy_data(a, vector<float>(shape_size(shape), x));
+                copy_data(b, vector<float>(shape_size(shape), 1));
+                copy_data(c, vector<float>(shape_size(shape), 2));
+                backend->call(f, {result}, {a, b, c});
+                if (read_vector<float>(result) != vector<float>(shape_size(shape), 3 * x + 2))
+                {
+                    failures[t]++;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_EQ(failures[t], 0) << "thread " << t;
+    }
+}
+
+TEST(cpu_test, dex_concurrent_calls)
+{
+    setenv("NGRAPH_DEX", "1", 1);
+
+    Shape shape{16, 16};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B + A, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(f);
+    unsetenv("NGRAPH_DEX");
+
+    const size_t num_threads = 8;
+    const size_t num_iterations = 50;
+    vector<size_t> failures(num_threads, 0);
+    vector<thread> threads;
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            auto a = backend->create_tensor(element::f32, shape);
+            auto b = backend->create_tensor(element::f32, shape);
+            auto result = backend->create_tensor(element::f32, shape);
+
+            for (size_t i = 0; i < num_iterations; i++)
+            {
+                float x = static_cast<float>(t * num_iterations + i);
+                copy_data(a, vector<float>(shape_size(shape), x));
+                copy_data(b, vector<float>(shape_size(shape), 2));
+                backend->call(f, {result}, {a, b});
+                if (read_vector<float>(result) != vector<float>(shape_size(shape), 3 * x + 4))
+                {
+                    failures[t]++;
+                }
+            }
+        });
+    }
+    for (auto& th : threads)
+    {
+        th.join();
+    }
+
+    for (size_t t = 0; t < num_threads; t++)
+    {
+        EXPECT_EQ(failures[t], 0) << "thread " << t;
+    }
+}
+
+// Compiles the functions built by make_function for code generation and for direct execution
+// and checks that both produce the same outputs for random inputs
+static void compare_dex_with_codegen(const function<shared_ptr<Function>()>& make_function)
+{
+    auto backend = runtime::Backend::create("CPU");
+    auto codegen_f = make_function();
+    setenv("NGRAPH_DEX", "1", 1);
+    auto dex_f = make_function();
+    backend->compile(dex_f);
+    unsetenv("NGRAPH_DEX");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<shared_ptr<runtime::TensorView>> args;
+    for (auto& param : codegen_f->get_parameters())
+    {
+        args.push_back(rng.initialize(backend->create_tensor(element::f32, param->get_shape())));
+    }
+    vector<shared_ptr<runtime::TensorView>> codegen_results;
+    vector<shared_ptr<runtime::TensorView>> dex_results;
+    for (size_t i = 0; i < codegen_f->get_output_size(); i++)
+    {
+        auto shape = codegen_f->get_output_shape(i);
+        codegen_results.push_back(backend->create_tensor(element::f32, shape));
+        dex_results.push_back(backend->create_tensor(element::f32, shape));
+    }
+
+    backend->call(codegen_f, codegen_results, args);
+    backend->call(dex_f, dex_results, args);
+    for (size_t i = 0; i < codegen_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(read_vector<float>(codegen_results[i]),
+                                    read_vector<float>(dex_results[i])))
+            << "output " << i;
+    }
+}
+
+TEST(cpu_test, dex_matches_codegen)
+{
+    compare_dex_with_codegen([]() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+        auto dot = make_shared<op::Dot>(A, B);
+        auto sum = make_shared<op::Sum>(dot, AxisSet{1});
+        auto centered = dot - make_shared<op::Broadcast>(sum, Shape{2, 4}, AxisSet{1});
+        auto reshape = make_shared<op::Reshape>(centered, AxisVector{1, 0}, Shape{4, 2});
+        auto slice = make_shared<op::Slice>(reshape, Coordinate{1, 0}, Coordinate{3, 2});
+        auto concat =
+            make_shared<op::Concat>(NodeVector{slice, make_shared<op::Tanh>(slice)}, 0);
+        auto max = make_shared<op::Max>(concat, AxisSet{0});
+        auto softmax = make_shared<op::Softmax>(concat, AxisSet{1});
+        return make_shared<Function>(NodeVector{max, softmax}, op::ParameterVector{A, B});
+    });
+}
+
+TEST(cpu_test, dex_matches_codegen_mkldnn)
+{
+    // Convolution, pooling and batch norm run as MKLDNN primitives. Their results are in MKLDNN
+    // layouts, so ConvertLayout ops are inserted ahead of the Sum and the function results.
+    compare_dex_with_codegen([]() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+        auto filters = make_shared<op::Parameter>(element::f32, Shape{4, 3, 3, 3});
+        auto gamma = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto beta = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto conv = make_shared<op::Convolution>(data, filters, Strides{1, 1}, Strides{1, 1});
+        auto max_pool = make_shared<op::MaxPool>(conv, Shape{2, 2}, Strides{2, 2});
+        auto avg_pool = make_shared<op::AvgPool>(max_pool, Shape{2, 2}, Strides{1, 1});
+        auto bn = make_shared<op::BatchNorm>(0.001, gamma, beta, avg_pool);
+        auto bn_output = make_shared<op::GetOutputElement>(bn, 0);
+        auto bn_mean = make_shared<op::GetOutputElement>(bn, 1);
+        auto sum = make_shared<op::Sum>(bn_output, AxisSet{2, 3});
+        return make_shared<Function>(NodeVector{max_pool, bn_output, bn_mean, sum},
+                                     op::ParameterVector{data, filters, gamma, beta});
+    });
+}
+
+TEST(cpu_test, dex_matches_codegen_rnn)
+{
+    compare_dex_with_codegen([]() {
+        auto src_layer = make_shared<op::Parameter>(element::f32, Shape{2, 10});
+        auto src_iter = make_shared<op::Parameter>(element::f32, Shape{4, 10});
+        auto weights_layer = make_shared<op::Parameter>(element::f32, Shape{40, 10});
+        auto weights_iter = make_shared<op::Parameter>(element::f32, Shape{40, 10});
+        auto biases = make_shared<op::Parameter>(element::f32, Shape{40});
+        auto rnn = make_shared<op::Rnn>(
+            src_layer, src_iter, weights_layer, weights_iter, biases, 1, 4, 1, 10, 10, 2, 1, 1);
+        auto ht = make_shared<op::GetOutputElement>(rnn, 0);
+        auto ct = make_shared<op::GetOutputElement>(rnn, 1);
+        return make_shared<Function>(
+            NodeVector{ht, ct},
+            op::ParameterVector{src_layer, src_iter, weights_layer, weights_iter, biases});
+    });
+}
+
+TEST(cpu_test, bind_execute)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * B, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_backend = static_pointer_cast<runtime::cpu::CPU_Backend>(backend);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    auto binding = cpu_backend->bind(f, {result}, {a, b});
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+    binding->execute();
+    EXPECT_EQ((vector<float>{30, 48, 70, 96}), read_vector<float>(result));
+
+    // Updated inputs and interleaved regular calls are picked up
+    copy_data(a, vector<float>{0, 0, 0, 0});
+    binding->execute();
+    EXPECT_EQ((vector<float>{25, 36, 49, 64}), read_vector<float>(result));
+
+    auto result2 = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 1, 1, 1});
+    backend->call(f, {result2}, {a, b});
+    EXPECT_EQ((vector<float>{1, 1, 1, 1}), read_vector<float>(result2));
+    copy_data(b, vector<float>{2, 2, 2, 2});
+    binding->execute();
+    EXPECT_EQ((vector<float>{4, 4, 4, 4}), read_vector<float>(result));
+
+    auto wrong = backend->create_tensor(element::f32, Shape{3});
+    EXPECT_THROW(cpu_backend->bind(f, {result}, {a, wrong}), runtime_error);
+}
+
+TEST(cpu_test, codegen_cache)
+{
+    string cache_dir = file_util::make_temp_directory();
+    setenv("NGRAPH_CPU_CODEGEN_CACHE", cache_dir.c_str(), 1);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = op::Constant::create(element::f32, shape, {10, 20, 30, 40});
+    auto f = make_shared<Function>(A * B, op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{10, 40, 90, 160}), read_vector<float>(result));
+
+    size_t cache_entries = 0;
+    file_util::iterate_files(cache_dir,
+                             [&cache_entries](const string& file, bool is_dir) {
+                                 if (!is_dir && file_util::get_file_ext(file) == ".o")
+                                 {
+                                     cache_entries++;
+                                 }
+                             },
+                             false);
+    EXPECT_EQ(1, cache_entries);
+
+    // Recompiling loads the cached object, constants are bound to this process
+    backend->remove_compiled_function(f);
+    copy_data(a, vector<float>{4, 3, 2, 1});
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{40, 60, 60, 40}), read_vector<float>(result));
+
+    unsetenv("NGRAPH_CPU_CODEGEN_CACHE");
+    file_util::remove_directory(cache_dir);
+}
+
+TEST(cpu_test, codegen_cache_split)
+{
+    string cache_dir = file_util::make_temp_directory();
+    setenv("NGRAPH_CPU_CODEGEN_CACHE", cache_dir.c_str(), 1);
+    setenv("NGRAPH_CPU_CODEGEN_THREADS", "2", 1);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = op::Constant::create(element::f32, shape, {10, 20, 30, 40});
+    auto f = make_shared<Function>((A * B) + A, op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{11, 42, 93, 164}), read_vector<float>(result));
+
+    // One object per codegen thread, none of them empty
+    string object_path;
+    file_util::iterate_files(cache_dir,
+                             [&object_path](const string& file, bool is_dir) {
+                                 if (!is_dir && file_util::get_file_ext(file) == ".o")
+                                 {
+                                     object_path = file;
+                                 }
+                             },
+                             false);
+    ASSERT_FALSE(object_path.empty());
+    ASSERT_TRUE(file_util::exists(object_path + ".1"));
+    EXPECT_FALSE(file_util::exists(object_path + ".2"));
+    EXPECT_GT(file_util::get_file_size(object_path), 0);
+    EXPECT_GT(file_util::get_file_size(object_path + ".1"), 0);
+
+    // Recompiling loads both cached objects
+    backend->remove_compiled_function(f);
+    copy_data(a, vector<float>{4, 3, 2, 1});
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{44, 63, 62, 41}), read_vector<float>(result));
+
+    // An incomplete set of objects is not loaded, the function is compiled again
+    file_util::remove_file(object_path + ".1");
+    backend->remove_compiled_function(f);
+    copy_data(a, vector<float>{1, 1, 1, 1});
+    backend->call(f, {result}, {a});
+    EXPECT_EQ((vector<float>{11, 21, 31, 41}), read_vector<float>(result));
+    EXPECT_TRUE(file_util::exists(object_path + ".1"));
+
+    unsetenv("NGRAPH_CPU_CODEGEN_THREADS");
+    unsetenv("NGRAPH_CPU_CODEGEN_CACHE");
+    file_util::remove_directory(cache_dir);
+}
+
 #ifdef NGRAPH_TBB_ENABLE
 TEST(cpu_test, abc_tbb)
 {
@@ -109,4 +431,59 @@ TEST(cpu_test, abc_tbb)
         unsetenv("NGRAPH_CPU_USE_TBB");
     }
 }
+
+TEST(cpu_test, dex_tbb_branches)
+{
+    // Independent branches are scheduled concurrently by direct execution with TBB
+    bool use_tbb = (getenv("NGRAPH_CPU_USE_TBB") != nullptr);
+    if (!use_tbb)
+    {
+        setenv("NGRAPH_CPU_USE_TBB", "1", 1);
+    }
+    setenv("NGRAPH_DEX", "1", 1);
+
+    Shape shape{8, 8};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    NodeVector branches;
+    for (size_t i = 0; i < 8; i++)
+    {
+        // Distinct constants keep CSE from merging the branches
+        shared_ptr<Node> branch =
+            A + op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), i));
+        for (size_t j = 0; j <= i; j++)
+        {
+            branch = (branch + B) * B;
+        }
+        branches.push_back(branch);
+    }
+    auto sum = branches[0];
+    for (size_t i = 1; i < branches.size(); i++)
+    {
+        sum = sum + branches[i];
+    }
+    auto f = make_shared<Function>(sum, op::ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    backend->compile(f);
+    unsetenv("NGRAPH_DEX");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 1));
+    copy_data(b, vector<float>(shape_size(shape), 1));
+
+    // With a = b = 1, branch i evaluates to 1 + i + (i + 1)
+    for (size_t i = 0; i < 10; i++)
+    {
+        backend->call(f, {result}, {a, b});
+        EXPECT_EQ(read_vector<float>(result), vector<float>(shape_size(shape), 72));
+    }
+
+    if (!use_tbb)
+    {
+        unsetenv("NGRAPH_CPU_USE_TBB");
+    }
+}
 #endif // NGRAPH_TBB_ENABLE
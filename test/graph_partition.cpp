@@ -212,7 +212,8 @@ TEST(graph_partition, placement_all_cpu_policy)
     shared_ptr<Node> AplusBtimesC = AplusB * C;
     shared_ptr<Function> f = make_shared<Function>(AplusBtimesC, op::ParameterVector{A, B, C});
 
-    for (auto node : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto node : *ordered_ops)
     {
         EXPECT_EQ(node->get_placement(), Placement::DEFAULT);
     }
@@ -222,7 +223,8 @@ TEST(graph_partition, placement_all_cpu_policy)
         [](shared_ptr<Node> node) { return Placement::CPU; });
     pass_manager.run_passes(f);
 
-    for (auto node : f->get_ordered_ops())
+    ordered_ops = f->get_ordered_ops();
+    for (auto node : *ordered_ops)
     {
         EXPECT_EQ(node->get_placement(), Placement::CPU);
     }
@@ -239,7 +241,8 @@ TEST(graph_partition, placement_int_with_cpu_mul_policy)
     shared_ptr<Node> AplusBtimesC = AplusB * C;
     shared_ptr<Function> f = make_shared<Function>(AplusBtimesC, op::ParameterVector{A, B, C});
 
-    for (auto node : f->get_ordered_ops())
+    auto ordered_ops = f->get_ordered_ops();
+    for (auto node : *ordered_ops)
     {
         EXPECT_EQ(node->get_placement(), Placement::DEFAULT);
     }
@@ -248,7 +251,8 @@ TEST(graph_partition, placement_int_with_cpu_mul_policy)
     pass_manager.register_pass<pass::AssignPlacement>(int_with_cpu_mul_policy);
     pass_manager.run_passes(f);
 
-    for (auto node : f->get_ordered_ops())
+    ordered_ops = f->get_ordered_ops();
+    for (auto node : *ordered_ops)
     {
         string node_op = node->description();
         if (node_op == "Multiply")
@@ -37,7 +37,7 @@ TEST(pass_manager, add)
     size_t node_count = 0;
     traverse_nodes(graph, [&](shared_ptr<Node> node) { node_count++; });
     pass_manager.run_passes(graph);
-    auto sorted = graph->get_ordered_ops();
+    auto sorted = *graph->get_ordered_ops();
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
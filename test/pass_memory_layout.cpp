@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <memory>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -28,6 +29,7 @@
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/backend.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -236,3 +238,238 @@ TEST(memory_layout, constant)
     size_t temporary_pool_size = f->get_temporary_pool_size();
     EXPECT_EQ(4, temporary_pool_size);
 }
+
+TEST(memory_layout, tensor_size)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(
+        1, false, [](const descriptor::Tensor& tensor) { return tensor.size() * 2; });
+
+    Shape shape{1};
+    auto c = op::Constant::create(element::i32, shape, {5});
+    auto f = make_shared<Function>(make_shared<op::Negative>(c), op::ParameterVector{});
+
+    pass_manager.run_passes(f);
+    size_t temporary_pool_size = f->get_temporary_pool_size();
+    EXPECT_EQ(8, temporary_pool_size);
+}
+
+TEST(memory_layout, interval_planner)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(
+        1, false, nullptr, pass::MemoryLayout::Planner::INTERVAL);
+
+    auto graph = make_test_graph();
+    pass_manager.run_passes(graph);
+    size_t temporary_pool_size = graph->get_temporary_pool_size();
+    EXPECT_LE(temporary_pool_size, 12);
+
+    // No two pool tensors live at the same step may overlap
+    set<descriptor::Tensor*> pool_tensors;
+    auto ordered_ops = graph->get_ordered_ops();
+    for (auto node : *ordered_ops)
+    {
+        pool_tensors.insert(node->liveness_new_list.begin(), node->liveness_new_list.end());
+    }
+    for (auto node : *ordered_ops)
+    {
+        set<descriptor::Tensor*> live_set(node->liveness_new_list.begin(),
+                                          node->liveness_new_list.end());
+        for (descriptor::Tensor* tensor : node->liveness_live_list)
+        {
+            if (pool_tensors.count(tensor) != 0)
+            {
+                live_set.insert(tensor);
+            }
+        }
+        vector<descriptor::Tensor*> live(live_set.begin(), live_set.end());
+        for (size_t i = 0; i < live.size(); i++)
+        {
+            for (size_t j = i + 1; j < live.size(); j++)
+            {
+                size_t a = live[i]->get_pool_offset();
+                size_t b = live[j]->get_pool_offset();
+                EXPECT_TRUE(a + live[i]->size() <= b || b + live[j]->size() <= a);
+            }
+        }
+    }
+}
+
+TEST(interval_planner, best_fit)
+{
+    pass::IntervalPlanner planner;
+    size_t a = planner.add(8, 0, 1);
+    size_t b = planner.add(4, 1, 2);
+    size_t c = planner.add(8, 2, 3);
+    size_t d = planner.add(4, 3, 3);
+    planner.plan();
+
+    // a and c are placed first and share offset 0, then b and d go above them
+    EXPECT_EQ(0, planner.get_offset(a));
+    EXPECT_EQ(0, planner.get_offset(c));
+    EXPECT_EQ(8, planner.get_offset(b));
+    EXPECT_EQ(8, planner.get_offset(d));
+    EXPECT_EQ(12, planner.get_peak());
+    EXPECT_EQ(12, planner.get_lower_bound());
+}
+
+TEST(interval_planner, reuses_gap)
+{
+    pass::IntervalPlanner planner{4};
+    size_t a = planner.add(16, 0, 0);
+    size_t b = planner.add(16, 0, 2);
+    size_t c = planner.add(6, 1, 2);
+    planner.plan();
+
+    // c fits in the space a frees below b, rounded up to the alignment
+    EXPECT_EQ(0, planner.get_offset(a));
+    EXPECT_EQ(16, planner.get_offset(b));
+    EXPECT_EQ(0, planner.get_offset(c));
+    EXPECT_EQ(32, planner.get_peak());
+    EXPECT_EQ(32, planner.get_lower_bound());
+}
+
+TEST(interval_planner, bad_lifetime)
+{
+    pass::IntervalPlanner planner;
+    EXPECT_THROW(planner.add(4, 2, 1), ngraph_error);
+}
+
+TEST(interval_planner, many_buffers)
+{
+    pass::IntervalPlanner planner{8};
+    vector<size_t> sizes;
+    vector<pair<size_t, size_t>> lifetimes;
+    size_t seed = 1;
+    for (size_t i = 0; i < 2000; i++)
+    {
+        seed = seed * 6364136223846793005 + 1442695040888963407;
+        size_t first = (seed >> 33) % 500;
+        size_t last = first + (seed >> 20) % 50;
+        sizes.push_back(8 * (1 + (seed >> 45) % 64));
+        lifetimes.emplace_back(first, last);
+        planner.add(sizes.back(), first, last);
+    }
+    planner.plan();
+
+    // Buffers live at the same step never share memory
+    for (size_t i = 0; i < sizes.size(); i++)
+    {
+        size_t offset = planner.get_offset(i);
+        EXPECT_LE(offset + sizes[i], planner.get_peak());
+        for (size_t j = i + 1; j < sizes.size(); j++)
+        {
+            if (lifetimes[i].first <= lifetimes[j].second &&
+                lifetimes[j].first <= lifetimes[i].second)
+            {
+                size_t other_offset = planner.get_offset(j);
+                EXPECT_TRUE(offset + sizes[i] <= other_offset ||
+                            other_offset + sizes[j] <= offset);
+            }
+        }
+    }
+    EXPECT_LE(planner.get_lower_bound(), planner.get_peak());
+}
+
+static shared_ptr<Function> make_in_place_chain(shared_ptr<Node>& first, shared_ptr<Node>& second)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto t0 = make_shared<op::Exp>(A);
+    auto t1 = make_shared<op::Negative>(t0);
+    auto t2 = make_shared<op::Abs>(t1);
+    for (auto op : vector<shared_ptr<op::Op>>{t1, t2})
+    {
+        auto op_annotations = make_shared<op::util::OpAnnotations>();
+        op_annotations->add_in_place_oi_pair({0, 0});
+        op->set_op_annotations(op_annotations);
+    }
+    first = t0;
+    second = t2;
+    return make_shared<Function>(make_shared<op::Add>(t2, A), op::ParameterVector{A});
+}
+
+TEST(memory_layout, in_place)
+{
+    for (auto planner :
+         {pass::MemoryLayout::Planner::GREEDY, pass::MemoryLayout::Planner::INTERVAL})
+    {
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::Liveness>();
+        pass_manager.register_pass<pass::MemoryLayout>(64, false, nullptr, planner);
+
+        shared_ptr<Node> first;
+        shared_ptr<Node> second;
+        auto f = make_in_place_chain(first, second);
+        pass_manager.run_passes(f);
+
+        // The whole chain lives in one buffer, plus one for the result of the Add
+        EXPECT_EQ(first->get_output_tensor(0).get_pool_offset(),
+                  second->get_output_tensor(0).get_pool_offset());
+        EXPECT_EQ(128, f->get_temporary_pool_size());
+    }
+}
+
+TEST(memory_layout, in_place_disabled_without_sharing)
+{
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(64, true);
+
+    shared_ptr<Node> first;
+    shared_ptr<Node> second;
+    auto f = make_in_place_chain(first, second);
+    pass_manager.run_passes(f);
+
+    EXPECT_NE(first->get_output_tensor(0).get_pool_offset(),
+              second->get_output_tensor(0).get_pool_offset());
+    EXPECT_EQ(256, f->get_temporary_pool_size());
+}
+
+TEST(memory_layout, in_place_pairs)
+{
+    // The pairs come from the callback, not from annotations on the graph
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto t0 = make_shared<op::Exp>(A);
+    auto t1 = make_shared<op::Negative>(t0);
+    auto f = make_shared<Function>(make_shared<op::Add>(t1, A), op::ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(
+        64,
+        false,
+        nullptr,
+        pass::MemoryLayout::Planner::INTERVAL,
+        [&t1](const Node& node) {
+            return &node == t1.get() ? vector<op::util::oi_pair>{{0, 0}}
+                                     : vector<op::util::oi_pair>{};
+        });
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(t0->get_output_tensor(0).get_pool_offset(),
+              t1->get_output_tensor(0).get_pool_offset());
+    EXPECT_EQ(128, f->get_temporary_pool_size());
+}
+
+TEST(memory_layout, interpreter_keeps_annotations_out_of_graph)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto t = make_shared<op::Negative>(make_shared<op::Exp>(A));
+    auto f = make_shared<Function>(make_shared<op::Abs>(t), op::ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    backend->compile(f);
+
+    auto ordered_ops = f->get_ordered_ops();
+    for (shared_ptr<Node> node : *ordered_ops)
+    {
+        auto op = dynamic_pointer_cast<op::Op>(node);
+        EXPECT_TRUE(!op || !op->get_op_annotations());
+    }
+}
@@ -729,6 +729,21 @@ TEST(pattern, recurrent_graph_rewrite)
         auto add_b = right_abs->get_argument(0);
         ASSERT_EQ(add_b, b);
     }
+
+    {
+        // add_outer is visited before add_inner and only matches once add_inner has been
+        // replaced by the zero constant
+        auto a = make_shared<op::Parameter>(element::i32, shape);
+        auto iconst0 = construct_constant_node(0);
+        auto add_inner = construct_constant_node(0) + iconst0;
+        auto add_outer = add_inner + a;
+        auto graph = std::make_shared<op::Abs>(add_outer);
+
+        auto f = std::make_shared<Function>(ngraph::NodeVector{graph}, op::ParameterVector{a});
+        pass_manager.run_passes(f);
+
+        ASSERT_EQ(graph->get_argument(0), a);
+    }
 }
 
 TEST(pattern, label_on_skip)
@@ -158,6 +158,122 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, lazy_constant)
+{
+    const string tmp_file = "serialize_lazy_constant.cpio";
+    auto A = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto B = op::Constant::create(element::i32, Shape{3}, {-1, 0, 1});
+    auto f = make_shared<Function>(NodeVector{A, B}, op::ParameterVector{});
+    serialize(tmp_file, f);
+    auto g = deserialize(tmp_file);
+    ASSERT_NE(g, nullptr);
+    file_util::remove_file(tmp_file);
+
+    auto a = dynamic_pointer_cast<op::Constant>(g->get_output_op(0)->get_argument(0));
+    auto b = dynamic_pointer_cast<op::Constant>(g->get_output_op(1)->get_argument(0));
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_FALSE(a->is_data_loaded());
+    EXPECT_FALSE(b->is_data_loaded());
+
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), a->get_vector<float>());
+    EXPECT_TRUE(a->is_data_loaded());
+    EXPECT_FALSE(b->is_data_loaded());
+
+    // Data held through get_data outlives release_data
+    shared_ptr<const void> pinned = a->get_data();
+    EXPECT_TRUE(a->release_data());
+    EXPECT_FALSE(a->is_data_loaded());
+    EXPECT_EQ(4, static_cast<const float*>(pinned.get())[3]);
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), a->get_vector<float>());
+    EXPECT_EQ((vector<int32_t>{-1, 0, 1}), b->get_vector<int32_t>());
+
+    EXPECT_TRUE(A->is_data_loaded());
+    EXPECT_FALSE(A->release_data());
+}
+
+TEST(serialize, binary_model)
+{
+    const string tmp_file = "serialize_binary_model.bin";
+    Shape shape{2, 2, 2};
+    auto A = op::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6, 7, 8});
+    auto B = op::Constant::create(element::i32, Shape{3}, {-1, 0, 1});
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(NodeVector{A + C, B}, op::ParameterVector{C});
+    serialize_binary(tmp_file, f);
+
+    auto check = [](shared_ptr<Function> g) {
+        ASSERT_NE(g, nullptr);
+        ASSERT_EQ(g->get_output_size(), 2);
+        size_t found = 0;
+        for (shared_ptr<Node> node : g->get_ops())
+        {
+            shared_ptr<op::Constant> c = dynamic_pointer_cast<op::Constant>(node);
+            if (c)
+            {
+                // Each constant refers to its own page-aligned section of the model
+                EXPECT_EQ(reinterpret_cast<uintptr_t>(c->get_data_ptr()) % 4096, 0);
+                if (c->get_element_type() == element::f32)
+                {
+                    EXPECT_EQ((vector<float>{1, 2, 3, 4, 5, 6, 7, 8}), c->get_vector<float>());
+                }
+                else
+                {
+                    EXPECT_EQ((vector<int32_t>{-1, 0, 1}), c->get_vector<int32_t>());
+                }
+                found++;
+            }
+        }
+        EXPECT_EQ(found, 2);
+    };
+
+    check(deserialize_binary(tmp_file));
+    check(deserialize(tmp_file));
+    {
+        ifstream in(tmp_file, ios_base::binary | ios_base::in);
+        check(deserialize(in));
+    }
+    {
+        stringstream in(file_util::read_file_to_string(tmp_file));
+        check(deserialize(in));
+    }
+
+    // Copies of a mapped constant share the mapping
+    auto g = deserialize_binary(tmp_file);
+    file_util::remove_file(tmp_file);
+    for (shared_ptr<Node> node : g->get_ops())
+    {
+        if (auto c = dynamic_pointer_cast<op::Constant>(node))
+        {
+            auto copy = dynamic_pointer_cast<op::Constant>(c->copy_with_new_args({}));
+            EXPECT_EQ(copy->get_data_ptr(), c->get_data_ptr());
+        }
+    }
+}
+
+TEST(serialize, quantize_dequantize)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto quantize = make_shared<op::Quantize>(A, element::u8, 0.1, 128);
+    auto dequantize = make_shared<op::Dequantize>(quantize, element::f64, 0.1, 128);
+    auto f = make_shared<Function>(dequantize, op::ParameterVector{A});
+
+    auto g = deserialize(serialize(f));
+    ASSERT_NE(g, nullptr);
+
+    auto d = dynamic_pointer_cast<op::Dequantize>(g->get_output_op(0)->get_argument(0));
+    ASSERT_NE(d, nullptr);
+    EXPECT_EQ(element::f64, d->get_element_type());
+    EXPECT_EQ(0.1, d->get_scale());
+    EXPECT_EQ(128, d->get_zero_point());
+
+    auto q = dynamic_pointer_cast<op::Quantize>(d->get_argument(0));
+    ASSERT_NE(q, nullptr);
+    EXPECT_EQ(element::u8, q->get_element_type());
+    EXPECT_EQ(0.1, q->get_scale());
+    EXPECT_EQ(128, q->get_zero_point());
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/strided_walk.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(strided_walk, dense_and_projected_strides)
+{
+    ASSERT_EQ(ElementStrides{}, dense_strides(Shape{}));
+    ASSERT_EQ((ElementStrides{84, 12, 1}), dense_strides(Shape{5, 7, 12}));
+    ASSERT_EQ((ElementStrides{12, 0, 1}), projected_strides(Shape{5, 7, 12}, AxisSet{1}));
+    ASSERT_EQ((ElementStrides{0, 0, 0}), projected_strides(Shape{5, 7, 12}, AxisSet{0, 1, 2}));
+}
+
+TEST(strided_walk, contiguous_axes_collapse_to_one_run)
+{
+    Shape shape{2, 1, 3, 4};
+    StridedWalk<1> walk(shape, {{dense_strides(shape)}});
+
+    size_t runs = 0;
+    walk.for_each_run([&](const StridedWalk<1>::Offsets& offsets,
+                          size_t count,
+                          const StridedWalk<1>::Offsets& strides) {
+        EXPECT_EQ(0, offsets[0]);
+        EXPECT_EQ(24, count);
+        EXPECT_EQ(1, strides[0]);
+        runs++;
+    });
+    EXPECT_EQ(1, runs);
+}
+
+TEST(strided_walk, broadcast_and_reverse_offsets)
+{
+    // Broadcast a {3} vector along axis 0 of a {2, 3} output and read it backwards.
+    Shape shape{2, 3};
+    ElementStrides in_strides = projected_strides(shape, AxisSet{0});
+    in_strides[1] = -in_strides[1];
+
+    StridedWalk<2> walk(shape, {{dense_strides(shape), in_strides}}, {{0, 2}});
+    vector<ptrdiff_t> out_offsets;
+    vector<ptrdiff_t> in_offsets;
+    walk.for_each([&](const StridedWalk<2>::Offsets& offsets) {
+        out_offsets.push_back(offsets[0]);
+        in_offsets.push_back(offsets[1]);
+    });
+    EXPECT_EQ((vector<ptrdiff_t>{0, 1, 2, 3, 4, 5}), out_offsets);
+    EXPECT_EQ((vector<ptrdiff_t>{2, 1, 0, 2, 1, 0}), in_offsets);
+}
+
+TEST(strided_walk, empty_shape_visits_nothing)
+{
+    Shape shape{3, 0, 2};
+    StridedWalk<1> walk(shape, {{dense_strides(shape)}});
+    size_t visits = 0;
+    walk.for_each([&](const StridedWalk<1>::Offsets&) { visits++; });
+    EXPECT_EQ(0, visits);
+
+    walk.reset(Shape{}, {{ElementStrides{}}}, {{7}});
+    walk.for_each([&](const StridedWalk<1>::Offsets& offsets) {
+        EXPECT_EQ(7, offsets[0]);
+        visits++;
+    });
+    EXPECT_EQ(1, visits);
+}
+
+TEST(strided_walk, window_is_clipped_to_padded_image)
+{
+    // A 3x3 window with stride 2 and padding 1 over a 4x4 image.
+    WindowWalk window(Shape{4, 4}, Shape{3, 3}, Strides{2, 2}, Shape{1, 1});
+
+    vector<ptrdiff_t> offsets;
+    EXPECT_EQ(4, window.move_to(Coordinate{0, 0}));
+    window.for_each([&](ptrdiff_t offset) { offsets.push_back(offset); });
+    EXPECT_EQ((vector<ptrdiff_t>{0, 1, 4, 5}), offsets);
+
+    offsets.clear();
+    EXPECT_EQ(3, window.move_to(Coordinate{1, 2}));
+    window.for_each([&](ptrdiff_t offset) { offsets.push_back(offset); });
+    EXPECT_EQ((vector<ptrdiff_t>{7, 11, 15}), offsets);
+}
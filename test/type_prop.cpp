@@ -397,6 +397,77 @@ TEST(type_prop, convert_deduce_incorrect)
     }
 }
 
+TEST(type_prop, quantize_deduce)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4});
+    auto q = make_shared<op::Quantize>(param, element::u8, 0.5, 128);
+    ASSERT_EQ(q->get_element_type(), element::u8);
+    ASSERT_EQ(q->get_shape(), (Shape{2, 3, 4}));
+
+    auto d = make_shared<op::Dequantize>(q, element::f32, 0.5, 128);
+    ASSERT_EQ(d->get_element_type(), element::f32);
+    ASSERT_EQ(d->get_shape(), (Shape{2, 3, 4}));
+}
+
+TEST(type_prop, quantize_invalid_type)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    try
+    {
+        auto q = make_shared<op::Quantize>(param, element::i32, 0.5, 0);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Quantize to a non 8-bit type not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(error.what(), std::string("Quantize quantized element type must be i8 or u8"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, quantize_invalid_scale)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    try
+    {
+        auto q = make_shared<op::Quantize>(param, element::i8, 0, 0);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Zero quantization scale not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(error.what(), std::string("Quantize scale must be positive and finite"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, dequantize_invalid_zero_point)
+{
+    auto param = make_shared<op::Parameter>(element::i8, Shape{2, 3});
+    try
+    {
+        auto d = make_shared<op::Dequantize>(param, element::f32, 0.5, 128);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Out of range zero point not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_EQ(error.what(),
+                  std::string("Dequantize zero point is out of range of the quantized element "
+                              "type"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
 TEST(type_prop, dot_deduce_scalar_2d)
 {
     // Deduce type for scalar/matrix arguments
@@ -14,9 +14,13 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <future>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -25,6 +29,8 @@
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/call_queue.hpp"
+#include "ngraph/runtime/reference/parallel_for.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/all_close.hpp"
 #include "util/ndarray.hpp"
@@ -298,6 +304,54 @@ TEST(graph_util, clone_multiple_results)
     auto copy = clone_function(*f);
 }
 
+TEST(graph_util, ordered_ops_after_replace)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto A_add_B = make_shared<op::Add>(A, B);
+    auto neg = make_shared<op::Negative>(A_add_B);
+    auto f = make_shared<Function>(NodeVector{neg}, op::ParameterVector{A, B});
+
+    auto ops = f->get_ordered_ops();
+    EXPECT_EQ(ops->size(), 5);
+    EXPECT_EQ(f->get_ordered_ops(), ops);
+
+    // Rewiring through the free replace_node must not leave a stale order behind
+    auto A_mul_B = make_shared<op::Multiply>(A, B);
+    replace_node(A_add_B, A_mul_B);
+    auto old_ops = ops;
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops->size(), 5);
+    EXPECT_EQ(count(ops->begin(), ops->end(), A_add_B), 0);
+    auto mul_it = find(ops->begin(), ops->end(), A_mul_B);
+    auto neg_it = find(ops->begin(), ops->end(), neg);
+    ASSERT_NE(mul_it, ops->end());
+    EXPECT_LT(distance(ops->begin(), mul_it), distance(ops->begin(), neg_it));
+
+    // An order handed out earlier is a snapshot and is left as it was
+    EXPECT_NE(old_ops, ops);
+    EXPECT_EQ(count(old_ops->begin(), old_ops->end(), A_add_B), 1);
+    EXPECT_EQ(count(old_ops->begin(), old_ops->end(), A_mul_B), 0);
+
+    auto abs = make_shared<op::Abs>(A);
+    f->replace_node(A_mul_B, abs);
+    ops = f->get_ordered_ops();
+    EXPECT_EQ(ops->size(), 5);
+    EXPECT_EQ(count(ops->begin(), ops->end(), abs), 1);
+
+    // Each Function sharing the rewired node sees the change
+    auto g = make_shared<Function>(NodeVector{make_shared<op::Exp>(neg)}, op::ParameterVector{A});
+    auto g_ops = g->get_ordered_ops();
+    EXPECT_EQ(count(g_ops->begin(), g_ops->end(), abs), 1);
+    auto sqrt = make_shared<op::Sqrt>(A);
+    replace_node(abs, sqrt);
+    ops = f->get_ordered_ops();
+    g_ops = g->get_ordered_ops();
+    EXPECT_EQ(count(ops->begin(), ops->end(), sqrt), 1);
+    EXPECT_EQ(count(g_ops->begin(), g_ops->end(), sqrt), 1);
+}
+
 TEST(util, round_up)
 {
     EXPECT_EQ(0, round_up(0, 4));
@@ -324,3 +378,47 @@ TEST(util, parse_string)
     EXPECT_FLOAT_EQ(-numeric_limits<double>::infinity(), parse_string<double>("-INFINITY"));
     EXPECT_TRUE(std::isnan(parse_string<double>("NaN")));
 }
+
+TEST(util, parallel_for)
+{
+    vector<int> visits(1000, 0);
+    runtime::reference::parallel_for(visits.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++)
+        {
+            visits[i]++;
+        }
+    });
+    EXPECT_EQ(count(visits.begin(), visits.end(), 1), visits.size());
+
+    // Every chunk finishes before the exception of a failing one reaches the caller
+    atomic<size_t> finished(0);
+    EXPECT_THROW(runtime::reference::parallel_for(visits.size(),
+                                                  1,
+                                                  [&](size_t begin, size_t end) {
+                                                      if (begin == 0)
+                                                      {
+                                                          throw ngraph_error("chunk failed");
+                                                      }
+                                                      finished += end - begin;
+                                                  }),
+                 ngraph_error);
+    size_t chunk_count = min<size_t>(visits.size(), max(1u, thread::hardware_concurrency()));
+    EXPECT_EQ(finished, visits.size() - visits.size() / chunk_count);
+}
+
+TEST(util, call_queue_destroyed_by_task)
+{
+    // The queued task holds the last reference, so the queue is destroyed on its own worker
+    promise<void> destroyed;
+    shared_ptr<runtime::CallQueue> queue(new runtime::CallQueue(2),
+                                         [&destroyed](runtime::CallQueue* q) {
+                                             delete q;
+                                             destroyed.set_value();
+                                         });
+    promise<void> released;
+    shared_future<void> released_future = released.get_future();
+    queue->enqueue([queue, released_future]() { released_future.wait(); });
+    queue.reset();
+    released.set_value();
+    EXPECT_EQ(destroyed.get_future().wait_for(chrono::seconds(10)), future_status::ready);
+}